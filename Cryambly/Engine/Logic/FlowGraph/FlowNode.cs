@@ -36,6 +36,9 @@ namespace CryCil.Engine.Logic
 		private string description;
 		private InputPort[] inputs;
 		private OutputPort[] outputs;
+		// Reused by every activation, so they don't allocate memory.
+		private readonly ActivationSet activationSet = new ActivationSet(new SortedList<InputPort, bool>());
+		private bool regularlyUpdated;
 		#endregion
 		#region Properties
 		/// <summary>
@@ -103,6 +106,25 @@ namespace CryCil.Engine.Logic
 			}
 		}
 
+		/// <summary>
+		/// Gets or sets the value that indicates whether <see cref="Think"/> is invoked every frame.
+		/// </summary>
+		/// <remarks>
+		/// All nodes that are updated every frame are updated at once with a single call from the
+		/// underlying framework. Nodes are not updated while suspended.
+		/// </remarks>
+		public bool RegularlyUpdated
+		{
+			get { return this.regularlyUpdated; }
+			set
+			{
+				if (this.regularlyUpdated != value)
+				{
+					SetRegularlyUpdated(this.GraphHandle, this.Id, value);
+					this.regularlyUpdated = value;
+				}
+			}
+		}
 		/// <summary>
 		/// Gets the identifier of this node.
 		/// </summary>
@@ -138,6 +160,8 @@ namespace CryCil.Engine.Logic
 		}
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		private static extern void Deactivate(IntPtr graphHandle, ushort nodeId);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern void SetRegularlyUpdated(IntPtr graphHandle, ushort nodeId, bool value);
 		#endregion
 		#region Interface
 		/// <summary>
@@ -364,29 +388,39 @@ namespace CryCil.Engine.Logic
 				MonoInterface.DisplayException(ex);
 			}
 		}
+		[RawThunk("Invoked from underlying framework to update all nodes that are updated every frame.")]
+		private static void UpdateNodes(FlowNode[] nodes, int count)
+		{
+			for (int i = 0; i < count; i++)
+			{
+				nodes[i].Update();
+			}
+		}
 		[RawThunk("Invoked from underlying framework to inform this node about input ports being activated.")]
-		private void Activate(byte[] portIds, FlowData[] values)
+		private unsafe void Activate(FlowPortActivation* activations, int count)
 		{
 			try
 			{
-				SortedList<InputPort, bool> activatedPorts =
-					new SortedList<InputPort, bool>(portIds.ToDictionary(id => this.inputs[id], id => false));
+				SortedList<InputPort, bool> activatedPorts = this.activationSet.ActivatedPorts;
+				activatedPorts.Clear();
 
-				for (int i = 0; i < activatedPorts.Keys.Count; i++)
+				for (int i = 0; i < count; i++)
 				{
-					activatedPorts.Keys[i].Assign(values[portIds[i]]);
+					InputPort port = this.inputs[activations[i].PortId];
+					port.Assign(activations[i].Value);
+					activatedPorts.Add(port, false);
 				}
 
-				this.MultiActivate(new ActivationSet(activatedPorts));
-
-				var portsToActivate =
-					from activatedPort in activatedPorts
-					where !activatedPort.Value
-					select activatedPort.Key;
+				this.MultiActivate(this.activationSet);
 
-				foreach (InputPort port in portsToActivate)
+				IList<InputPort> ports = activatedPorts.Keys;
+				IList<bool> processed = activatedPorts.Values;
+				for (int i = 0; i < ports.Count; i++)
 				{
-					port.Activate();
+					if (!processed[i])
+					{
+						ports[i].Activate();
+					}
 				}
 			}
 			catch (Exception ex)
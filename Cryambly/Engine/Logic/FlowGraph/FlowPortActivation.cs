@@ -0,0 +1,17 @@
+﻿using System;
+using System.Linq;
+using System.Runtime.InteropServices;
+
+namespace CryCil.Engine.Logic
+{
+	// Represents an input port that was activated along with the value that was passed to it. Objects of
+	// this type are read directly from the native buffer that is reused by the node, so the layout must
+	// match MonoFlowPortActivation: FlowData is packed to 4 bytes on every platform, and the whole structure
+	// takes 20 bytes.
+	[StructLayout(LayoutKind.Sequential, Pack = 4)]
+	internal struct FlowPortActivation
+	{
+		internal FlowData Value;
+		internal byte PortId;
+	}
+}
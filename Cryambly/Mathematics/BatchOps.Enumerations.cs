@@ -107,4 +107,20 @@ namespace CryCil
 		/// </summary>
 		Arctangent2
 	}
+
+	/// <summary>
+	/// Enumeration of modes that define how batch mathematical operations are calculated.
+	/// </summary>
+	public enum BatchOpsAccuracy
+	{
+		/// <summary>
+		/// Vectorized approximations are used. Results can differ from ones returned by standard
+		/// functions by few units in the last place.
+		/// </summary>
+		Fast = 0,
+		/// <summary>
+		/// Standard library functions are called for every number.
+		/// </summary>
+		Precise
+	}
 }
\ No newline at end of file
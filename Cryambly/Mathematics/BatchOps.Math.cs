@@ -43,6 +43,10 @@ namespace CryCil
 		/// </summary>
 		public static unsafe class Math
 		{
+			/// <summary>
+			/// Maximal number of operations that can be passed to one call to Apply.
+			/// </summary>
+			public const int MaxProgramLength = 32;
 			/// <summary>
 			/// Calculates sines of all numbers in the given array.
 			/// </summary>
@@ -1526,6 +1530,80 @@ namespace CryCil
 				}
 			}
 			/// <summary>
+			/// Applies a sequence of operations to all numbers in the given array.
+			/// </summary>
+			/// <remarks>
+			/// The array is processed in small blocks with all operations applied to one block before
+			/// moving to the next one, which is faster than calling functions that apply each operation
+			/// separately.
+			/// </remarks>
+			/// <example>
+			/// <code>
+			/// // Calculates e^sin(x) for every number.
+			/// BatchOps.Math.Apply(numbers, MathSimpleOperations.Sine, MathSimpleOperations.Exponent);
+			/// </code>
+			/// </example>
+			/// <param name="numbers">
+			/// An array of numbers which values get replaced by results of calculation.
+			/// </param>
+			/// <param name="operations">
+			/// A sequence of operations to apply. Can contain up to <see cref="MaxProgramLength"/>
+			/// operations.
+			/// </param>
+			/// <exception cref="ArgumentNullException">Sequence of operations is null.</exception>
+			/// <exception cref="ArgumentException">Sequence of operations is too long.</exception>
+			public static void Apply(float[] numbers, params MathSimpleOperations[] operations)
+			{
+				CheckProgram(operations);
+				if (numbers == null || numbers.LongLength == 0 || operations.Length == 0)
+				{
+					return;
+				}
+
+				fixed (float* ptr = numbers)
+				fixed (MathSimpleOperations* ops = operations)
+				{
+					MathSimpleProgramSingle(ptr, numbers.LongLength, ops, operations.Length);
+				}
+			}
+			/// <summary>
+			/// Applies a sequence of operations to all numbers in the given array.
+			/// </summary>
+			/// <remarks>
+			/// The array is processed in small blocks with all operations applied to one block before
+			/// moving to the next one, which is faster than calling functions that apply each operation
+			/// separately.
+			/// </remarks>
+			/// <example>
+			/// <code>
+			/// // Calculates e^sin(x) for every number.
+			/// BatchOps.Math.Apply(numbers, MathSimpleOperations.Sine, MathSimpleOperations.Exponent);
+			/// </code>
+			/// </example>
+			/// <param name="numbers">
+			/// An array of numbers which values get replaced by results of calculation.
+			/// </param>
+			/// <param name="operations">
+			/// A sequence of operations to apply. Can contain up to <see cref="MaxProgramLength"/>
+			/// operations.
+			/// </param>
+			/// <exception cref="ArgumentNullException">Sequence of operations is null.</exception>
+			/// <exception cref="ArgumentException">Sequence of operations is too long.</exception>
+			public static void Apply(double[] numbers, params MathSimpleOperations[] operations)
+			{
+				CheckProgram(operations);
+				if (numbers == null || numbers.LongLength == 0 || operations.Length == 0)
+				{
+					return;
+				}
+
+				fixed (double* ptr = numbers)
+				fixed (MathSimpleOperations* ops = operations)
+				{
+					MathSimpleProgramDouble(ptr, numbers.LongLength, ops, operations.Length);
+				}
+			}
+			/// <summary>
 			/// Calculates power of a sequence of numbers.
 			/// </summary>
 			/// <param name="data">
@@ -1569,8 +1647,8 @@ namespace CryCil
 			/// Calculates logarithms of a sequence of numbers.
 			/// </summary>
 			/// <param name="data">
-			/// An array of 3D vectors where X-coordinate is a logarithm base, Y-coordinate is a number for
-			/// which the logarithm has to be calculated and Z-coordinate becomes a result of calculation
+			/// An array of 3D vectors where X-coordinate is a number for which the logarithm has to be
+			/// calculated, Y-coordinate is a logarithm base and Z-coordinate becomes a result of calculation
 			/// after this function concludes.
 			/// </param>
 			public static void Logarithm(Vector3[] data)
@@ -1589,8 +1667,8 @@ namespace CryCil
 			/// Calculates logarithms of a sequence of numbers.
 			/// </summary>
 			/// <param name="data">
-			/// An array of 3D vectors where X-coordinate is a logarithm base, Y-coordinate is a number for
-			/// which the logarithm has to be calculated and Z-coordinate becomes a result of calculation
+			/// An array of 3D vectors where X-coordinate is a number for which the logarithm has to be
+			/// calculated, Y-coordinate is a logarithm base and Z-coordinate becomes a result of calculation
 			/// after this function concludes.
 			/// </param>
 			public static void Logarithm(Vector3Double[] data)
@@ -1681,6 +1759,269 @@ namespace CryCil
 					Math3NumberOpDouble(ptr, data.LongLength, Math3NumberOperations.Arctangent2);
 				}
 			}
+			/// <summary>
+			/// Raises numbers to powers.
+			/// </summary>
+			/// <remarks>
+			/// Separate arrays are processed faster than arrays of vectors, since numbers don't need to be
+			/// rearranged before and after calculations. Arrays of results can be the same as arrays of
+			/// arguments.
+			/// </remarks>
+			/// <param name="bases">An array of numbers that need to be raised to powers.</param>
+			/// <param name="powers">An array of powers.</param>
+			/// <param name="results">An array that will contain the results of calculations.</param>
+			/// <exception cref="ArgumentNullException">One of the arrays is null.</exception>
+			/// <exception cref="ArgumentException">Arrays have different lengths.</exception>
+			public static void Power(float[] bases, float[] powers, float[] results)
+			{
+				CheckArrays(bases, powers, results);
+				if (bases.LongLength == 0)
+				{
+					return;
+				}
+
+				fixed (float* basesPtr = bases)
+				fixed (float* powersPtr = powers)
+				fixed (float* resultsPtr = results)
+				{
+					Math3NumberOpSingleArrays(basesPtr, powersPtr, resultsPtr, bases.LongLength,
+											  Math3NumberOperations.Power);
+				}
+			}
+			/// <summary>
+			/// Raises numbers to powers.
+			/// </summary>
+			/// <remarks>
+			/// Separate arrays are processed faster than arrays of vectors, since numbers don't need to be
+			/// rearranged before and after calculations. Arrays of results can be the same as arrays of
+			/// arguments.
+			/// </remarks>
+			/// <param name="bases">An array of numbers that need to be raised to powers.</param>
+			/// <param name="powers">An array of powers.</param>
+			/// <param name="results">An array that will contain the results of calculations.</param>
+			/// <exception cref="ArgumentNullException">One of the arrays is null.</exception>
+			/// <exception cref="ArgumentException">Arrays have different lengths.</exception>
+			public static void Power(double[] bases, double[] powers, double[] results)
+			{
+				CheckArrays(bases, powers, results);
+				if (bases.LongLength == 0)
+				{
+					return;
+				}
+
+				fixed (double* basesPtr = bases)
+				fixed (double* powersPtr = powers)
+				fixed (double* resultsPtr = results)
+				{
+					Math3NumberOpDoubleArrays(basesPtr, powersPtr, resultsPtr, bases.LongLength,
+											  Math3NumberOperations.Power);
+				}
+			}
+			/// <summary>
+			/// Calculates logarithms of numbers.
+			/// </summary>
+			/// <remarks>
+			/// Separate arrays are processed faster than arrays of vectors, since numbers don't need to be
+			/// rearranged before and after calculations. Arrays of results can be the same as arrays of
+			/// arguments.
+			/// </remarks>
+			/// <param name="numbers">An array of numbers for which logarithms have to be calculated.</param>
+			/// <param name="bases">An array of logarithm bases.</param>
+			/// <param name="results">An array that will contain the results of calculations.</param>
+			/// <exception cref="ArgumentNullException">One of the arrays is null.</exception>
+			/// <exception cref="ArgumentException">Arrays have different lengths.</exception>
+			public static void Logarithm(float[] numbers, float[] bases, float[] results)
+			{
+				CheckArrays(numbers, bases, results);
+				if (numbers.LongLength == 0)
+				{
+					return;
+				}
+
+				fixed (float* numbersPtr = numbers)
+				fixed (float* basesPtr = bases)
+				fixed (float* resultsPtr = results)
+				{
+					Math3NumberOpSingleArrays(numbersPtr, basesPtr, resultsPtr, numbers.LongLength,
+											  Math3NumberOperations.Logarithm);
+				}
+			}
+			/// <summary>
+			/// Calculates logarithms of numbers.
+			/// </summary>
+			/// <remarks>
+			/// Separate arrays are processed faster than arrays of vectors, since numbers don't need to be
+			/// rearranged before and after calculations. Arrays of results can be the same as arrays of
+			/// arguments.
+			/// </remarks>
+			/// <param name="numbers">An array of numbers for which logarithms have to be calculated.</param>
+			/// <param name="bases">An array of logarithm bases.</param>
+			/// <param name="results">An array that will contain the results of calculations.</param>
+			/// <exception cref="ArgumentNullException">One of the arrays is null.</exception>
+			/// <exception cref="ArgumentException">Arrays have different lengths.</exception>
+			public static void Logarithm(double[] numbers, double[] bases, double[] results)
+			{
+				CheckArrays(numbers, bases, results);
+				if (numbers.LongLength == 0)
+				{
+					return;
+				}
+
+				fixed (double* numbersPtr = numbers)
+				fixed (double* basesPtr = bases)
+				fixed (double* resultsPtr = results)
+				{
+					Math3NumberOpDoubleArrays(numbersPtr, basesPtr, resultsPtr, numbers.LongLength,
+											  Math3NumberOperations.Logarithm);
+				}
+			}
+			/// <summary>
+			/// Calculates both sine and cosine of a sequence of numbers.
+			/// </summary>
+			/// <remarks>
+			/// Separate arrays are processed faster than arrays of vectors, since numbers don't need to be
+			/// rearranged before and after calculations. Arrays of results can be the same as arrays of
+			/// arguments.
+			/// </remarks>
+			/// <param name="angles">An array of numbers which sine and cosine need to be calculated.</param>
+			/// <param name="sines">An array that will contain resultant sines.</param>
+			/// <param name="cosines">An array that will contain resultant cosines.</param>
+			/// <exception cref="ArgumentNullException">One of the arrays is null.</exception>
+			/// <exception cref="ArgumentException">Arrays have different lengths.</exception>
+			public static void SineCosine(float[] angles, float[] sines, float[] cosines)
+			{
+				CheckArrays(angles, sines, cosines);
+				if (angles.LongLength == 0)
+				{
+					return;
+				}
+
+				fixed (float* anglesPtr = angles)
+				fixed (float* sinesPtr = sines)
+				fixed (float* cosinesPtr = cosines)
+				{
+					Math3NumberOpSingleArrays(anglesPtr, sinesPtr, cosinesPtr, angles.LongLength,
+											  Math3NumberOperations.SineCosine);
+				}
+			}
+			/// <summary>
+			/// Calculates both sine and cosine of a sequence of numbers.
+			/// </summary>
+			/// <remarks>
+			/// Separate arrays are processed faster than arrays of vectors, since numbers don't need to be
+			/// rearranged before and after calculations. Arrays of results can be the same as arrays of
+			/// arguments.
+			/// </remarks>
+			/// <param name="angles">An array of numbers which sine and cosine need to be calculated.</param>
+			/// <param name="sines">An array that will contain resultant sines.</param>
+			/// <param name="cosines">An array that will contain resultant cosines.</param>
+			/// <exception cref="ArgumentNullException">One of the arrays is null.</exception>
+			/// <exception cref="ArgumentException">Arrays have different lengths.</exception>
+			public static void SineCosine(double[] angles, double[] sines, double[] cosines)
+			{
+				CheckArrays(angles, sines, cosines);
+				if (angles.LongLength == 0)
+				{
+					return;
+				}
+
+				fixed (double* anglesPtr = angles)
+				fixed (double* sinesPtr = sines)
+				fixed (double* cosinesPtr = cosines)
+				{
+					Math3NumberOpDoubleArrays(anglesPtr, sinesPtr, cosinesPtr, angles.LongLength,
+											  Math3NumberOperations.SineCosine);
+				}
+			}
+			/// <summary>
+			/// Calculates angles defined by two tangents.
+			/// </summary>
+			/// <remarks>
+			/// Separate arrays are processed faster than arrays of vectors, since numbers don't need to be
+			/// rearranged before and after calculations. Arrays of results can be the same as arrays of
+			/// arguments.
+			/// </remarks>
+			/// <param name="y">An array of first tangents (Y-coordinates of vectors).</param>
+			/// <param name="x">An array of second tangents (X-coordinates of vectors).</param>
+			/// <param name="results">An array that will contain resultant angles.</param>
+			/// <exception cref="ArgumentNullException">One of the arrays is null.</exception>
+			/// <exception cref="ArgumentException">Arrays have different lengths.</exception>
+			public static void Arctangent2(float[] y, float[] x, float[] results)
+			{
+				CheckArrays(y, x, results);
+				if (y.LongLength == 0)
+				{
+					return;
+				}
+
+				fixed (float* yPtr = y)
+				fixed (float* xPtr = x)
+				fixed (float* resultsPtr = results)
+				{
+					Math3NumberOpSingleArrays(yPtr, xPtr, resultsPtr, y.LongLength,
+											  Math3NumberOperations.Arctangent2);
+				}
+			}
+			/// <summary>
+			/// Calculates angles defined by two tangents.
+			/// </summary>
+			/// <remarks>
+			/// Separate arrays are processed faster than arrays of vectors, since numbers don't need to be
+			/// rearranged before and after calculations. Arrays of results can be the same as arrays of
+			/// arguments.
+			/// </remarks>
+			/// <param name="y">An array of first tangents (Y-coordinates of vectors).</param>
+			/// <param name="x">An array of second tangents (X-coordinates of vectors).</param>
+			/// <param name="results">An array that will contain resultant angles.</param>
+			/// <exception cref="ArgumentNullException">One of the arrays is null.</exception>
+			/// <exception cref="ArgumentException">Arrays have different lengths.</exception>
+			public static void Arctangent2(double[] y, double[] x, double[] results)
+			{
+				CheckArrays(y, x, results);
+				if (y.LongLength == 0)
+				{
+					return;
+				}
+
+				fixed (double* yPtr = y)
+				fixed (double* xPtr = x)
+				fixed (double* resultsPtr = results)
+				{
+					Math3NumberOpDoubleArrays(yPtr, xPtr, resultsPtr, y.LongLength,
+											  Math3NumberOperations.Arctangent2);
+				}
+			}
+			private static void CheckProgram(MathSimpleOperations[] operations)
+			{
+				if (operations == null)
+				{
+					throw new ArgumentNullException(nameof(operations), "Sequence of operations cannot be null.");
+				}
+				if (operations.Length > MaxProgramLength)
+				{
+					string message = $"Sequence of operations cannot contain more than {MaxProgramLength} operations.";
+					throw new ArgumentException(message, nameof(operations));
+				}
+			}
+			private static void CheckArrays<T>(T[] first, T[] second, T[] third)
+			{
+				if (first == null)
+				{
+					throw new ArgumentNullException(nameof(first), "Array of arguments cannot be null.");
+				}
+				if (second == null)
+				{
+					throw new ArgumentNullException(nameof(second), "Array of arguments cannot be null.");
+				}
+				if (third == null)
+				{
+					throw new ArgumentNullException(nameof(third), "Array of results cannot be null.");
+				}
+				if (first.LongLength != second.LongLength || first.LongLength != third.LongLength)
+				{
+					throw new ArgumentException("Arrays of arguments and results must have the same length.");
+				}
+			}
 			private static void CopyToResults<T>(T[] sourceArray, T[] resultsArray)
 			{
 				try
@@ -9,15 +9,39 @@ namespace CryCil
 	/// </summary>
 	public static unsafe partial class BatchOps
 	{
+		/// <summary>
+		/// Gets or sets the mode that defines how batch mathematical operations are calculated.
+		/// </summary>
+		public static BatchOpsAccuracy Accuracy
+		{
+			get { return GetAccuracy(); }
+			set { SetAccuracy(value); }
+		}
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void MathSimpleOpSingle(float* numbers, long count, MathSimpleOperations op);
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void MathSimpleOpDouble(double* numbers, long count, MathSimpleOperations op);
 		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void MathSimpleProgramSingle(float* numbers, long count,
+															MathSimpleOperations* ops, int opCount);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void MathSimpleProgramDouble(double* numbers, long count,
+															MathSimpleOperations* ops, int opCount);
+		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void Math3NumberOpSingle(Vector3* numbers, long count,
 														Math3NumberOperations op);
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void Math3NumberOpDouble(Vector3Double* numbers, long count,
 														Math3NumberOperations op);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Math3NumberOpSingleArrays(float* x, float* y, float* z, long count,
+															  Math3NumberOperations op);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Math3NumberOpDoubleArrays(double* x, double* y, double* z, long count,
+															  Math3NumberOperations op);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern BatchOpsAccuracy GetAccuracy();
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern void SetAccuracy(BatchOpsAccuracy value);
 	}
 }
\ No newline at end of file
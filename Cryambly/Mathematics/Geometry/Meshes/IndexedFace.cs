@@ -0,0 +1,30 @@
+﻿using System;
+using System.Linq;
+using System.Runtime.InteropServices;
+
+namespace CryCil.Geometry
+{
+	/// <summary>
+	/// Represents a face in the mesh that refers to vertices that are shared with other faces.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct IndexedFace
+	{
+		/// <summary>
+		/// Zero-based index of the first vertex of this face.
+		/// </summary>
+		public int First;
+		/// <summary>
+		/// Zero-based index of the second vertex of this face.
+		/// </summary>
+		public int Second;
+		/// <summary>
+		/// Zero-based index of the third vertex of this face.
+		/// </summary>
+		public int Third;
+		/// <summary>
+		/// Zero-based index of the mesh subset this face belongs to.
+		/// </summary>
+		public int SubsetIndex;
+	}
+}
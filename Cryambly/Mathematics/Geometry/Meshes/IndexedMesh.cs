@@ -0,0 +1,211 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Runtime.CompilerServices;
+using CryCil.Engine.Models.StaticObjects;
+
+namespace CryCil.Geometry
+{
+	/// <summary>
+	/// Represents a triangular mesh where faces share vertices.
+	/// </summary>
+	/// <remarks>
+	/// CSG operations on this mesh are done natively, and their results have the vertices welded, so
+	/// they can be exported to CryEngine mesh without any further processing.
+	/// </remarks>
+	public unsafe class IndexedMesh
+	{
+		#region Properties
+		/// <summary>
+		/// Gets the list of vertices that are shared by the faces.
+		/// </summary>
+		public List<FullVertex> Vertices { get; private set; }
+		/// <summary>
+		/// Gets the list of faces that comprise this mesh.
+		/// </summary>
+		public List<IndexedFace> Faces { get; private set; }
+		#endregion
+		#region Construction
+		/// <summary>
+		/// Creates empty mesh.
+		/// </summary>
+		public IndexedMesh()
+		{
+			this.Vertices = new List<FullVertex>();
+			this.Faces = new List<IndexedFace>();
+		}
+		/// <summary>
+		/// Creates a new indexed mesh from native CryEngine mesh.
+		/// </summary>
+		/// <param name="cryMesh">CryEngine mesh to create this one from.</param>
+		public IndexedMesh(CryMesh cryMesh)
+			: this()
+		{
+			if (!cryMesh.IsValid)
+			{
+				return;
+			}
+
+			int vertexCount = cryMesh.Vertexes.Count;
+			for (int i = 0; i < vertexCount; i++)
+			{
+				this.Vertices.Add(new FullVertex(cryMesh, i));
+			}
+
+			for (int i = 0; i < cryMesh.Faces.Count; i++)
+			{
+				var face = cryMesh.Faces[i];
+
+				this.Faces.Add(new IndexedFace
+				{
+					First = face.First,
+					Second = face.Second,
+					Third = face.Third,
+					SubsetIndex = face.Subset
+				});
+			}
+		}
+		#endregion
+		#region Interface
+		/// <summary>
+		/// Combine this mesh with another.
+		/// </summary>
+		/// <param name="anotherMesh">Another mesh.</param>
+		/// <exception cref="ArgumentOutOfRangeException">
+		/// One of the faces refers to the vertex that is not in the mesh.
+		/// </exception>
+		public void Combine(IndexedMesh anotherMesh)
+		{
+			this.CsgOp(anotherMesh, CsgOpCode.Combine);
+		}
+		/// <summary>
+		/// Intersects this mesh with another.
+		/// </summary>
+		/// <param name="anotherMesh">Another mesh.</param>
+		/// <exception cref="ArgumentOutOfRangeException">
+		/// One of the faces refers to the vertex that is not in the mesh.
+		/// </exception>
+		public void Intersect(IndexedMesh anotherMesh)
+		{
+			this.CsgOp(anotherMesh, CsgOpCode.Intersect);
+		}
+		/// <summary>
+		/// Subtracts another mesh from this one.
+		/// </summary>
+		/// <param name="anotherMesh">Another mesh.</param>
+		/// <exception cref="ArgumentOutOfRangeException">
+		/// One of the faces refers to the vertex that is not in the mesh.
+		/// </exception>
+		public void Subtract(IndexedMesh anotherMesh)
+		{
+			this.CsgOp(anotherMesh, CsgOpCode.Subtract);
+		}
+		/// <summary>
+		/// Exports face and vertex data from this mesh to the CryEngine mesh.
+		/// </summary>
+		/// <param name="mesh">    CryEngine mesh that will host this one.</param>
+		/// <param name="override">
+		/// Indicates whether data within <paramref name="mesh"/> must be overridden by data from this one.
+		/// </param>
+		public void Export(CryMesh mesh, bool @override = true)
+		{
+			if (!mesh.IsValid)
+			{
+				return;
+			}
+
+			if (@override)
+			{
+				mesh.Faces.Clear();
+				mesh.Vertexes.Clear();
+				mesh.TexturePositions.Clear();
+			}
+
+			// Cache all parts of the mesh object so compiler doesn't complain about the error that is not
+			// the error.
+			var facesCollection = mesh.Faces;
+			var vertexesCollection = mesh.Vertexes;
+			var positionsCollection = mesh.Vertexes.Positions;
+			var normalsCollection = mesh.Vertexes.Normals;
+			var colors0Collection = mesh.Vertexes.PrimaryColors;
+			var colors1Collection = mesh.Vertexes.SecondaryColors;
+			var uvPositionsCollection = mesh.TexturePositions;
+
+			int firstVertexIndex = mesh.Vertexes.Count;
+			int firstFaceIndex = mesh.Faces.Count;
+
+			vertexesCollection.Count = firstVertexIndex + this.Vertices.Count;
+			uvPositionsCollection.Count = firstVertexIndex + this.Vertices.Count;
+			facesCollection.Count = firstFaceIndex + this.Faces.Count;
+
+			for (int i = 0, j = firstVertexIndex; i < this.Vertices.Count; i++, j++)
+			{
+				FullVertex vertex = this.Vertices[i];
+				positionsCollection[j] = vertex.Position;
+				normalsCollection[j] = new CryMeshNormal {Normal = vertex.Normal};
+				colors0Collection[j] = new CryMeshColor(vertex.PrimaryColor);
+				colors1Collection[j] = new CryMeshColor(vertex.SecondaryColor);
+				uvPositionsCollection[j] = new CryMeshTexturePosition(vertex.UvPosition);
+			}
+
+			for (int i = 0, j = firstFaceIndex; i < this.Faces.Count; i++, j++)
+			{
+				IndexedFace face = this.Faces[i];
+				facesCollection[j] = new CryMeshFace
+				{
+					First = firstVertexIndex + face.First,
+					Second = firstVertexIndex + face.Second,
+					Third = firstVertexIndex + face.Third,
+					Subset = (byte)face.SubsetIndex
+				};
+			}
+		}
+		#endregion
+		#region Utilities
+		private void CsgOp(IndexedMesh anotherMesh, CsgOpCode op)
+		{
+			var theseVertices = this.Vertices.ToArray();
+			var theseFaces = this.Faces.ToArray();
+			var otherVertices = anotherMesh.Vertices.ToArray();
+			var otherFaces = anotherMesh.Faces.ToArray();
+			fixed (FullVertex* theseVerticesPtr = theseVertices)
+			fixed (IndexedFace* theseFacesPtr = theseFaces)
+			fixed (FullVertex* otherVerticesPtr = otherVertices)
+			fixed (IndexedFace* otherFacesPtr = otherFaces)
+			{
+				UIntPtr vertexCount;
+				IndexedFace* facesPtr;
+				UIntPtr faceCount;
+				var verticesPtr = CsgOpIndexedInternal(theseVerticesPtr, theseVertices.Length, theseFacesPtr,
+													   theseFaces.Length, otherVerticesPtr, otherVertices.Length,
+													   otherFacesPtr, otherFaces.Length, op, out vertexCount,
+													   out facesPtr, out faceCount);
+				ulong vertexTotal = vertexCount.ToUInt64();
+				ulong faceTotal = faceCount.ToUInt64();
+
+				this.Vertices = new List<FullVertex>((int)vertexTotal);
+				for (ulong i = 0; i < vertexTotal; i++)
+				{
+					this.Vertices.Add(verticesPtr[i]);
+				}
+				this.Faces = new List<IndexedFace>((int)faceTotal);
+				for (ulong i = 0; i < faceTotal; i++)
+				{
+					this.Faces.Add(facesPtr[i]);
+				}
+
+				DeleteIndexedMesh(verticesPtr, facesPtr);
+			}
+		}
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern void DeleteIndexedMesh(FullVertex* verticesPtr, IndexedFace* facesPtr);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern FullVertex* CsgOpIndexedInternal(FullVertex* verticesPtr1, int vertexCount1,
+															   IndexedFace* facesPtr1, int faceCount1,
+															   FullVertex* verticesPtr2, int vertexCount2,
+															   IndexedFace* facesPtr2, int faceCount2,
+															   CsgOpCode op, out UIntPtr vertexCount,
+															   out IndexedFace* facesPtr, out UIntPtr faceCount);
+		#endregion
+	}
+}
@@ -1,5 +1,8 @@
 ﻿#pragma once
 
+#include <cstdlib>
+#include <new>
+
 //! Represents an object that encapsulates memory management strategy. It is used to allocate, deallocate,
 //! construct and destruct objects.
 //!
@@ -187,6 +190,99 @@ public:
 	}
 };
 
+//! Represents an allocator that takes memory from the C run-time heap, which allows it to change the size of
+//! the memory block without moving the objects one by one.
+//!
+//! Containers only use the Reallocate function for objects that are trivially relocatable.
+//!
+//! @tparam ObjectType Type of objects to work with.
+template<typename ObjectType>
+class ReallocatingAllocator : public DefaultAllocator<ObjectType>
+{
+public:
+	typedef typename DefaultAllocator<ObjectType>::value_type value_type;
+	typedef typename DefaultAllocator<ObjectType>::pointer pointer;
+	typedef typename DefaultAllocator<ObjectType>::size_type size_type;
+
+	template<typename OtherObjectType>
+	struct rebind
+	{
+		typedef ReallocatingAllocator<OtherObjectType> other;
+	};
+
+	ReallocatingAllocator() noexcept
+	{
+	}
+	template<typename OtherObjectType>
+	ReallocatingAllocator(const ReallocatingAllocator<OtherObjectType> &) noexcept
+	{
+	}
+
+	//! Allocates enough memory to fit specified number of objects. No object is initialized by this function.
+	//!
+	//! @param count Number of objects to allocate memory for.
+	//!
+	//! @returns A pointer to the first uninitialized object in the allocated memory block.
+	pointer Allocate(size_type count) const
+	{
+		void *memory = malloc(count * sizeof(value_type));
+		if (!memory && count != 0)
+		{
+			throw std::bad_alloc();
+		}
+		return static_cast<pointer>(memory);
+	}
+	//! Allocates enough memory to fit specified number of objects. No object is initialized by this function.
+	//!
+	//! @param count Number of objects to allocate memory for.
+	//! @param hint  Ignored.
+	//!
+	//! @returns A pointer to the first uninitialized object in the allocated memory block.
+	pointer Allocate(size_type count, const void *) const
+	{
+		return this->Allocate(count);
+	}
+	//! Changes the size of the memory block that was previously allocated by this object. Objects in the block
+	//! are copied byte by byte, if the block has to be moved.
+	//!
+	//! @param ptr   A pointer that was previously returned by Allocate or Reallocate function.
+	//! @param count Number of objects the memory block must fit.
+	//!
+	//! @returns A pointer to the first object in the memory block.
+	pointer Reallocate(pointer ptr, size_type count) const
+	{
+		void *memory = realloc(ptr, count * sizeof(value_type));
+		if (!memory && count != 0)
+		{
+			throw std::bad_alloc();
+		}
+		return static_cast<pointer>(memory);
+	}
+	//! Deallocates memory that was previously allocated by this object.
+	//!
+	//! @param ptr A pointer that was previously returned by the call to one of the overloads of Allocate
+	//!            function.
+	void Deallocate(pointer ptr) const
+	{
+		free(ptr);
+	}
+};
+
+//! Indicates whether allocators of type _AllocatorType_ provide the Reallocate function.
+//!
+//! @tparam AllocatorType Type of the allocator to check.
+template<typename AllocatorType>
+struct CanReallocate
+{
+	static constexpr bool value = false;
+};
+//! Specialization that specifies that ReallocatingAllocator`1 can reallocate memory.
+template<typename ObjectType>
+struct CanReallocate<ReallocatingAllocator<ObjectType>>
+{
+	static constexpr bool value = true;
+};
+
 //! Default implementation of the operator that checks equality of 2 allocators. By default all allocators are
 //! equal to each other.
 template<typename FirstType, typename SecondType>
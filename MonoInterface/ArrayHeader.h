@@ -1,11 +1,14 @@
 ﻿#pragma once
 
+#include "AtomicReferenceCount.h"
+
 // Defines types that can be used as headers for various arrays of data.
 
 //! Represents an object that contains information about a reference-counted array of data.
 //!
 //! @tparam DataType           Type of data that is contained in the array.
-//! @tparam ReferenceCountType Type of object that represents a number of live references to the array.
+//! @tparam ReferenceCountType Type of object that represents a number of live references to the array. Use
+//!                            AtomicReferenceCount`1 for arrays that are shared between threads.
 //! @tparam CountType          Type of objects that represent number of objects in the array.
 //! @tparam nullTerminated     Indicates whether this array is terminated by a special 'null' object.
 template<typename DataType, typename ReferenceCountType, typename CountType, bool nullTerminated>
@@ -74,29 +77,48 @@ class RefCountedImmutableArrayHeaderTemplate
 		//! Increases number of live references to the array.
 		void RegisterReference()
 		{
-#ifdef CRYCIL_MODULE
-			CryInterlockedIncrement(&this->referenceCount);
-#else
-			this->referenceCount++;
-#endif // CRYCIL_MODULE
-
+			Increment(this->referenceCount);
 		}
 		//! Decreases number of live references to the array.
 		//!
 		//! @returns Number of references to the array after decrementing the count.
 		int UnregisterReference()
 		{
-#ifdef CRYCIL_MODULE
-			return CryInterlockedDecrement(&this->referenceCount);
-#else
-			return --this->referenceCount;
-#endif // CRYCIL_MODULE
+			return Decrement(this->referenceCount);
 		}
 
 		//! Gets the pointer to the global variable that represents an empty array.
 		//!
 		//! This function can be used with empty objects to avoid using extra memory for them.
 		static RefCountedImmutableArrayHeaderTemplate *EmptyHeader();
+	private:
+		static void Increment(int &count)
+		{
+#ifdef CRYCIL_MODULE
+			CryInterlockedIncrement(&count);
+#else
+			count++;
+#endif // CRYCIL_MODULE
+		}
+		static int Decrement(int &count)
+		{
+#ifdef CRYCIL_MODULE
+			return CryInterlockedDecrement(&count);
+#else
+			return --count;
+#endif // CRYCIL_MODULE
+		}
+		// Reference count types other than int (e.g. AtomicReferenceCount`1) take care of themselves.
+		template<typename OtherCountType>
+		static void Increment(OtherCountType &count)
+		{
+			++count;
+		}
+		template<typename OtherCountType>
+		static int Decrement(OtherCountType &count)
+		{
+			return int(--count);
+		}
 };
 
 //! Represents an empty array.
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+
+//! Represents a reference count that can be safely modified by multiple threads at once.
+//!
+//! This type can be used in place of a plain integer as a reference count type of reference-counted objects
+//! (e.g. Text or List) that are shared between threads. Increments are relaxed, since a new reference can
+//! only be made from an existing one, while decrements use acquire-release ordering to make sure that all
+//! writes made through other references are visible to the thread that releases the object.
+//!
+//! @tparam CountType Type of integer that represents the number of references.
+template<typename CountType>
+class AtomicReferenceCount
+{
+	std::atomic<CountType> count;
+public:
+	//! Creates a new reference count.
+	AtomicReferenceCount(CountType value = 0)
+		: count(value)
+	{
+	}
+	//! Creates a copy of the reference count.
+	AtomicReferenceCount(const AtomicReferenceCount &other)
+		: count(other.count.load(std::memory_order_acquire))
+	{
+	}
+	//! Assigns the value of another reference count to this one.
+	AtomicReferenceCount &operator=(const AtomicReferenceCount &other)
+	{
+		this->count.store(other.count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		return *this;
+	}
+	//! Assigns a new value to this reference count.
+	AtomicReferenceCount &operator=(CountType value)
+	{
+		this->count.store(value, std::memory_order_relaxed);
+		return *this;
+	}
+
+	//! Gets the current number of references.
+	operator CountType() const
+	{
+		return this->count.load(std::memory_order_acquire);
+	}
+
+	//! Increases the number of references.
+	//!
+	//! @returns The number of references after incrementing.
+	CountType operator++()
+	{
+		return this->count.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+	//! Increases the number of references.
+	//!
+	//! @returns The number of references before incrementing.
+	CountType operator++(int)
+	{
+		return this->count.fetch_add(1, std::memory_order_relaxed);
+	}
+	//! Decreases the number of references.
+	//!
+	//! @returns The number of references after decrementing.
+	CountType operator--()
+	{
+		return this->count.fetch_sub(1, std::memory_order_acq_rel) - 1;
+	}
+	//! Decreases the number of references.
+	//!
+	//! @returns The number of references before decrementing.
+	CountType operator--(int)
+	{
+		return this->count.fetch_sub(1, std::memory_order_acq_rel);
+	}
+};
@@ -7,6 +7,9 @@ Text DirectoryStructure::cryCilBinFolder;
 Text DirectoryStructure::cryamblyFile;
 Text DirectoryStructure::pdb2mdbFile;
 Text DirectoryStructure::appDomainConfigFile;
+Text DirectoryStructure::monoExecutableFile;
+Text DirectoryStructure::aotCacheFolder;
+Text DirectoryStructure::startupTraceFile;
 
 const char *DirectoryStructure::GetMonoConfigurationFolder()
 {
@@ -64,4 +67,32 @@ const char *DirectoryStructure::GetMonoAppDomainConfigurationFile()
 										  MONO_CONFIG_FOLDER, "mono", "4.5", "machine.config" }, true);
 	}
 	return appDomainConfigFile;
+}
+//! Returns a path to the Mono executable that is used to compile assemblies ahead-of-time.
+const char *DirectoryStructure::GetMonoExecutableFile()
+{
+	if (monoExecutableFile.Empty)
+	{
+		monoExecutableFile = BuildPath({ MonoEnv->ExePath, MODULES_FOLDER, CRYCIL_FOLDER, MONO_FOLDER,
+										 MONO_BINARIES_FOLDER, MONO_EXECUTABLE_FILE }, true);
+	}
+	return monoExecutableFile;
+}
+//! Returns a path to the folder that contains ahead-of-time compiled images of assemblies.
+const char *DirectoryStructure::GetAotCacheFolder()
+{
+	if (aotCacheFolder.Empty)
+	{
+		aotCacheFolder = BuildPath({ MonoEnv->ExePath, MODULES_FOLDER, CRYCIL_FOLDER, AOT_CACHE_FOLDER }, false);
+	}
+	return aotCacheFolder;
+}
+//! Returns a path to the file where the trace of CryCIL start-up is written.
+const char *DirectoryStructure::GetStartupTraceFile()
+{
+	if (startupTraceFile.Empty)
+	{
+		startupTraceFile = BuildPath({ MonoEnv->ExePath, MODULES_FOLDER, CRYCIL_FOLDER, STARTUP_TRACE_FILE }, true);
+	}
+	return startupTraceFile;
 }
\ No newline at end of file
@@ -11,6 +11,10 @@
 #define MONO_FOLDER             "Mono"
 #define MONO_LIBS_FOLDER        "lib"
 #define MONO_CONFIG_FOLDER      "etc"
+#define MONO_BINARIES_FOLDER    "bin"
+#define MONO_EXECUTABLE_FILE    "mono.exe"
+#define AOT_CACHE_FOLDER        "AotCache"
+#define STARTUP_TRACE_FILE      "StartupTrace.json"
 #define MONO_DEBUG_UTILITY_FILE "pdb2mdb.dll"
 #define CRYAMBLY_FILE           "Cryambly.dll"
 
@@ -40,7 +44,8 @@ inline bool EndsWith(const char *text, const char *postfix)
 
 inline Text BuildPath(std::initializer_list<const char *> parts, bool isFileName)
 {
-	Text path;
+	TextBuilder path;
+	bool endsWithSeparator = false;
 
 	for (auto &p : parts)
 	{
@@ -49,17 +54,23 @@ inline Text BuildPath(std::initializer_list<const char *> parts, bool isFileName
 		{
 			offset = 1;		// Make sure the separator character is not duplicated.
 		}
-		path.Append(p + offset);
-		if (!EndsWith(path, PATH_SEPARATOR))
+		if (p[offset] != '\0')
+		{
+			path.Append(p + offset);
+			endsWithSeparator = EndsWith(p, PATH_SEPARATOR);
+		}
+		if (!endsWithSeparator)
 		{
 			path.Append(PATH_SEPARATOR);
+			endsWithSeparator = true;
 		}
 	}
 
 	if (isFileName)
 	{
-		path.Resize(path.Length - 1);
+		path.Cut();
 	}
+	return path.ToText();
 }
 
 //! Defines functions that return paths to various folders within CryEngine installation.
@@ -72,6 +83,9 @@ private:
 	static Text cryamblyFile;
 	static Text pdb2mdbFile;
 	static Text appDomainConfigFile;
+	static Text monoExecutableFile;
+	static Text aotCacheFolder;
+	static Text startupTraceFile;
 
 public:
 	//! Returns a path to the folder that contains Mono configuration files.
@@ -86,4 +100,10 @@ public:
 	static const char *GetPdb2MdbFile();
 	//! Returns a path to the file that contains configuration data for 4.5 version AppDomains.
 	static const char *GetMonoAppDomainConfigurationFile();
+	//! Returns a path to the Mono executable that is used to compile assemblies ahead-of-time.
+	static const char *GetMonoExecutableFile();
+	//! Returns a path to the folder that contains ahead-of-time compiled images of assemblies.
+	static const char *GetAotCacheFolder();
+	//! Returns a path to the file where the trace of CryCIL start-up is written.
+	static const char *GetStartupTraceFile();
 };
\ No newline at end of file
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include <type_traits>
+
 //! A special type that defines a typedef for _DefineIfTrue_ type, if _indicator_ is true.
 //!
 //! Example:
@@ -26,4 +28,19 @@ struct EnableIf<true, DefineIfTrue>
 {
 	// This is a specialization for the case where indicator is true. The typedef is defined.
 	typedef DefineIfTrue type;
+};
+
+//! Indicates whether objects of type _TypeToCheck_ can be moved to a different place in memory by copying
+//! their bytes, without invoking their move constructors and destructors.
+//!
+//! Containers use this trait to move their elements with memmove and memcpy. Types that are not trivially
+//! copyable but don't keep pointers to themselves or their own parts (e.g. ones that only hold a pointer to
+//! reference-counted data) can specialize this template.
+//!
+//! @tparam TypeToCheck A type to check.
+template<typename TypeToCheck>
+struct IsTriviallyRelocatable
+{
+	//! Indicates whether _TypeToCheck_ is trivially relocatable.
+	static constexpr bool value = std::is_trivially_copyable<TypeToCheck>::value;
 };
\ No newline at end of file
@@ -0,0 +1,318 @@
+#pragma once
+
+#include <mutex>
+
+//! Represents a region of memory that serves all allocations that are made while a single CSG operation
+//! is performed.
+//!
+//! Memory is taken from the heap in big blocks and is handed out sequentially. Memory that is given back
+//! (e.g. when a list grows or a temporary list is destroyed) is kept in free lists of chunks of the same
+//! size and is reused by later allocations. Nothing is returned to the heap until the arena is destroyed,
+//! so the whole BSP tree is released in one step.
+//!
+//! Every thread works with its own lane of the arena, so allocations don't need any synchronization.
+//! The thread that has created the arena uses the main lane, other threads must create a ThreadScope
+//! object before working with the arena.
+class BspArena
+{
+	//! Header of the block of memory that was taken from the heap.
+	struct Block
+	{
+		Block *Next;
+		size_t Size;
+	};
+	//! Header that precedes every chunk of memory that is handed out by the arena.
+	struct Chunk
+	{
+		Chunk *NextFree;
+		size_t SizeClass;
+	};
+
+	//! Smallest number of bytes that can be handed out. Size of every chunk is this number multiplied by
+	//! a power of 2.
+	static const size_t MinChunkSize = 32;
+	static const int SizeClassCount = 32;
+	//! Default size of the block of memory that is taken from the heap.
+	static const size_t DefaultBlockSize = 256 * 1024;
+
+	//! Represents a part of the arena that is used by one thread at a time.
+	struct Lane
+	{
+		BspArena *Arena;
+		Lane *Next;				//!< Next lane in the list of all lanes of the arena.
+		Lane *NextIdle;			//!< Next lane in the list of lanes that are not used by any thread.
+		char *Current;
+		char *End;
+		Chunk *FreeChunks[SizeClassCount];
+		size_t AllocationCount;
+
+		explicit Lane(BspArena *arena)
+			: Arena(arena)
+			, Next(nullptr)
+			, NextIdle(nullptr)
+			, Current(nullptr)
+			, End(nullptr)
+			, AllocationCount(0)
+		{
+			memset(this->FreeChunks, 0, sizeof(this->FreeChunks));
+		}
+	};
+
+	std::mutex lock;			//!< Guards the list of blocks and the lists of lanes.
+	Block *blocks;
+	Lane mainLane;
+	Lane *idleLanes;
+	size_t reservedBytes;
+public:
+	//! Makes the calling thread use a separate lane of the arena while this object is alive.
+	class ThreadScope
+	{
+		BspArena *arena;
+		Lane *lane;
+		Lane *previousLane;
+	public:
+		//! @param arena Arena to use, if null, nothing is done.
+		explicit ThreadScope(BspArena *arena)
+			: arena(arena)
+			, lane(nullptr)
+			, previousLane(CurrentLane())
+		{
+			if (arena)
+			{
+				this->lane = arena->AcquireLane();
+				CurrentLane() = this->lane;
+			}
+		}
+		~ThreadScope()
+		{
+			if (this->arena)
+			{
+				CurrentLane() = this->previousLane;
+				this->arena->ReleaseLane(this->lane);
+			}
+		}
+	private:
+		ThreadScope(const ThreadScope &);
+		ThreadScope &operator =(const ThreadScope &);
+	};
+
+	BspArena()
+		: blocks(nullptr)
+		, mainLane(this)
+		, idleLanes(nullptr)
+		, reservedBytes(0)
+	{
+	}
+	~BspArena()
+	{
+		// Lanes are allocated from the blocks.
+		Block *block = this->blocks;
+		while (block)
+		{
+			Block *next = block->Next;
+			::operator delete(block);
+			block = next;
+		}
+	}
+
+	//! Allocates a chunk of memory that is aligned on the boundary of pointer size.
+	//!
+	//! @param size Number of bytes to allocate.
+	void *Allocate(size_t size)
+	{
+		size_t sizeClass = 0;
+		while ((MinChunkSize << sizeClass) < size)
+		{
+			sizeClass++;
+		}
+
+		Lane *lane = this->GetLane();
+		lane->AllocationCount++;
+
+		Chunk *chunk = lane->FreeChunks[sizeClass];
+		if (chunk)
+		{
+			lane->FreeChunks[sizeClass] = chunk->NextFree;
+			return chunk + 1;
+		}
+
+		size_t chunkSize = sizeof(Chunk) + (MinChunkSize << sizeClass);
+		if (size_t(lane->End - lane->Current) < chunkSize)
+		{
+			this->AddBlock(lane, chunkSize);
+		}
+		chunk = reinterpret_cast<Chunk *>(lane->Current);
+		chunk->SizeClass = sizeClass;
+		lane->Current += chunkSize;
+		return chunk + 1;
+	}
+	//! Gives the chunk of memory back to the arena, so it can be reused by next allocations.
+	//!
+	//! The chunk can be given back by any thread, not necessarily by the one that has allocated it.
+	//!
+	//! @param ptr Pointer that was returned by Allocate.
+	void Release(void *ptr)
+	{
+		if (!ptr)
+		{
+			return;
+		}
+
+		Lane *lane = this->GetLane();
+		Chunk *chunk = static_cast<Chunk *>(ptr) - 1;
+		chunk->NextFree = lane->FreeChunks[chunk->SizeClass];
+		lane->FreeChunks[chunk->SizeClass] = chunk;
+	}
+
+	//! Gets number of bytes that were taken from the heap.
+	size_t GetReservedBytes()
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+		return this->reservedBytes;
+	}
+	//! Gets number of allocations that were served by this arena.
+	//!
+	//! Must not be called while other threads work with the arena.
+	size_t GetAllocationCount() const
+	{
+		size_t count = 0;
+		for (const Lane *lane = &this->mainLane; lane; lane = lane->Next)
+		{
+			count += lane->AllocationCount;
+		}
+		return count;
+	}
+private:
+	//! Gets the lane the calling thread is using at the moment.
+	static Lane *&CurrentLane()
+	{
+		static thread_local Lane *lane = nullptr;
+		return lane;
+	}
+	Lane *GetLane()
+	{
+		Lane *lane = CurrentLane();
+		return lane && lane->Arena == this ? lane : &this->mainLane;
+	}
+	Lane *AcquireLane()
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+
+		Lane *lane = this->idleLanes;
+		if (lane)
+		{
+			this->idleLanes = lane->NextIdle;
+			return lane;
+		}
+
+		// Lanes are not released until the arena is destroyed, so they can be allocated from the blocks.
+		Block *block = this->CreateBlock(sizeof(Lane));
+		lane = new(block + 1) Lane(this);
+		lane->Next = this->mainLane.Next;
+		this->mainLane.Next = lane;
+		return lane;
+	}
+	void ReleaseLane(Lane *lane)
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+
+		lane->NextIdle = this->idleLanes;
+		this->idleLanes = lane;
+	}
+	void AddBlock(Lane *lane, size_t chunkSize)
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+
+		size_t size = DefaultBlockSize;
+		if (chunkSize > DefaultBlockSize)
+		{
+			size = chunkSize;
+		}
+		Block *block = this->CreateBlock(size);
+
+		lane->Current = reinterpret_cast<char *>(block + 1);
+		lane->End = lane->Current + size;
+	}
+	Block *CreateBlock(size_t size)
+	{
+		size += sizeof(Block);
+		Block *block = static_cast<Block *>(::operator new(size));
+		block->Next = this->blocks;
+		block->Size = size;
+		this->blocks = block;
+		this->reservedBytes += size;
+		return block;
+	}
+};
+
+//! Represents an allocator that takes memory from the BSP arena, or from the heap, if there is no arena.
+//!
+//! @tparam ObjectType Type of objects to work with.
+template<typename ObjectType>
+class BspAllocator : public DefaultAllocator<ObjectType>
+{
+	BspArena *arena;
+public:
+	typedef typename DefaultAllocator<ObjectType>::value_type value_type;
+	typedef typename DefaultAllocator<ObjectType>::pointer pointer;
+	typedef typename DefaultAllocator<ObjectType>::size_type size_type;
+
+	template<typename OtherObjectType>
+	struct rebind
+	{
+		typedef BspAllocator<OtherObjectType> other;
+	};
+
+	explicit BspAllocator(BspArena *arena = nullptr) noexcept
+		: arena(arena)
+	{
+	}
+	template<typename OtherObjectType>
+	BspAllocator(const BspAllocator<OtherObjectType> &other) noexcept
+		: arena(other.GetArena())
+	{
+	}
+
+	//! Gets the arena this allocator takes memory from.
+	BspArena *GetArena() const
+	{
+		return this->arena;
+	}
+
+	//! Allocates enough memory to fit specified number of objects. No object is initialized by this function.
+	//!
+	//! @param count Number of objects to allocate memory for.
+	//!
+	//! @returns A pointer to the first uninitialized object in the allocated memory block.
+	pointer Allocate(size_type count) const
+	{
+		if (!this->arena)
+		{
+			return DefaultAllocator<ObjectType>::Allocate(count);
+		}
+		return static_cast<pointer>(this->arena->Allocate(count * sizeof(value_type)));
+	}
+	//! Allocates enough memory to fit specified number of objects. No object is initialized by this function.
+	//!
+	//! @param count Number of objects to allocate memory for.
+	//! @param hint  Ignored.
+	//!
+	//! @returns A pointer to the first uninitialized object in the allocated memory block.
+	pointer Allocate(size_type count, const void *) const
+	{
+		return this->Allocate(count);
+	}
+	//! Deallocates memory that was previously allocated by this object.
+	//!
+	//! @param ptr A pointer that was previously returned by the call to one of the overloads of Allocate
+	//!            function.
+	void Deallocate(pointer ptr) const
+	{
+		if (!this->arena)
+		{
+			DefaultAllocator<ObjectType>::Deallocate(ptr);
+			return;
+		}
+		this->arena->Release(ptr);
+	}
+};
@@ -1,20 +1,67 @@
 #include "stdafx.h"
 
 #include "BspNode.h"
+#include "Interops/BatchOps.Parallel.h"
 
-void PointPosition(Plane plane, Vec3 point, PlanePosition &pointPlanePosition,
-				   PlanePosition &polygonPlanePosition)
+//! Maximal distance between the point and the plane that makes the point lie on the plane. It has to be much
+//! bigger then the rounding error of the distance, otherwise faces are not coplanar with their own planes.
+const float PlaneThickness = 0.00001f;
+//! Maximal number of faces which planes are scored, when the plane of the node is chosen.
+const int SplitterCandidateCount = 16;
+//! Maximal number of faces that are tested against every candidate plane.
+const int SplitterTestCount = 128;
+//! Number of faces that have to end up on one side of the plane to make it as bad as one split face.
+const int SplitterSplitCost = 8;
+
+//! Represents a subtree which building was postponed, so it can be built in parallel with others.
+struct BspBuildTask
+{
+	BspNode *Node;				//!< Root of the subtree.
+	FaceList Faces;				//!< Faces to add to the subtree.
+
+	BspBuildTask(BspNode *node, const FaceList &faces)
+		: Node(node)
+		, Faces(faces)
+	{
+	}
+};
+
+//! Represents a set of nodes which faces are cut by another tree in parallel.
+struct BspClipBatch
+{
+	BspNode **Nodes;
+	const BspNode *Clipper;
+};
+
+//! Gets the number of top levels of the tree that are built before the building is split between threads.
+int GetParallelLevels(const BspParallelism &parallelism)
+{
+	// Allow up to 4 subtrees per thread, so threads that get simple ones can take more.
+	int levels = 2;
+	for (int count = 1; count < parallelism.ThreadCount; count *= 2)
+	{
+		levels++;
+	}
+	return levels;
+}
+
+float PointPosition(const Plane &plane, const Vec3 &point, PlanePosition &pointPlanePosition,
+					PlanePosition &polygonPlanePosition)
 {
-	float signedDistance = point * plane.n - plane.d;
-	if (signedDistance > 0.00000001)
+	float signedDistance = plane.DistFromPlane(point);
+	if (signedDistance > PlaneThickness)
 	{
 		pointPlanePosition = PlanePosition::Front;
 	}
-	pointPlanePosition = signedDistance < -0.00000001 ? PlanePosition::Back : PlanePosition::Coplanar;
+	else
+	{
+		pointPlanePosition = signedDistance < -PlaneThickness ? PlanePosition::Back : PlanePosition::Coplanar;
+	}
 	polygonPlanePosition = PlanePosition(polygonPlanePosition | pointPlanePosition);
+	return signedDistance;
 }
 
-Vertex Vertex::CreateLerp(Vertex &other, float parameter) const
+Vertex Vertex::CreateLerp(const Vertex &other, float parameter) const
 {
 	Vertex vertex;
 	vertex.Position = Vec3::CreateLerp(this->Position, other.Position, parameter);
@@ -25,49 +72,147 @@ Vertex Vertex::CreateLerp(Vertex &other, float parameter) const
 	return vertex;
 }
 
-Plane Face::GetPlane() const
+//! Determines whether the first point goes before the second when points are ordered by coordinates.
+bool PrecedesPoint(const Vec3 &first, const Vec3 &second)
+{
+	if (first.x != second.x) return first.x < second.x;
+	if (first.y != second.y) return first.y < second.y;
+	return first.z < second.z;
+}
+
+BspVertexPool::BspVertexPool()
+	: count(0)
+	, overflowed(false)
+{
+	for (int i = 0; i < MaxChunkCount; i++)
+	{
+		this->chunks[i].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+BspVertexPool::~BspVertexPool()
+{
+	for (int i = 0; i < MaxChunkCount; i++)
+	{
+		Vertex *chunk = this->chunks[i].load(std::memory_order_relaxed);
+		if (!chunk)
+		{
+			break;
+		}
+		::operator delete(chunk);
+	}
+}
+
+int BspVertexPool::Add(const Vertex &vertex)
+{
+	// Once the pool is full the counter is left alone, so it cannot overflow however many splits follow.
+	if (this->count.load(std::memory_order_relaxed) >= Capacity)
+	{
+		this->overflowed.store(true, std::memory_order_relaxed);
+		return 0;
+	}
+
+	int index = this->count.fetch_add(1);
+	if (index >= Capacity)
+	{
+		this->overflowed.store(true, std::memory_order_relaxed);
+		return 0;
+	}
+	this->GetChunk(index >> ChunkShift)[index & (ChunkSize - 1)] = vertex;
+	return index;
+}
+
+int BspVertexPool::AddRange(const Vertex *vertices, int vertexCount)
+{
+	if (vertexCount > Capacity - this->count.load(std::memory_order_relaxed))
+	{
+		this->overflowed.store(true, std::memory_order_relaxed);
+		return 0;
+	}
+
+	int firstIndex = this->count.fetch_add(vertexCount);
+	if (vertexCount > Capacity - firstIndex)
+	{
+		this->overflowed.store(true, std::memory_order_relaxed);
+		return 0;
+	}
+	for (int i = 0; i < vertexCount; i++)
+	{
+		int index = firstIndex + i;
+		this->GetChunk(index >> ChunkShift)[index & (ChunkSize - 1)] = vertices[i];
+	}
+	return firstIndex;
+}
+
+Vertex *BspVertexPool::GetChunk(int chunkIndex)
+{
+	Vertex *chunk = this->chunks[chunkIndex].load(std::memory_order_acquire);
+	if (chunk)
+	{
+		return chunk;
+	}
+
+	std::lock_guard<std::mutex> guard(this->lock);
+
+	// Chunks are allocated in order, since indices are handed out in order.
+	for (int i = 0; i <= chunkIndex; i++)
+	{
+		if (!this->chunks[i].load(std::memory_order_relaxed))
+		{
+			this->chunks[i].store(static_cast<Vertex *>(::operator new(ChunkSize * sizeof(Vertex))),
+								  std::memory_order_release);
+		}
+	}
+	return this->chunks[chunkIndex].load(std::memory_order_relaxed);
+}
+
+Plane IndexedFace::GetPlane(const BspVertexPool &vertices) const
 {
+	const Vec3 &position0 = vertices[this->Indices[0]].Position;
 	Vec3 normal =
-		(this->Vertices[1].Position - this->Vertices[0].Position)
+		(vertices[this->Indices[1]].Position - position0)
 		%
-		(this->Vertices[2].Position - this->Vertices[0].Position);
+		(vertices[this->Indices[2]].Position - position0);
 	normal.NormalizeSafe();
 
-	float distance = -(normal * this->Vertices[0].Position);
+	float distance = -(normal * position0);
 	return Plane(normal, distance);
 }
 
-Vec3 Face::GetNormal() const
+Vec3 IndexedFace::GetNormal(const BspVertexPool &vertices) const
 {
+	const Vec3 &position0 = vertices[this->Indices[0]].Position;
 	Vec3 normal =
-		(this->Vertices[1].Position - this->Vertices[0].Position)
+		(vertices[this->Indices[1]].Position - position0)
 		%
-		(this->Vertices[2].Position - this->Vertices[0].Position);
+		(vertices[this->Indices[2]].Position - position0);
 	normal.NormalizeSafe();
 	return normal;
 }
 
-void Face::Invert()
+void IndexedFace::Invert()
 {
-	Vertex temp = this->Vertices[0];
-	this->Vertices[0] = this->Vertices[2];
-	this->Vertices[2] = temp;
+	int temp = this->Indices[0];
+	this->Indices[0] = this->Indices[2];
+	this->Indices[2] = temp;
 }
 
-void Face::Split(Plane splitter, List<Face> *frontCoplanarFaces, List<Face> *backCoplanarFaces, List<Face> *frontFaces, List<Face> *backFaces) const
+PlanePosition IndexedFace::Split(BspVertexPool &vertices, Plane splitter, FaceList *frontCoplanarFaces,
+								 FaceList *backCoplanarFaces, FaceList *frontFaces, FaceList *backFaces) const
 {
 	PlanePosition triangleType = PlanePosition::Coplanar;
 	PlanePosition positions[3];
+	float distances[3];
 	// Determine position of the triangle relative to the plane.
-	PointPosition(splitter, this->Vertices[0].Position, positions[0], triangleType);
-	PointPosition(splitter, this->Vertices[1].Position, positions[1], triangleType);
-	PointPosition(splitter, this->Vertices[2].Position, positions[2], triangleType);
+	distances[0] = PointPosition(splitter, vertices[this->Indices[0]].Position, positions[0], triangleType);
+	distances[1] = PointPosition(splitter, vertices[this->Indices[1]].Position, positions[1], triangleType);
+	distances[2] = PointPosition(splitter, vertices[this->Indices[2]].Position, positions[2], triangleType);
 	// Process this triangle's data based on its position.
 	switch (triangleType)
 	{
 	case PlanePosition::Coplanar:
 		// See where this triangle is looking and it to corresponding list.
-		if (this->GetNormal() * splitter.n > 0)
+		if (this->GetNormal(vertices) * splitter.n > 0)
 		{
 			if (frontCoplanarFaces) frontCoplanarFaces->Add(*this);
 		}
@@ -86,15 +231,14 @@ void Face::Split(Plane splitter, List<Face> *frontCoplanarFaces, List<Face> *bac
 	{
 		if (!(frontFaces || backFaces))
 		{
-			return;				// Any calculations won't be saved anywhere.
+			return triangleType;	// Any calculations won't be saved anywhere.
 		}
-		// Prepare to create a split of this triangle.
-		//
-		// Cash vertices into an array, so we can loop through it.
-		Vertex *vertices = const_cast<Vertex *>(this->Vertices);
-		// Create lists for vertices on the front and back.
-		List<Vertex> fvs(4);
-		List<Vertex> bvs(4);
+		// Create arrays for vertices on the front and back. A plane can cut a triangle into a triangle and
+		// a quadrilateral at most, so 4 vertices per side are enough.
+		int fvs[4];
+		int bvs[4];
+		int frontCount = 0;
+		int backCount = 0;
 		// Process edges.
 		//
 		// We go through the polygon edge by edge with i being index of the
@@ -105,127 +249,271 @@ void Face::Split(Plane splitter, List<Face> *frontCoplanarFaces, List<Face> *bac
 			// front vertices.
 			if (positions[i] != PlanePosition::Back)
 			{
-				fvs.Add(vertices[i]);
+				fvs[frontCount++] = this->Indices[i];
 			}
-			// Else put the starting vertex to the back vertices.
-			else
+			// If edge doesn't begin in front of the plane, add starting vertex to
+			// back vertices. Vertices that lie on the plane are added to both lists.
+			if (positions[i] != PlanePosition::Front)
 			{
-				bvs.Add(vertices[i]);
+				bvs[backCount++] = this->Indices[i];
 			}
 			// If this edge intersects the plane, split it.
 			if ((positions[i] | positions[j]) == PlanePosition::Spanning)
 			{
+				// The edge is always interpolated in the same direction, so faces that share it get
+				// identical splitting vertices that are merged when the mesh is welded.
+				int start = i;
+				int end = j;
+				const Vertex &startVertex = vertices[this->Indices[i]];
+				const Vertex &endVertex = vertices[this->Indices[j]];
+				if (PrecedesPoint(endVertex.Position, startVertex.Position))
+				{
+					start = j;
+					end = i;
+				}
 				// Calculate fraction that describes position of splitting
 				// vertex along the line between start and end of the edge.
-				float positionParameter =
-					(splitter.d - splitter.n * vertices[i].Position)
-					/
-					(splitter.n * (vertices[j].Position - vertices[i].Position));
+				float positionParameter = distances[start] / (distances[start] - distances[end]);
 				// Linearly interpolate the vertex that splits the edge.
-				Vertex splittingVertex = vertices[i].CreateLerp(vertices[j], positionParameter);
+				Vertex splittingVertex = vertices[this->Indices[start]].CreateLerp(vertices[this->Indices[end]],
+																				   positionParameter);
+				int splittingIndex = vertices.Add(splittingVertex);
 				// Add splitting vertex to both lists.
-				fvs.Add(splittingVertex);
-				bvs.Add(splittingVertex);
+				fvs[frontCount++] = splittingIndex;
+				bvs[backCount++] = splittingIndex;
 			}
-			// Create front and back triangle(s) from vertices from
-			// corresponding lists.
-			if (frontFaces) Face::TriangulateLinearly(fvs, frontFaces, this->SubsetIndex);
-			if (backFaces) Face::TriangulateLinearly(bvs, backFaces, this->SubsetIndex);
 		}
+		// Create front and back triangle(s) from vertices from
+		// corresponding lists.
+		if (frontFaces) IndexedFace::TriangulateLinearly(fvs, frontCount, frontFaces, this->SubsetIndex);
+		if (backFaces) IndexedFace::TriangulateLinearly(bvs, backCount, backFaces, this->SubsetIndex);
 		break;
 	}
 	default:
 		break;
 	}
+	return triangleType;
 }
 
-void Face::TriangulateLinearly(List<Vertex> &vertices, List<Face> *faceCollection, int subsetIndex)
+PlanePosition IndexedFace::Classify(const BspVertexPool &vertices, const Plane &plane) const
 {
-	if (vertices.Length < 3)
-	{
-		return;
-	}
-	if (vertices.Length == 3)
+	PlanePosition triangleType = PlanePosition::Coplanar;
+	PlanePosition position;
+	PointPosition(plane, vertices[this->Indices[0]].Position, position, triangleType);
+	PointPosition(plane, vertices[this->Indices[1]].Position, position, triangleType);
+	PointPosition(plane, vertices[this->Indices[2]].Position, position, triangleType);
+	return triangleType;
+}
+
+void IndexedFace::TriangulateLinearly(const int *indices, int indexCount, FaceList *faceCollection,
+									  int subsetIndex)
+{
+	if (indexCount < 3)
 	{
-		faceCollection->Add(Face(vertices, subsetIndex));
 		return;
 	}
-	int triangleCount = vertices.Length - 2;
+	int triangleCount = indexCount - 2;
 	for (int i = 0; i < triangleCount; i++)
 	{
-		faceCollection->Add(Face(vertices[0], vertices[i + 1], vertices[i + 2], subsetIndex));
+		faceCollection->Add(IndexedFace(indices[0], indices[i + 1], indices[i + 2], subsetIndex));
 	}
 }
 
-List<Face> *BspNode::AllFaces() const
+void BspNode::AllFaces(FaceList &faces) const
 {
-	List<Face> *list = new List<Face>(this->Faces->Capacity * 2);
-	list->AddRange(*this->Faces);
+	faces.AddRange(this->Faces);
 	if (this->Front)
 	{
-		List<Face> *fronts = this->Front->AllFaces();
-		list->AddRange(*fronts);
-		delete fronts;
+		this->Front->AllFaces(faces);
 	}
 	if (this->Back)
 	{
-		List<Face> *backs = this->Back->AllFaces();
-		list->AddRange(*backs);
-		delete backs;
+		this->Back->AllFaces(faces);
+	}
+}
+
+void BspNode::AddFaces(const FaceList &faces)
+{
+	if (faces.Length == 0)
+	{
+		return;
+	}
+	// Split elements into appropriate groups.
+	BspAllocator<IndexedFace> allocator(this->GetArena());
+	FaceList frontalElements(allocator);
+	FaceList backElements(allocator);
+	this->SplitFaces(faces, frontalElements, backElements);
+	// Assign front and back branches.
+	BspNode *t = this->Front;
+	AssignBranch(t, frontalElements);
+	this->Front = t;
+	t = this->Back;
+	AssignBranch(t, backElements);
+	this->Back = t;
+}
+
+void BspNode::AddFaces(const FaceList &faces, const BspParallelism &parallelism)
+{
+	if (!parallelism.Enabled(faces.Length))
+	{
+		this->AddFaces(faces);
+		return;
 	}
-	return list;
+
+	List<BspBuildTask> tasks;
+	this->AddFaces(faces, tasks, parallelism.Threshold, GetParallelLevels(parallelism));
+	BuildSubtrees(tasks, parallelism);
+}
+
+void BspNode::AddFaces(BspNode &node1, const FaceList &faces1, BspNode &node2, const FaceList &faces2,
+					   const BspParallelism &parallelism)
+{
+	if (!parallelism.Enabled(faces1.Length + faces2.Length))
+	{
+		node1.AddFaces(faces1);
+		node2.AddFaces(faces2);
+		return;
+	}
+
+	List<BspBuildTask> tasks;
+	int levels = GetParallelLevels(parallelism);
+	node1.AddFaces(faces1, tasks, parallelism.Threshold, levels);
+	node2.AddFaces(faces2, tasks, parallelism.Threshold, levels);
+	BuildSubtrees(tasks, parallelism);
 }
 
-void BspNode::AddFaces(const List<Face> &faces)
+void BspNode::AddFaces(const FaceList &faces, List<BspBuildTask> &tasks, int threshold, int levels)
 {
 	if (faces.Length == 0)
 	{
 		return;
 	}
-	// Initialize a plane by picking first element's plane without too much
-	// heuristics.
+	if (faces.Length < threshold || levels == 0)
+	{
+		tasks.Add(BspBuildTask(this, faces));
+		return;
+	}
+	// This node is split exactly like AddFaces(const FaceList &) does it, so the tree is the same.
+	BspAllocator<IndexedFace> allocator(this->GetArena());
+	FaceList frontalElements(allocator);
+	FaceList backElements(allocator);
+	this->SplitFaces(faces, frontalElements, backElements);
+
+	if (frontalElements.Length > 0)
+	{
+		if (!this->Front) this->Front = this->CreateBranch();
+		this->Front->AddFaces(frontalElements, tasks, threshold, levels - 1);
+	}
+	if (backElements.Length > 0)
+	{
+		if (!this->Back) this->Back = this->CreateBranch();
+		this->Back->AddFaces(backElements, tasks, threshold, levels - 1);
+	}
+}
+
+void BspNode::SplitFaces(const FaceList &faces, FaceList &frontalElements, FaceList &backElements)
+{
+	int splitter = -1;
 	if (!NumberValid(this->Plane.d))
 	{
-		this->Plane = faces[0].GetPlane();
+		splitter = this->SelectSplitter(faces);
+		this->Plane = faces[splitter].GetPlane(*this->Vertices);
+		// The face that defines the plane is assigned to this node directly, since rounding errors can
+		// make it look like it spans its own plane, and splitting it will never end.
+		this->Faces.Add(faces[splitter]);
 	}
-	// Split elements into appropriate groups.
-	List<Face> *frontalElements = new List<Face>();
-	List<Face> *backElements = new List<Face>();
 	for (int i = 0; i < faces.Length; i++)
 	{
-		faces[0].Split
+		if (i == splitter)
+		{
+			continue;
+		}
+		PlanePosition position = faces[i].Split
 		(
+			*this->Vertices,
 			this->Plane,
-			this->Faces,			// Coplanars are assigned to this node.
-			this->Faces,			//
-			frontalElements,		// This will go into front branch.
-			backElements			// This will go into back branch.
+			&this->Faces,			// Coplanars are assigned to this node.
+			&this->Faces,			//
+			&frontalElements,		// This will go into front branch.
+			&backElements			// This will go into back branch.
 		);
+		if (position == PlanePosition::Spanning)
+		{
+			this->SplitCount++;
+		}
 	}
-	// Assign front and back branches.
-	BspNode *t = this->Front;
-	AssignBranch(t, frontalElements);
-	this->Front = t;
-	t = this->Back;
-	AssignBranch(t, backElements);
-	this->Back = t;
+}
+
+int BspNode::SelectSplitter(const FaceList &faces) const
+{
+	int faceCount = int(faces.Length);
+	if (this->SplitterSelection == BspSplitterFirstFace || faceCount < 3)
+	{
+		return 0;
+	}
+
+	// Candidates and tested faces are picked evenly from the list, so the choice only depends on the faces,
+	// and the tree is the same, no matter which thread builds it.
+	int candidateCount = faceCount < SplitterCandidateCount ? faceCount : SplitterCandidateCount;
+	int testCount = faceCount < SplitterTestCount ? faceCount : SplitterTestCount;
 
-	delete frontalElements;
-	delete backElements;
+	int bestCandidate = 0;
+	int bestScore = INT_MAX;
+	for (int i = 0; i < candidateCount; i++)
+	{
+		int candidate = int(__int64(i) * faceCount / candidateCount);
+		::Plane plane = faces[candidate].GetPlane(*this->Vertices);
+		if (plane.n * plane.n < 0.5f)
+		{
+			continue;				// Degenerate faces don't define planes.
+		}
+
+		int frontCount = 0;
+		int backCount = 0;
+		int splitCount = 0;
+		for (int j = 0; j < testCount; j++)
+		{
+			switch (faces[int(__int64(j) * faceCount / testCount)].Classify(*this->Vertices, plane))
+			{
+			case PlanePosition::Front:
+				frontCount++;
+				break;
+			case PlanePosition::Back:
+				backCount++;
+				break;
+			case PlanePosition::Spanning:
+				frontCount++;
+				backCount++;
+				splitCount++;
+				break;
+			default:
+				break;
+			}
+		}
+
+		int score = splitCount * SplitterSplitCost + abs(frontCount - backCount);
+		if (score < bestScore)
+		{
+			bestScore = score;
+			bestCandidate = candidate;
+			if (score == 0)
+			{
+				break;
+			}
+		}
+	}
+	return bestCandidate;
 }
 
 void BspNode::Invert()
 {
 	if (NumberValid(this->Plane.d))
 	{
-		-this->Plane;
+		this->Plane = -this->Plane;
 	}
-	if (this->Faces && this->Faces->Length > 0)
+	for (int i = 0; i < this->Faces.Length; i++)
 	{
-		for (int i = 0; i < this->Faces->Length; i++)
-		{
-			(*this->Faces)[i].Invert();
-		}
+		this->Faces[i].Invert();
 	}
 	if (this->Front)
 	{
@@ -240,48 +528,72 @@ void BspNode::Invert()
 	this->Back = temp;
 }
 
-List<Face> *BspNode::FilterList(List<Face> *faces) const
+FaceList BspNode::FilterList(const FaceList &faces) const
 {
+	BspAllocator<IndexedFace> allocator(this->GetArena());
+	// Prepare the lists.
+	FaceList fronts(allocator);
 	if (!NumberValid(this->Plane.d))
 	{
-		return new List<Face>(*faces);
+		fronts.AddRange(faces);
+		return fronts;
 	}
-	// Prepare the lists.
-	List<Face> *fronts = new List<Face>();
-	List<Face> *backs = new List<Face>();
+	FaceList backs(allocator);
 	// Cut elements and separate them into 2 lists.
-	for (int i = 0; i < faces->Length; i++)
+	for (int i = 0; i < faces.Length; i++)
 	{
-		(*faces)[i].Split(this->Plane, fronts, backs, fronts, backs);
+		faces[i].Split(*this->Vertices, this->Plane, &fronts, &backs, &fronts, &backs);
 	}
 
 	if (this->Front)
 	{
-		List<Face> *temp = fronts;
-		fronts = this->Front->FilterList(temp);
-		delete temp;
+		FaceList filtered = this->Front->FilterList(fronts);
+		fronts = filtered;
 	}
 	// If this node has nothing behind it in the tree, then whatever is behind it
 	// in the list should be discarded.
 	if (this->Back)
 	{
-		fronts->AddRange(*this->Back->FilterList(backs));
+		fronts.AddRange(this->Back->FilterList(backs));
 	}
-	
-	delete backs;
 
 	return fronts;
 }
 
 void BspNode::CutTreeOut(const BspNode &node)
 {
-	List<Face> *temp = this->Faces;
-	this->Faces = node.FilterList(this->Faces);
-	delete temp;
+	FaceList filtered = node.FilterList(this->Faces);
+	this->Faces = filtered;
 	if (this->Front) this->Front->CutTreeOut(node);
 	if (this->Back) this->Back->CutTreeOut(node);
 }
 
+void BspNode::CutTreeOut(const BspNode &node, const BspParallelism &parallelism)
+{
+	if (!parallelism.Available())
+	{
+		this->CutTreeOut(node);
+		return;
+	}
+
+	// Faces of every node are cut independently, so the nodes can be processed in any order.
+	List<BspNode *> nodes;
+	__int64 faceCount = 0;
+	this->CollectNodes(nodes, faceCount);
+	if (!parallelism.Enabled(faceCount))
+	{
+		this->CutTreeOut(node);
+		return;
+	}
+
+	BspClipBatch batch;
+	batch.Nodes = nodes.First();
+	batch.Clipper = &node;
+	// Small chunks are used, since the number of faces in the node varies a lot.
+	__int64 chunkLength = nodes.Length / (__int64(parallelism.ThreadCount) * 16) + 1;
+	parallelism.Workers->Run(ProcessClippedNodes, &batch, nodes.Length, chunkLength, parallelism.ThreadCount);
+}
+
 void BspNode::Unite(BspNode *node)
 {
 	// Cut overlapping geometry.
@@ -292,22 +604,121 @@ void BspNode::Unite(BspNode *node)
 	node->CutTreeOut(*this);
 	node->Invert();
 	// Combine geometry.
-	this->AddFaces(*node->AllFaces());
+	BspAllocator<IndexedFace> allocator(this->GetArena());
+	FaceList faces(allocator);
+	node->AllFaces(faces);
+	this->AddFaces(faces);
 }
 
-void BspNode::AssignBranch(BspNode *&branch, List<Face> *faces) const
+void BspNode::Unite(BspNode *node, const BspParallelism &parallelism)
 {
+	// Same as Unite(BspNode *) but every step is split between threads.
+	this->CutTreeOut(*node, parallelism);
+	node->CutTreeOut(*this, parallelism);
+	node->Invert();
+	node->CutTreeOut(*this, parallelism);
+	node->Invert();
+	BspAllocator<IndexedFace> allocator(this->GetArena());
+	FaceList faces(allocator);
+	node->AllFaces(faces);
+	this->AddFaces(faces, parallelism);
+}
+
+void BspNode::AssignBranch(BspNode *&branch, const FaceList &faces) const
+{
+	if (faces.Length == 0)
+	{
+		return;
+	}
 	if (!branch)
 	{
-		branch = new BspNode();
+		branch = this->CreateBranch();
+	}
+	branch->AddFaces(faces);
+}
+
+BspNode *BspNode::CreateBranch() const
+{
+	BspArena *arena = this->GetArena();
+	if (!arena)
+	{
+		return new BspNode(this->Vertices, nullptr, this->SplitterSelection);
+	}
+
+	BspAllocator<BspNode> allocator(arena);
+	BspNode *branch = allocator.Allocate(1);
+	allocator.Initialize(branch, this->Vertices, arena, this->SplitterSelection);
+	return branch;
+}
+
+void BspNode::CollectNodes(List<BspNode *> &nodes, __int64 &faceCount)
+{
+	nodes.Add(this);
+	faceCount += this->Faces.Length;
+	if (this->Front) this->Front->CollectNodes(nodes, faceCount);
+	if (this->Back) this->Back->CollectNodes(nodes, faceCount);
+}
+
+void BspNode::GatherStatistics(BspStatistics &statistics) const
+{
+	this->GatherStatistics(statistics, 1);
+}
+
+void BspNode::GatherStatistics(BspStatistics &statistics, int depth) const
+{
+	statistics.NodeCount++;
+	statistics.FaceCount += int(this->Faces.Length);
+	statistics.SplitCount += this->SplitCount;
+	if (depth > statistics.Depth)
+	{
+		statistics.Depth = depth;
+	}
+	if (this->Front) this->Front->GatherStatistics(statistics, depth + 1);
+	if (this->Back) this->Back->GatherStatistics(statistics, depth + 1);
+}
+
+void BspNode::BuildSubtrees(List<BspBuildTask> &tasks, const BspParallelism &parallelism)
+{
+	if (tasks.Length == 0)
+	{
+		return;
+	}
+	parallelism.Workers->Run(ProcessBuildTasks, tasks.First(), tasks.Length, 1, parallelism.ThreadCount);
+}
+
+void BspNode::ProcessBuildTasks(void *tasks, __int64 start, __int64 length)
+{
+	BspBuildTask *task = static_cast<BspBuildTask *>(tasks) + start;
+	BspArena::ThreadScope scope(task->Node->GetArena());
+
+	for (__int64 i = 0; i < length; i++, task++)
+	{
+		task->Node->AddFaces(task->Faces);
+	}
+}
+
+void BspNode::ProcessClippedNodes(void *batch, __int64 start, __int64 length)
+{
+	BspClipBatch *clipBatch = static_cast<BspClipBatch *>(batch);
+	BspArena::ThreadScope scope(clipBatch->Nodes[start]->GetArena());
+
+	for (__int64 i = start; i < start + length; i++)
+	{
+		BspNode *node = clipBatch->Nodes[i];
+		FaceList filtered = clipBatch->Clipper->FilterList(node->Faces);
+		node->Faces = filtered;
 	}
-	branch->AddFaces(*faces);
 }
 
-BspNode::BspNode(const List<Face> &faces)
+BspNode::BspNode(const FaceList &faces, BspVertexPool *vertices, BspArena *arena,
+				 BspSplitterSelection splitterSelection)
 	: Plane(Vec3Constants<float>::fVec3_Zero, F32NAN_SAFE)
+	, Faces(BspAllocator<IndexedFace>(arena))
+	, Front(nullptr)
+	, Back(nullptr)
+	, Vertices(vertices)
+	, SplitterSelection(splitterSelection)
+	, SplitCount(0)
 {
-	this->Faces = new List<Face>();
-	
 	this->AddFaces(faces);
 }
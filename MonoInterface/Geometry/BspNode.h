@@ -1,6 +1,10 @@
 #pragma once
 
 #include "IMonoInterface.h"
+#include "BspArena.h"
+
+#include <atomic>
+
 enum PlanePosition
 {
 	Coplanar = 0,			//!< Point or figure occupies the same plane.
@@ -28,10 +32,11 @@ struct Vertex
 	//! @param parameter Parameter that describes position of resultant vertex.
 	//!
 	//! @returns Result of interpolation.
-	Vertex CreateLerp(Vertex &other, float parameter) const;
+	Vertex CreateLerp(const Vertex &other, float parameter) const;
 };
 
-//! Represents a triangle face.
+//! Represents a triangle face with its own set of vertices. Meshes are passed to and from managed code
+//! in this form.
 struct Face
 {
 	Vertex Vertices[3];						//!< Vertices that comprise this face.
@@ -65,15 +70,102 @@ struct Face
 		this->Vertices[2] = vertex2;
 		this->SubsetIndex = subsetIndex;
 	}
+};
+
+//! Represents a storage of vertices of faces that are processed by a CSG operation.
+//!
+//! Faces of BSP trees refer to vertices by indices, and vertices that are created when faces are split are
+//! appended to the pool. Vertices are kept in chunks that are never moved, so the pool can be appended to
+//! by multiple threads, while they read vertices that were added before.
+//!
+//! The pool doesn't throw exceptions when it's full, since they would have to cross worker threads and
+//! internal calls. Vertices that don't fit are dropped instead, their indices refer to the first vertex, and
+//! the pool is marked as overflowed, so the operation can discard its results.
+class BspVertexPool
+{
+	static const int ChunkShift = 12;
+	static const int ChunkSize = 1 << ChunkShift;
+	static const int MaxChunkCount = 4096;
+public:
+	//! Largest number of vertices the pool can hold.
+	static const int Capacity = ChunkSize * MaxChunkCount;
+private:
+	std::mutex lock;			//!< Guards allocation of chunks.
+	std::atomic<int> count;
+	std::atomic<bool> overflowed;
+	std::atomic<Vertex *> chunks[MaxChunkCount];
+public:
+	BspVertexPool();
+	~BspVertexPool();
+
+	//! Appends a vertex to the pool.
+	//!
+	//! @returns Index of the vertex.
+	int Add(const Vertex &vertex);
+	//! Appends an array of vertices to the pool. Either all vertices are added or none.
+	//!
+	//! @returns Index of the first vertex.
+	int AddRange(const Vertex *vertices, int vertexCount);
+	//! Gets the vertex. It must not be called for the vertex that is being added by another thread.
+	const Vertex &operator [](int index) const
+	{
+		return this->chunks[index >> ChunkShift].load(std::memory_order_relaxed)[index & (ChunkSize - 1)];
+	}
+	//! Gets number of vertices in the pool.
+	int GetCount() const
+	{
+		int count = this->count.load(std::memory_order_relaxed);
+		return count < Capacity ? count : Capacity;
+	}
+	//! Indicates whether some vertices didn't fit into the pool.
+	bool IsOverflowed() const
+	{
+		return this->overflowed.load(std::memory_order_relaxed);
+	}
+private:
+	Vertex *GetChunk(int chunkIndex);
+	BspVertexPool(const BspVertexPool &);
+	BspVertexPool &operator =(const BspVertexPool &);
+};
+
+struct IndexedFace;
+
+//! A list of faces that takes memory from the arena of the CSG operation.
+typedef List<IndexedFace, BspAllocator<IndexedFace>> FaceList;
+
+//! Represents a triangle face which vertices are stored in the vertex buffer.
+//!
+//! BSP trees work with these faces, since copying of indices is much cheaper then copying of whole vertices.
+struct IndexedFace
+{
+	int Indices[3];				//!< Indices of vertices that comprise this face.
+	int SubsetIndex;
+
+	IndexedFace()
+	{
+		this->Indices[0] = 0;
+		this->Indices[1] = 0;
+		this->Indices[2] = 0;
+		this->SubsetIndex = 0;
+	}
+	IndexedFace(int index0, int index1, int index2, int subsetIndex)
+	{
+		this->Indices[0] = index0;
+		this->Indices[1] = index1;
+		this->Indices[2] = index2;
+		this->SubsetIndex = subsetIndex;
+	}
 
 	//! Calculates the plane this face is on.
-	Plane GetPlane() const;
+	Plane GetPlane(const BspVertexPool &vertices) const;
 	//! Calculates the normal to the plane this face is on.
-	Vec3 GetNormal() const;
+	Vec3 GetNormal(const BspVertexPool &vertices) const;
 	//! Flips this face.
 	void Invert();
 	//! Splits this face with a plane.
 	//!
+	//! @param vertices           Pool of vertices of this face, where vertices that split the edges are
+	//!                           added.
 	//! @param splitter           Plane that splits this face.
 	//! @param frontCoplanarFaces A collection to add this face to, if it's located on the splitter
 	//!                           and is facing the same way.
@@ -83,54 +175,176 @@ struct Face
 	//!                           of the splitter.
 	//! @param backFaces          A collection to add parts of this face that are located behind
 	//!                           the splitter.
-	void Split(Plane splitter,
-			   List<Face> *frontCoplanarFaces, List<Face> *backCoplanarFaces,
-			   List<Face> *frontFaces, List<Face> *backFaces) const;
-	//! Splits this face with a plane.
 	//!
-	//! @param vertices       A pointer to an array of vertices.
-	//! @param vertexCount    Number of vertices.
+	//! @returns Position of this face relative to the splitter.
+	PlanePosition Split(BspVertexPool &vertices, Plane splitter,
+						FaceList *frontCoplanarFaces, FaceList *backCoplanarFaces,
+						FaceList *frontFaces, FaceList *backFaces) const;
+	//! Determines position of this face relative to the plane.
+	PlanePosition Classify(const BspVertexPool &vertices, const Plane &plane) const;
+	//! Splits a convex polygon into triangles.
+	//!
+	//! @param indices        A pointer to an array of indices of vertices.
+	//! @param indexCount     Number of vertices.
 	//! @param faceCollection A collection of faces to put resultant faces into.
-	static void TriangulateLinearly(List<Vertex> &vertices, List<Face> *faceCollection, int subsetIndex);
+	//! @param subsetIndex    Index of the subset resultant faces belong to.
+	static void TriangulateLinearly(const int *indices, int indexCount, FaceList *faceCollection,
+									int subsetIndex);
+};
+
+struct BatchWorkerPool;
+
+//! Defines how BSP operations are split between threads.
+struct BspParallelism
+{
+	//! Threads that help the calling one. If null, all work is done on the calling thread.
+	BatchWorkerPool *Workers;
+	int ThreadCount;			//!< Number of threads that do the work, including the calling one.
+	int Threshold;				//!< Minimal number of faces that makes the work split between threads.
+
+	BspParallelism()
+		: Workers(nullptr)
+		, ThreadCount(1)
+		, Threshold(0)
+	{
+	}
+	BspParallelism(BatchWorkerPool *workers, int threadCount, int threshold)
+		: Workers(workers)
+		, ThreadCount(threadCount)
+		, Threshold(threshold)
+	{
+	}
+
+	//! Determines whether there are threads to split the work between.
+	bool Available() const
+	{
+		return this->Workers && this->ThreadCount > 1;
+	}
+	//! Determines whether the work on given number of faces should be split between threads.
+	bool Enabled(__int64 faceCount) const
+	{
+		return this->Available() && faceCount >= this->Threshold;
+	}
 };
 
+//! Enumeration of ways the plane that divides the space in the BSP node can be chosen.
+enum BspSplitterSelection
+{
+	//! Plane of the first face is used. It's fast, but makes deep unbalanced trees and a lot of splits.
+	BspSplitterFirstFace = 0,
+	//! Planes of a sample of faces are scored by the number of faces they split and by the difference
+	//! between numbers of faces in front and behind them, the best one is used.
+	BspSplitterSampled
+};
+
+//! Represents a set of numbers that describe the shape of BSP trees.
+struct BspStatistics
+{
+	int NodeCount;
+	int Depth;					//!< Number of nodes on the longest path from the root to the leaf.
+	int FaceCount;				//!< Number of faces in the nodes.
+	int SplitCount;				//!< Number of faces that were split while the trees were built.
+
+	BspStatistics()
+		: NodeCount(0)
+		, Depth(0)
+		, FaceCount(0)
+		, SplitCount(0)
+	{
+	}
+};
+
+struct BspBuildTask;
+
 //! Represents a node in a BSP tree.
+//!
+//! When the node is created with an arena, all nodes and face lists of the tree take memory from it and
+//! are not destroyed individually: the whole tree is released along with the arena.
+//!
+//! All trees that take part in one CSG operation must share the vertex pool.
 struct BspNode
 {
 	Plane Plane;				//!< Plane that divides the space in this node.
-	List<Face> *Faces;			//!< A list of faces located on a plane of this node.
+	FaceList Faces;				//!< A list of faces located on a plane of this node.
 	BspNode *Front;				//!< BSP node located in front of this node.
 	BspNode *Back;				//!< BSP node located behind this node.
+	BspVertexPool *Vertices;	//!< Vertices of faces of this tree.
+	//! Defines how planes are chosen for this node and its branches.
+	BspSplitterSelection SplitterSelection;
+	int SplitCount;				//!< Number of faces that were split by the plane of this node.
 
-	BspNode()
+	explicit BspNode(BspVertexPool *vertices, BspArena *arena = nullptr,
+					 BspSplitterSelection splitterSelection = BspSplitterSampled)
 		: Plane(Vec3Constants<float>::fVec3_Zero, F32NAN_SAFE)
+		, Faces(BspAllocator<IndexedFace>(arena))
 		, Front(nullptr)
 		, Back(nullptr)
+		, Vertices(vertices)
+		, SplitterSelection(splitterSelection)
+		, SplitCount(0)
 	{
-		this->Faces = new List<Face>();
 	}
-	explicit BspNode(const List<Face> &faces);
+	BspNode(const FaceList &faces, BspVertexPool *vertices, BspArena *arena = nullptr,
+			BspSplitterSelection splitterSelection = BspSplitterSampled);
 
 	~BspNode()
 	{
 		this->Plane.d = F32NAN_SAFE;
-		if (this->Faces) delete this->Faces; this->Faces = nullptr;
-		if (this->Front) delete this->Front; this->Front = nullptr;
-		if (this->Back)  delete this->Back; this->Back = nullptr;
+		// Branches that live in the arena are released along with it.
+		if (!this->GetArena())
+		{
+			if (this->Front) delete this->Front;
+			if (this->Back)  delete this->Back;
+		}
+		this->Front = nullptr;
+		this->Back = nullptr;
 	}
 
-	//! Gets the list of all faces in this BSP tree.
-	List<Face> *AllFaces() const;
+	//! Gets the arena this tree takes memory from.
+	BspArena *GetArena() const
+	{
+		return this->Faces.Allocator().GetArena();
+	}
+	//! Adds all faces in this BSP tree to the list.
+	void AllFaces(FaceList &faces) const;
 	//! Adds a bunch of faces to this BSP tree.
-	void AddFaces(const List<Face> &faces);
+	void AddFaces(const FaceList &faces);
+	//! Adds a bunch of faces to this BSP tree. Top levels of the tree are built on the calling thread,
+	//! and subtrees below them are built in parallel.
+	void AddFaces(const FaceList &faces, const BspParallelism &parallelism);
+	//! Adds faces to 2 BSP trees at the same time.
+	static void AddFaces(BspNode &node1, const FaceList &faces1, BspNode &node2, const FaceList &faces2,
+						 const BspParallelism &parallelism);
 	//! Inverts this BSP node.
 	void Invert();
 	//! Cuts given elements and removes parts that end up inside this tree.
-	List<Face> *FilterList(List<Face> *faces) const;
+	FaceList FilterList(const FaceList &faces) const;
 	//! Cuts elements inside this tree and removes ones that end up inside another one.
 	void CutTreeOut(const BspNode &node);
+	//! Cuts elements inside this tree and removes ones that end up inside another one. Face lists of
+	//! different nodes are cut in parallel.
+	void CutTreeOut(const BspNode &node, const BspParallelism &parallelism);
 	//! Adds given BSP tree to this one.
 	void Unite(BspNode *node);
+	//! Adds given BSP tree to this one, splitting the work between threads.
+	void Unite(BspNode *node, const BspParallelism &parallelism);
+	//! Adds numbers that describe this tree to the statistics.
+	void GatherStatistics(BspStatistics &statistics) const;
 private:
-	void AssignBranch(BspNode *&branch, List<Face> *faces) const;
-};
\ No newline at end of file
+	//! Splits faces with the plane of this node, choosing the plane, if this node doesn't have it yet.
+	void SplitFaces(const FaceList &faces, FaceList &frontalElements, FaceList &backElements);
+	//! Chooses the face which plane divides the space in this node.
+	//!
+	//! @returns Index of the face in the list.
+	int SelectSplitter(const FaceList &faces) const;
+	//! Builds top levels of the tree and postpones building of the subtrees below them.
+	void AddFaces(const FaceList &faces, List<BspBuildTask> &tasks, int threshold, int levels);
+	void AssignBranch(BspNode *&branch, const FaceList &faces) const;
+	BspNode *CreateBranch() const;
+	void CollectNodes(List<BspNode *> &nodes, __int64 &faceCount);
+	void GatherStatistics(BspStatistics &statistics, int depth) const;
+	//! Builds subtrees that were postponed, using multiple threads.
+	static void BuildSubtrees(List<BspBuildTask> &tasks, const BspParallelism &parallelism);
+	static void ProcessBuildTasks(void *tasks, __int64 start, __int64 length);
+	static void ProcessClippedNodes(void *batch, __int64 start, __int64 length);
+};
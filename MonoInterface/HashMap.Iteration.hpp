@@ -0,0 +1,167 @@
+#pragma once
+
+//! Represents an object that is used to iterate through a hash map.
+//!
+//! Key-value pairs are visited in the order of slots they occupy, which has nothing to do with the order they
+//! were added in. Dereferencing the iterator yields the iterator itself, so the current pair is accessed
+//! through Key() and Value() functions:
+//!
+//! @code{.cpp}
+//!
+//! for (auto &entry : map)
+//! {
+//!     CryLogAlways("%d = %d", entry.Key(), entry.Value());
+//! }
+//!
+//! @endcode
+template<typename MapType>
+class HashMapIterator : public IteratorBase
+{
+friend MapType;
+public:
+	typedef ForwardIteratorTag iterator_category;
+
+	typedef typename MapType::key_type key_type;
+	typedef typename MapType::value_type value_type;
+
+	typedef typename MapType::size_type size_type;
+	typedef typename MapType::difference_type difference_type;
+
+private:
+	const MapType  *map;     //!< The map this iterator goes through.
+	difference_type current; //!< Zero-based index of the slot this iterator is currently at.
+
+public:
+	//! Gets the key of the current key-value pair.
+	const key_type &Key() const
+	{
+		this->AssertPositionAccessibility();
+		return this->map->KeyAt(this->current);
+	}
+	//! Gets the value of the current key-value pair.
+	value_type &Value() const
+	{
+		this->AssertPositionAccessibility();
+		return this->map->ValueAt(this->current);
+	}
+
+	//! Creates an orphan iterator.
+	HashMapIterator() : map(nullptr), current(-1)
+	{
+	}
+	//! Creates a new iterator for the map that is initialized to be at the first full slot starting from the
+	//! specified one.
+	HashMapIterator(difference_type index, const MapType *map)
+		: map(map), current(index)
+	{
+		this->BecomeAdopted(map);
+		this->SkipFreeSlots();
+	}
+	~HashMapIterator()
+	{
+		this->BecomeOrphaned();
+	}
+
+	//
+	// Validity check.
+	//
+
+	//! Indicates whether this iterator is valid.
+	operator bool() const
+	{
+		return this->map && this->current >= 0 && this->current < difference_type(this->map->Capacity());
+	}
+
+	//
+	// Element access operators.
+	//
+
+	//! Gets the reference to this iterator, which provides access to the current key-value pair.
+	const HashMapIterator &operator *() const
+	{
+		this->AssertPositionAccessibility();
+		return *this;
+	}
+
+	//
+	// Movement operators.
+	//
+
+	//! Advances this iterator to the next key-value pair in the map. This is a pre-increment operator.
+	HashMapIterator &operator++()
+	{
+#ifdef DEBUG_ITERATION
+		if (!this->GetCollection())
+		{
+			throw std::logic_error("The iterator cannot be moved: no connection to the map.");
+		}
+#endif // DEBUG_ITERATION
+		this->current++;
+		this->SkipFreeSlots();
+
+		return *this;
+	}
+	//! Advances this iterator to the next key-value pair in the map. This is a post-increment operator.
+	HashMapIterator operator++(int)
+	{
+		HashMapIterator temp = *this;
+		++*this;
+		return temp;
+	}
+
+	//
+	// Comparison operators.
+	//
+
+	//! Determines whether 2 iterators are on the same position of the map.
+	bool operator== (const HashMapIterator &other) const
+	{
+		this->AssertCompatibility(other);
+		return this->current == other.current;
+	}
+	//! Determines whether 2 iterators are not on the same position of the map.
+	bool operator!= (const HashMapIterator &other) const
+	{
+		return !(*this == other);
+	}
+private:
+	void SkipFreeSlots()
+	{
+		difference_type capacity = difference_type(this->map->Capacity());
+		while (this->current < capacity && !this->map->IsFull(this->current))
+		{
+			this->current++;
+		}
+	}
+	void AssertPositionAccessibility() const
+	{
+#ifdef DEBUG_ITERATION
+		if (!this->GetCollection())
+		{
+			throw std::logic_error("The iterator cannot access its current position: no connection to the map.");
+		}
+		if (this->current < 0 || this->current >= difference_type(this->map->Capacity()) ||
+			!this->map->IsFull(this->current))
+		{
+			throw std::out_of_range("The iterator cannot access its current position: it's out of range.");
+		}
+#endif // DEBUG_ITERATION
+	}
+	void AssertCompatibility(const HashMapIterator &
+#ifdef DEBUG_ITERATION
+							 other
+#endif
+							 ) const
+	{
+#ifdef DEBUG_ITERATION
+		if (!this->GetCollection())
+		{
+			throw std::logic_error("This iterator is not compatible with the other: it's an orphan.");
+		}
+		if (this->GetCollection() != other.GetCollection())
+		{
+			throw std::invalid_argument("This iterator is not compatible with the other: its map is different.");
+		}
+#endif // DEBUG_ITERATION
+	}
+};
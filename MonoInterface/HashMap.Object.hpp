@@ -0,0 +1,596 @@
+#pragma once
+
+#include "List.hpp"
+#include "HashMap.Iteration.hpp"
+
+#include <emmintrin.h>
+#include <intrin.h>
+
+//! Represents a functor that computes hash codes of objects using std::hash`1.
+//!
+//! Hash codes don't have to be evenly distributed, since HashMapObject`4 mixes them anyway.
+template<typename KeyType>
+struct DefaultHasher
+{
+	size_t operator()(const KeyType &key) const
+	{
+		return std::hash<KeyType>()(key);
+	}
+};
+
+//! Represents a group of control bytes of the hash map that are probed at once.
+//!
+//! Every slot of the map has a control byte: a full slot keeps 7 lower bits of the hash code of its key,
+//! while free slots have the highest bit set. This allows the group to compare 16 slots against the hash
+//! code using only a couple of SSE2 instructions.
+struct HashMapGroup
+{
+	static const int Width = 16;
+	static const signed char EmptySlot = -128;	//!< Control byte of the slot that was never used.
+	static const signed char DeletedSlot = -2;	//!< Control byte of the slot which key was removed.
+
+	__m128i control;
+
+	//! Loads control bytes of the group.
+	//!
+	//! @param position Pointer to the control byte of the first slot of the group.
+	explicit HashMapGroup(const signed char *position)
+		: control(_mm_loadu_si128(reinterpret_cast<const __m128i *>(position)))
+	{
+	}
+
+	//! Gets a bit mask of slots that have a given control byte.
+	unsigned int Match(signed char controlByte) const
+	{
+		__m128i matches = _mm_cmpeq_epi8(this->control, _mm_set1_epi8(controlByte));
+		return static_cast<unsigned int>(_mm_movemask_epi8(matches));
+	}
+	//! Gets a bit mask of slots that were never used.
+	unsigned int MatchEmpty() const
+	{
+		return this->Match(EmptySlot);
+	}
+	//! Gets a bit mask of slots that can be used for insertion.
+	unsigned int MatchFree() const
+	{
+		return static_cast<unsigned int>(_mm_movemask_epi8(this->control));
+	}
+	//! Gets the index of the lowest bit that is set in non-zero mask.
+	static unsigned long LowestBit(unsigned int mask)
+	{
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return index;
+	}
+};
+
+//! Represents an object that is encapsulated by objects of type HashMap`4.
+//!
+//! Keys and values are kept in separate arrays, so probing doesn't have to load values. Capacity is always
+//! a power of 2, and the table grows when 7/8 of its slots are used.
+template<
+	typename KeyType,
+	typename ElementType,
+	typename HasherType    = DefaultHasher<KeyType>,
+	typename AllocatorType = DefaultAllocator<KeyType>>
+class HashMapObject : public CollectionBase
+{
+// Whoever invented name hiding can go die in hell.
+using CollectionBase::InvalidateIterators;
+
+friend HashMapIterator<HashMapObject>;
+public:
+	typedef KeyType key_type;
+	typedef ElementType value_type;
+	typedef HasherType hasher_type;
+	typedef AllocatorType key_allocator_type;
+	typedef typename AllocatorType::template rebind<value_type>::other value_allocator_type;
+	typedef typename AllocatorType::template rebind<signed char>::other control_allocator_type;
+	typedef HashMapIterator<HashMapObject> iterator_type;
+
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+
+	//! Smallest number of slots in the table that has any.
+	static const size_type MinimalCapacity = HashMapGroup::Width;
+private:
+	signed char        *control;        //!< Control bytes of slots, followed by copies of the first 15.
+	key_type           *keys;           //!< Keys, only ones in full slots are initialized.
+	value_type         *values;         //!< Values, only ones in full slots are initialized.
+	size_type           capacity;       //!< Number of slots.
+	size_type           count;          //!< Number of full slots.
+	size_type           growthLeft;     //!< Number of empty slots that can be filled before the table grows.
+	hasher_type         hasher;         //!< An object to use to compute hash codes of keys.
+	key_allocator_type  allocator;      //!< An object to use for working with memory.
+	size_type           ReferenceCount; //!< Number of live references to this map.
+public:
+	//! Gets the reference to the object that is used to compute hash codes of keys.
+	const hasher_type &Hasher() const
+	{
+		return this->hasher;
+	}
+	//! Gets the reference to the object that is used to (de)allocate memory and (de)initialize objects that
+	//! represent keys.
+	const key_allocator_type &KeyAllocator() const
+	{
+		return this->allocator;
+	}
+	//! Gets number of key-value pairs in the map.
+	size_type Length() const
+	{
+		return this->count;
+	}
+	//! Gets number of slots in the table.
+	size_type Capacity() const
+	{
+		return this->capacity;
+	}
+
+	//! Creates a new object.
+	//!
+	//! @param allocator An object to use for working with memory.
+	//! @param hasher    An object to use to compute hash codes of keys.
+	HashMapObject(key_allocator_type &&allocator, const hasher_type &hasher)
+		: control(nullptr)
+		, keys(nullptr)
+		, values(nullptr)
+		, capacity(0)
+		, count(0)
+		, growthLeft(0)
+		, hasher(hasher)
+		, allocator(allocator)
+		, ReferenceCount(1)
+	{
+		this->AllocateIteratorChain();
+	}
+	~HashMapObject()
+	{
+		this->DestroyElements();
+		this->ReleaseTable(this->control, this->keys, this->values);
+		this->ReleaseIteratorChain();
+	}
+	//! Registers a live reference to this object.
+	void RegisterReference()
+	{
+		this->ReferenceCount++;
+	}
+	//! Informs this object about removal of reference to this object.
+	//!
+	//! @returns Number of references after decrement.
+	size_type UnregisterReference()
+	{
+		if (--this->ReferenceCount == 0)
+		{
+			this->InvalidateIterators();
+			// Deinitialize this object to force the table to destroy itself.
+			this->~HashMapObject();
+		}
+
+		return this->ReferenceCount;
+	}
+	//! Adds a new key-value pair to the map.
+	template<typename KeyT, typename ValueT>
+	void Add(KeyT &&key, ValueT &&value)
+	{
+		size_type hash = this->Hash(key);
+		if (this->FindSlot(key, hash) >= 0)
+		{
+			throw std::logic_error("There is already a value with this key.");
+		}
+
+		size_type index = this->PrepareInsertion(hash);
+		this->InitializeSlot(index, std::forward<KeyT>(key), std::forward<ValueT>(value));
+	}
+	//! Adds a new key-value pair to the map or updates a value on existing one.
+	template<typename KeyT, typename ValueT>
+	bool Update(KeyT &&key, ValueT &&value)
+	{
+		size_type hash = this->Hash(key);
+		difference_type index = this->FindSlot(key, hash);
+		if (index >= 0)
+		{
+			this->values[index] = std::forward<ValueT>(value);
+			return true;
+		}
+
+		index = this->PrepareInsertion(hash);
+		this->InitializeSlot(index, std::forward<KeyT>(key), std::forward<ValueT>(value));
+		return false;
+	}
+	//! Attempts to add an object that is constructed out or given objects to this map.
+	template<typename KeyT, typename... ArgumentTypes>
+	void Make(KeyT &&key, ArgumentTypes && ... arguments)
+	{
+		size_type hash = this->Hash(key);
+		if (this->FindSlot(key, hash) >= 0)
+		{
+			throw std::logic_error("There is already a value with this key.");
+		}
+
+		size_type index = this->PrepareInsertion(hash);
+		this->InitializeSlot(index, std::forward<KeyT>(key), std::forward<ArgumentTypes>(arguments)...);
+	}
+	//! Adds a new key-value pair where value is constructed from given arguments, or updates the value on
+	//! existing one.
+	template<typename KeyT, typename... ArgumentTypes>
+	bool Restruct(KeyT &&key, ArgumentTypes && ... arguments)
+	{
+		size_type hash = this->Hash(key);
+		difference_type index = this->FindSlot(key, hash);
+		if (index >= 0)
+		{
+			value_allocator_type valueAllocator(this->allocator);
+			valueAllocator.Deinitialize(this->values + index);
+			valueAllocator.Initialize(this->values + index, std::forward<ArgumentTypes>(arguments)...);
+			return true;
+		}
+
+		index = this->PrepareInsertion(hash);
+		this->InitializeSlot(index, std::forward<KeyT>(key), std::forward<ArgumentTypes>(arguments)...);
+		return false;
+	}
+	//! Ensures existence of a key-value pair with given key, by adding it with provided value, if it's not in
+	//! the map.
+	template<typename KeyT, typename ValueT>
+	value_type &Ensure(KeyT &&key, ValueT &&value)
+	{
+		size_type hash = this->Hash(key);
+		difference_type index = this->FindSlot(key, hash);
+		if (index < 0)
+		{
+			index = this->PrepareInsertion(hash);
+			this->InitializeSlot(index, std::forward<KeyT>(key), std::forward<ValueT>(value));
+		}
+
+		return this->values[index];
+	}
+	//! Ensures existence of a key-value pair with given key, by adding it with an object that is constructed
+	//! from provided arguments, if it's not in the map.
+	template<typename KeyT, typename... ArgumentTypes>
+	value_type &Establish(KeyT &&key, ArgumentTypes && ... arguments)
+	{
+		size_type hash = this->Hash(key);
+		difference_type index = this->FindSlot(key, hash);
+		if (index < 0)
+		{
+			index = this->PrepareInsertion(hash);
+			this->InitializeSlot(index, std::forward<KeyT>(key), std::forward<ArgumentTypes>(arguments)...);
+		}
+
+		return this->values[index];
+	}
+	//! Attempts to remove a value that is associated with the key.
+	template<typename KeyT>
+	bool Remove(KeyT &&key)
+	{
+		difference_type index = this->FindSlot(key, this->Hash(key));
+		if (index < 0)
+		{
+			return false;
+		}
+
+		value_allocator_type valueAllocator(this->allocator);
+		this->allocator.Deinitialize(this->keys + index);
+		valueAllocator.Deinitialize(this->values + index);
+
+		// The slot cannot become empty, since probing for keys that were added after it must not stop there.
+		this->SetControl(index, HashMapGroup::DeletedSlot);
+		this->count--;
+		this->InvalidateIterators();
+		return true;
+	}
+	//! Removes all key-value pairs from the map without releasing the memory.
+	void Clear()
+	{
+		if (this->capacity == 0)
+		{
+			return;
+		}
+
+		this->DestroyElements();
+		memset(this->control, HashMapGroup::EmptySlot, this->capacity + HashMapGroup::Width - 1);
+		this->count = 0;
+		this->growthLeft = MaxLoad(this->capacity);
+		this->InvalidateIterators();
+	}
+	//! Makes sure that the map can hold given number of key-value pairs without growing.
+	void Reserve(size_type length)
+	{
+		size_type newCapacity = this->capacity == 0 ? MinimalCapacity : this->capacity;
+		while (MaxLoad(newCapacity) < length)
+		{
+			newCapacity *= 2;
+		}
+
+		if (newCapacity > this->capacity)
+		{
+			this->Resize(newCapacity);
+		}
+	}
+	//! Determines whether there is a key in the collection.
+	template<typename KeyT>
+	bool Contains(KeyT &&key) const
+	{
+		return this->FindSlot(key, this->Hash(key)) >= 0;
+	}
+	//! Gets the pointer to the value that is associated with the key.
+	template<typename KeyT>
+	value_type *Find(KeyT &&key) const
+	{
+		difference_type index = this->FindSlot(key, this->Hash(key));
+		return index >= 0 ? this->values + index : nullptr;
+	}
+	//! Provides read/write access to the value associated with given key.
+	template<typename KeyT>
+	ElementType &At(KeyT &&key)
+	{
+		difference_type index = this->FindSlot(key, this->Hash(key));
+		if (index >= 0)
+		{
+			return this->values[index];
+		}
+		throw std::logic_error("Attempt to get a value that has no key associated with it in the collection.");
+	}
+	//! Provides read-only access to the value associated with given key.
+	template<typename KeyT>
+	const ElementType &At(KeyT &&key) const
+	{
+		difference_type index = this->FindSlot(key, this->Hash(key));
+		if (index >= 0)
+		{
+			return this->values[index];
+		}
+		throw std::logic_error("Attempt to get a value that has no key associated with it in the collection.");
+	}
+	//! Attempts to get the value that is supposed to be associated with the key.
+	template<typename KeyT>
+	bool TryGet(KeyT &&key, ElementType &returnedValue) const
+	{
+		difference_type index = this->FindSlot(key, this->Hash(key));
+		if (index >= 0)
+		{
+			returnedValue = this->values[index];
+			return true;
+		}
+		return false;
+	}
+	//! Attempts to set the value that is supposed to be associated with the key.
+	template<typename KeyT, typename ValueT>
+	bool TrySet(KeyT &&key, ValueT &&value)
+	{
+		difference_type index = this->FindSlot(key, this->Hash(key));
+		if (index >= 0)
+		{
+			this->values[index] = std::forward<ValueT>(value);
+			return true;
+		}
+		return false;
+	}
+	//! Assigns contents from another map.
+	void Assign(const HashMapObject *other)
+	{
+		this->Clear();
+		this->Reserve(other->count);
+
+		for (size_type i = 0; i < other->capacity; i++)
+		{
+			if (other->IsFull(i))
+			{
+				this->Add(other->keys[i], other->values[i]);
+			}
+		}
+	}
+	//! Assigns a range of values to this map.
+	template<typename IteratorType>
+	void Assign(IteratorType first, const IteratorType &last)
+	{
+		this->Clear();
+
+		for (; first != last; ++first)
+		{
+			const Pair<key_type, value_type> &currentPair = *first;
+			this->Update(currentPair.Value1, currentPair.Value2);
+		}
+	}
+	//! Determines whether the slot holds a key-value pair.
+	bool IsFull(size_type index) const
+	{
+		return this->control[index] >= 0;
+	}
+	//! Gets the key in the full slot.
+	const key_type &KeyAt(size_type index) const
+	{
+		return this->keys[index];
+	}
+	//! Gets the value in the full slot.
+	value_type &ValueAt(size_type index) const
+	{
+		return this->values[index];
+	}
+private:
+	static size_type MaxLoad(size_type capacity)
+	{
+		return capacity - capacity / 8;
+	}
+	// Computes the hash code of the key. Hash codes are mixed, since lower 7 bits go into the control byte,
+	// and the rest is used to find the group, so both must depend on every bit of the hash code.
+	template<typename KeyT>
+	size_type Hash(const KeyT &key) const
+	{
+		unsigned __int64 product = static_cast<unsigned __int64>(this->hasher(key)) * 0x9E3779B97F4A7C15ull;
+		return static_cast<size_type>(product ^ (product >> 32));
+	}
+	// Finds the slot that contains the key, returns -1 if there is no such slot.
+	template<typename KeyT>
+	difference_type FindSlot(const KeyT &key, size_type hash) const
+	{
+		if (this->capacity == 0)
+		{
+			return -1;
+		}
+
+		signed char controlByte = static_cast<signed char>(hash & 0x7F);
+		size_type mask = this->capacity - 1;
+		size_type position = (hash >> 7) & mask;
+		// Triangular probing visits every group, when number of groups is a power of 2.
+		for (size_type step = HashMapGroup::Width;; step += HashMapGroup::Width)
+		{
+			HashMapGroup group(this->control + position);
+			for (unsigned int matches = group.Match(controlByte); matches; matches &= matches - 1)
+			{
+				size_type index = (position + HashMapGroup::LowestBit(matches)) & mask;
+				if (this->keys[index] == key)
+				{
+					return difference_type(index);
+				}
+			}
+			// The key would have been put into the empty slot, if it was in the map.
+			if (group.MatchEmpty())
+			{
+				return -1;
+			}
+			position = (position + step) & mask;
+		}
+	}
+	// Finds the first slot along the probing sequence that can be used for insertion.
+	size_type FindFreeSlot(size_type hash) const
+	{
+		size_type mask = this->capacity - 1;
+		size_type position = (hash >> 7) & mask;
+		for (size_type step = HashMapGroup::Width;; step += HashMapGroup::Width)
+		{
+			unsigned int free = HashMapGroup(this->control + position).MatchFree();
+			if (free)
+			{
+				return (position + HashMapGroup::LowestBit(free)) & mask;
+			}
+			position = (position + step) & mask;
+		}
+	}
+	// Finds the slot for the new key and marks it as full, growing the table, if necessary.
+	size_type PrepareInsertion(size_type hash)
+	{
+		size_type index = this->capacity ? this->FindFreeSlot(hash) : 0;
+		if (this->growthLeft == 0 && (this->capacity == 0 || this->control[index] == HashMapGroup::EmptySlot))
+		{
+			// Removed slots are cleaned up without growing, if they take up a lot of space.
+			this->Resize(this->capacity == 0
+						 ? MinimalCapacity
+						 : this->count * 2 <= this->capacity ? this->capacity : this->capacity * 2);
+			index = this->FindFreeSlot(hash);
+		}
+		else
+		{
+			this->InvalidateIterators();
+		}
+
+		if (this->control[index] == HashMapGroup::EmptySlot)
+		{
+			this->growthLeft--;
+		}
+		this->SetControl(index, static_cast<signed char>(hash & 0x7F));
+		this->count++;
+		return index;
+	}
+	// Initializes the key and the value in the slot that was prepared for insertion.
+	template<typename KeyT, typename... ArgumentTypes>
+	void InitializeSlot(size_type index, KeyT &&key, ArgumentTypes && ... arguments)
+	{
+		value_allocator_type valueAllocator(this->allocator);
+		this->allocator.Initialize(this->keys + index, std::forward<KeyT>(key));
+		valueAllocator.Initialize(this->values + index, std::forward<ArgumentTypes>(arguments)...);
+	}
+	// Sets the control byte of the slot and its copy that is put after the end of the table, so the groups
+	// that start near the end can be loaded without wrapping around.
+	void SetControl(size_type index, signed char controlByte)
+	{
+		const size_type clonedBytes = HashMapGroup::Width - 1;
+
+		this->control[index] = controlByte;
+		this->control[((index - clonedBytes) & (this->capacity - 1)) + clonedBytes] = controlByte;
+	}
+	// Moves all key-value pairs into a new table.
+	void Resize(size_type newCapacity)
+	{
+		signed char *oldControl = this->control;
+		key_type *oldKeys = this->keys;
+		value_type *oldValues = this->values;
+		size_type oldCapacity = this->capacity;
+
+		control_allocator_type controlAllocator(this->allocator);
+		value_allocator_type valueAllocator(this->allocator);
+
+		this->control = controlAllocator.Allocate(newCapacity + HashMapGroup::Width - 1);
+		this->keys = this->allocator.Allocate(newCapacity);
+		this->values = valueAllocator.Allocate(newCapacity);
+		this->capacity = newCapacity;
+		this->growthLeft = MaxLoad(newCapacity) - this->count;
+		memset(this->control, HashMapGroup::EmptySlot, newCapacity + HashMapGroup::Width - 1);
+
+		for (size_type i = 0; i < oldCapacity; i++)
+		{
+			if (oldControl[i] < 0)
+			{
+				continue;
+			}
+
+			size_type hash = this->Hash(oldKeys[i]);
+			size_type index = this->FindFreeSlot(hash);
+			this->SetControl(index, static_cast<signed char>(hash & 0x7F));
+
+			this->allocator.Initialize(this->keys + index, std::move(oldKeys[i]));
+			valueAllocator.Initialize(this->values + index, std::move(oldValues[i]));
+			this->allocator.Deinitialize(oldKeys + i);
+			valueAllocator.Deinitialize(oldValues + i);
+		}
+
+		this->ReleaseTable(oldControl, oldKeys, oldValues);
+		this->InvalidateIterators();
+	}
+	// Deinitializes keys and values in all full slots.
+	void DestroyElements()
+	{
+		value_allocator_type valueAllocator(this->allocator);
+		for (size_type i = 0; i < this->capacity; i++)
+		{
+			if (this->IsFull(i))
+			{
+				this->allocator.Deinitialize(this->keys + i);
+				valueAllocator.Deinitialize(this->values + i);
+			}
+		}
+	}
+	void ReleaseTable(signed char *controlBytes, key_type *keyArray, value_type *valueArray)
+	{
+		if (!controlBytes)
+		{
+			return;
+		}
+
+		control_allocator_type controlAllocator(this->allocator);
+		value_allocator_type valueAllocator(this->allocator);
+
+		controlAllocator.Deallocate(controlBytes);
+		this->allocator.Deallocate(keyArray);
+		valueAllocator.Deallocate(valueArray);
+	}
+	void AllocateIteratorChain()
+	{
+#ifdef DEBUG_ITERATION
+		typename key_allocator_type::template rebind<CollectionIterators>::other chainAllocator(this->allocator);
+		this->iterators = chainAllocator.Allocate(1);
+		chainAllocator.Initialize(this->iterators, CollectionIterators());
+		this->iterators->collection = this;
+#endif // DEBUG_ITERATION
+	}
+	void ReleaseIteratorChain()
+	{
+#ifdef DEBUG_ITERATION
+		typename key_allocator_type::template rebind<CollectionIterators>::other chainAllocator(this->allocator);
+		this->InvalidateIterators();
+		chainAllocator.Deinitialize(this->iterators);
+		chainAllocator.Deallocate(this->iterators);
+		this->iterators = nullptr;
+#endif // DEBUG_ITERATION
+	}
+};
@@ -0,0 +1,362 @@
+#pragma once
+
+#include "HashMap.Object.hpp"
+
+//! Represents an unordered collection of key-value pairs.
+//!
+//! This implementation doesn't permit having multiple values with the same key. Unlike SortedList`4, which
+//! needs a binary search for every lookup and shifts the tail of the list on every insertion, this map
+//! finds keys in constant time using open addressing with groups of 16 slots that are probed at once.
+//! Pointers and references to keys and values remain valid until the map grows or the pair is removed.
+//!
+//! @tparam KeyType       Type of keys. Needs to overload equality operator.
+//! @tparam ElementType   Type of elements.
+//! @tparam HasherType    Type of objects to use to compute hash codes of keys. Must have a parentheses
+//!                       operator that accepts a key and returns size_t.
+//! @tparam AllocatorType Type of objects to use to (de)allocate and (de)initialize objects in the map.
+//!                       This must be a template type with ability to "rebind" to a different type of objects.
+//!                       Look at the implementation of DefaultAllocator`1 for details.
+template<
+	typename KeyType,
+	typename ElementType,
+	typename HasherType    = DefaultHasher<KeyType>,
+	typename AllocatorType = DefaultAllocator<KeyType>>
+class HashMap
+{
+public:
+	typedef KeyType key_type;
+	typedef ElementType value_type;
+	typedef HasherType hasher_type;
+	typedef AllocatorType key_allocator_type;
+	typedef HashMapObject<key_type, value_type, hasher_type, AllocatorType> map_object_type;
+	typedef typename AllocatorType::template rebind<map_object_type>::other map_object_allocator_type;
+	typedef typename map_object_type::iterator_type iterator_type;
+
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+
+private:
+	map_object_type *map;
+
+public:
+	//! Gets the reference to the object that is used to (de)allocate memory and (de)initialize objects that
+	//! represent keys.
+	const key_allocator_type &KeyAllocator() const
+	{
+		return this->map->KeyAllocator();
+	}
+
+	//! Creates a default map.
+	HashMap()
+	{
+		this->CreateObject(key_allocator_type(), hasher_type());
+	}
+	//! Creates a map with enough space for specified number of key-value pairs.
+	//!
+	//! @param capacity Number of key-value pairs the map can hold without growing.
+	explicit HashMap(size_type capacity)
+	{
+		this->CreateObject(key_allocator_type(), hasher_type());
+
+		this->map->Reserve(capacity);
+	}
+	//! Creates a shallow copy of the map.
+	//!
+	//! @param other Reference to the map to copy the contents from.
+	HashMap(const HashMap &other)
+		: map(other.map)
+	{
+		this->map->RegisterReference();
+	}
+	//! Creates a deep copy of the map.
+	//!
+	//! @param other Reference to the map to copy the contents from.
+	HashMap(const HashMap &other, const key_allocator_type &allocator, const hasher_type &hasher = hasher_type())
+	{
+		this->CreateObject(allocator, hasher);
+
+		this->map->Assign(other.map);
+	}
+	//! Assigns contents of the temporary object to the new one.
+	//!
+	//! @param other Reference to another temporary map to move into the new one.
+	HashMap(HashMap &&other)
+		: map(other.map)
+	{
+		other.map = nullptr;
+	}
+	~HashMap()
+	{
+		this->ReleaseObject();
+	}
+
+	//! Assigns a shallow copy of another map.
+	HashMap &operator =(const HashMap &other)
+	{
+		if (other.map)
+		{
+			other.map->RegisterReference();
+		}
+		this->ReleaseObject();
+
+		this->map = other.map;
+
+		return *this;
+	}
+	//! Assigns a shallow copy of another map.
+	HashMap &operator =(HashMap &&other)
+	{
+		this->ReleaseObject();
+
+		this->map = other.map;
+		other.map = nullptr;
+
+		return *this;
+	}
+	//! Assigns a brace initialization list to this object.
+	HashMap &operator =(std::initializer_list<Pair<key_type, value_type>> values)
+	{
+		this->map->Assign(values.begin(), values.end());
+		return *this;
+	}
+
+	//! Determines whether there is a key in the collection.
+	//!
+	//! @tparam KeyT Type of reference to the key.
+	template<typename KeyT>
+	bool Contains(KeyT &&key) const
+	{
+		return this->map->Contains(std::forward<KeyT>(key));
+	}
+	//! Adds a key-value pair to this map.
+	//!
+	//! An std::logic_error exception is thrown, if there is already a value with this key.
+	//!
+	//! @tparam KeyT   Type of reference to the key.
+	//! @tparam ValueT Type of reference to the value.
+	//!
+	//! @param key     An object that represents the key that will be used to access the value later.
+	//! @param element An object that represents the value that will be accessed by the key.
+	template<typename KeyT, typename ValueT>
+	void Add(KeyT &&key, ValueT &&element)
+	{
+		this->map->Add(std::forward<KeyT>(key), std::forward<ValueT>(element));
+	}
+	//! Adds a new key-value pair to the map or updates a value on existing one.
+	//!
+	//! @tparam KeyT   Type of reference to the key.
+	//! @tparam ValueT Type of reference to the value.
+	//!
+	//! @param key     An object that represents the key that will be used to access the value later.
+	//! @param element An object that represents the value that will be accessed by the key.
+	//!
+	//! @returns A boolean value that indicates whether a value was updated, rather then inserted.
+	template<typename KeyT, typename ValueT>
+	bool Update(KeyT &&key, ValueT &&value)
+	{
+		return this->map->Update(std::forward<KeyT>(key), std::forward<ValueT>(value));
+	}
+	//! Attempts to add an object that is constructed out or given objects to this map.
+	//!
+	//! @tparam KeyT          Type of reference to the key.
+	//! @tparam ArgumentTypes Types of arguments that are used to construct the new value.
+	//!
+	//! @param key       An object that represents the key that will be used to access the value later.
+	//! @param arguments A sequence of arguments to pass to the constructor of the value.
+	template<typename KeyT, typename... ArgumentTypes>
+	void Make(KeyT &&key, ArgumentTypes &&... arguments)
+	{
+		this->map->Make(std::forward<KeyT>(key), std::forward<ArgumentTypes>(arguments)...);
+	}
+	//! Adds a new key-value pair where value is constructed from given arguments, or updates the value on
+	//! existing one.
+	//!
+	//! @tparam KeyT          Type of reference to the key.
+	//! @tparam ArgumentTypes Types of arguments that are used to construct the new value.
+	//!
+	//! @param key       An object that represents the key that will be used to access the value later.
+	//! @param arguments A sequence of arguments to pass to the constructor of the value.
+	//!
+	//! @returns A boolean value that indicates whether a value was updated, rather then inserted.
+	template<typename KeyT, typename... ArgumentTypes>
+	bool Restruct(KeyT &&key, ArgumentTypes &&... arguments)
+	{
+		return this->map->Restruct(std::forward<KeyT>(key), std::forward<ArgumentTypes>(arguments)...);
+	}
+	//! Ensures existence of a key-value pair with given key, by adding it with provided value, if it's not in
+	//! the map.
+	//!
+	//! @tparam KeyT   Type of reference to the key.
+	//! @tparam ValueT Type of reference to the value.
+	//!
+	//! @param key     An object that represents the key that will be used to access the value later.
+	//! @param element An object that represents the value that will be accessed by the key.
+	//!
+	//! @returns Reference to the value that is associated with the given key.
+	template<typename KeyT, typename ValueT>
+	value_type &Ensure(KeyT &&key, ValueT &&value)
+	{
+		return this->map->Ensure(std::forward<KeyT>(key), std::forward<ValueT>(value));
+	}
+	//! Ensures existence of a key-value pair with given key, by adding it with an object that is constructed
+	//! from provided arguments, if it's not in the map.
+	//!
+	//! @tparam KeyT          Type of reference to the key.
+	//! @tparam ArgumentTypes Types of arguments that are used to construct the new value.
+	//!
+	//! @param key       An object that represents the key that will be used to access the value later.
+	//! @param arguments A sequence of arguments to pass to the constructor of the value.
+	//!
+	//! @returns Reference to the value that is associated with the given key.
+	template<typename KeyT, typename... ArgumentTypes>
+	value_type &Establish(KeyT &&key, ArgumentTypes && ... arguments)
+	{
+		return this->map->Establish(std::forward<KeyT>(key), std::forward<ArgumentTypes>(arguments)...);
+	}
+	//! Removes a value mapped to a given key, and indicates removal.
+	//!
+	//! @tparam KeyT Type of reference to the key.
+	//!
+	//! @param key An object that represents the key that is associated with the value that needs removal.
+	template<typename KeyT>
+	bool Remove(KeyT &&key)
+	{
+		return this->map->Remove(std::forward<KeyT>(key));
+	}
+	//! Removes all key-value pairs from this map without releasing the memory.
+	void Clear()
+	{
+		this->map->Clear();
+	}
+	//! Makes sure that this map can hold given number of key-value pairs without growing.
+	void Reserve(size_type length)
+	{
+		this->map->Reserve(length);
+	}
+	//! Gets the pointer to the value that is associated with the key.
+	//!
+	//! @tparam KeyT Type of reference to the key.
+	//!
+	//! @param key An object that represents the key that is associated with the value that needs access.
+	//!
+	//! @returns A pointer to the value, or null, if there is no value with this key.
+	template<typename KeyT>
+	value_type *Find(KeyT &&key) const
+	{
+		return this->map->Find(std::forward<KeyT>(key));
+	}
+	//! Provides read/write access to the value associated with given key.
+	//!
+	//! An std::logic_error exception is thrown, if a value with provided key is not found.
+	//!
+	//! @tparam KeyT Type of reference to the key.
+	//!
+	//! @param key An object that represents the key that is associated with the value that needs access.
+	template<typename KeyT>
+	ElementType &operator[](KeyT &&key)
+	{
+		return this->map->At(std::forward<KeyT>(key));
+	}
+	//! Provides read-only access to the value associated with given key.
+	//!
+	//! An std::logic_error exception is thrown, if a value with provided key is not found.
+	//!
+	//! @tparam KeyT Type of reference to the key.
+	//!
+	//! @param key An object that represents the key that is associated with the value that needs access.
+	template<typename KeyT>
+	const ElementType &operator[](KeyT &&key) const
+	{
+		return this->map->At(std::forward<KeyT>(key));
+	}
+	//! Attempts to get the value that is supposed to be associated with the key.
+	//!
+	//! @tparam KeyT Type of reference to the key.
+	//!
+	//! @param key           An object that represents the key that is associated with the value that needs
+	//!                      access.
+	//! @param returnedValue Reference to the object that will contain a copy of the retrieved value if this
+	//!                      method returns true.
+	//!
+	//! @returns A boolean value that indicates whether a value was retrieved successfully.
+	template<typename KeyT>
+	bool TryGet(KeyT &&key, ElementType &returnedValue) const
+	{
+		return this->map->TryGet(std::forward<KeyT>(key), returnedValue);
+	}
+	//! Attempts to set the value that is supposed to be associated with the key.
+	//!
+	//! @tparam KeyT   Type of reference to the key.
+	//! @tparam ValueT Type of reference to the value.
+	//!
+	//! @param key           An object that represents the key that is associated with the value that needs
+	//!                      access.
+	//! @param returnedValue Reference to the object that will replace existing value if this method returns
+	//!                      true.
+	//!
+	//! @returns A boolean value that indicates whether a value was modified successfully.
+	template<typename KeyT, typename ValueT>
+	bool TrySet(KeyT &&key, ValueT &&value)
+	{
+		return this->map->TrySet(std::forward<KeyT>(key), std::forward<ValueT>(value));
+	}
+	//! Gets the iterator that can be used to start iteration through this map.
+	iterator_type begin() const
+	{
+		return iterator_type(0, this->map);
+	}
+	//! Gets the iterator that represents the end of iteration through this map.
+	iterator_type end() const
+	{
+		return iterator_type(difference_type(this->map->Capacity()), this->map);
+	}
+	//! Gets number of key-value pairs in the collection.
+	__declspec(property(get = GetLength)) int Length;
+	int GetLength() const
+	{
+		return int(this->map->Length());
+	}
+	//! Gets number of slots in the table.
+	__declspec(property(get = GetCapacity)) int Capacity;
+	int GetCapacity() const
+	{
+		return int(this->map->Capacity());
+	}
+	//! Indicates whether this map is empty.
+	__declspec(property(get = GetEmpty)) bool Empty;
+	bool GetEmpty() const
+	{
+		return this->map->Length() == 0;
+	}
+private:
+	// Creates a map object.
+	template<typename AllocType, typename HashType>
+	void CreateObject(AllocType &&alloc, HashType &&hasher)
+	{
+		// Create an allocator object from forwarded reference.
+		key_allocator_type allocator(std::forward<AllocType>(alloc));
+
+		// Create an allocator that can allocate objects of type HashMapObject`4.
+		map_object_allocator_type objectAllocator(allocator);
+
+		// Allocate memory for the object.
+		this->map = objectAllocator.Allocate(1);
+
+		// Initialize the object.
+		objectAllocator.Initialize(this->map, std::move(allocator), std::forward<HashType>(hasher));
+	}
+	// Destroys the map object, if its reference count reaches 0.
+	void ReleaseObject()
+	{
+		if (!this->map || this->map->UnregisterReference())
+		{
+			return;
+		}
+
+		// Delete the object, since there are no live references to it.
+		map_object_allocator_type objectAllocator(this->KeyAllocator());
+
+		objectAllocator.Deallocate(this->map);
+		this->map = nullptr;
+	}
+};
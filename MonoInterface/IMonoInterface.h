@@ -103,6 +103,24 @@ public:
 	//!
 	//! @param listener Pointer to the object that implements IMonoSystemListener.
 	VIRTUAL_API virtual void RemoveListener(IMonoSystemListener *listener) = 0;
+	//! Opens a new phase of CryCIL start-up, so the time it takes can be found in the start-up trace.
+	//!
+	//! Phases are nested within the ones that are still open. Nothing is recorded after initialization of
+	//! CryCIL is complete.
+	//!
+	//! @param category Name of the group the phase belongs to.
+	//! @param name     Name of the phase.
+	VIRTUAL_API virtual void BeginStartupPhase(const char *category, const char *name) = 0;
+	//! Closes the last phase of CryCIL start-up that was opened.
+	VIRTUAL_API virtual void EndStartupPhase() = 0;
+	//! Queues initialization of the interop that only registers internal calls.
+	//!
+	//! Queued interops are initialized on worker threads while the main thread initializes the others.
+	//! All of them are initialized before broadcasting of RunTimeInitialized event is complete. If the event
+	//! is not being broadcast, the interop is initialized right away.
+	//!
+	//! @param interop Pointer to the interop to initialize.
+	VIRTUAL_API virtual void QueueInteropInitialization(IMonoInteropBase *interop) = 0;
 	// Properties.
 
 	//! Gets the pointer to AppDomain.
@@ -257,6 +275,16 @@ inline mono::string ToMonoString(const wchar_t *ntString)
 {
 	return MonoEnv->Objects->Texts->ToManaged(ntString);
 }
+//! Gets managed string that contains given text from the cache of frequently converted texts.
+//!
+//! Use this function for names and other short texts that are passed to managed code over and over
+//! again. The same object can be returned to multiple callers, so it must not be modified.
+//!
+//! @param ntString Null-terminated string which text to look up.
+inline mono::string ToMonoStringCached(const char *ntString)
+{
+	return MonoEnv->Objects->Texts->ToManagedCached(ntString);
+}
 //! Creates native null-terminated string from managed one.
 //!
 //! @param monoString Reference to a managed string to convert.
@@ -272,16 +300,54 @@ inline const wchar_t *ToNative16String(mono::string monoString)
 	return MonoEnv->Objects->Texts->ToNative16(monoString);
 }
 
+//! Represents a UTF-8 version of the managed string that is put into the scratch memory of the calling
+//! thread rather than the heap.
+//!
+//! Use these objects for strings that are passed to interop methods and are only needed until the method
+//! returns. Scratch memory is released in reverse order, so the objects must be destroyed in reverse order
+//! of creation, which is always the case for local variables and temporary objects.
+struct ScratchText
+{
+private:
+	const char *chars;
+	size_t mark;
+public:
+	//! Converts the managed string.
+	//!
+	//! @param monoString Reference to a managed string to convert.
+	explicit ScratchText(mono::string monoString)
+	{
+		this->chars = MonoEnv->Objects->Texts->ToScratch(monoString, this->mark);
+	}
+	~ScratchText()
+	{
+		MonoEnv->Objects->Texts->ReleaseScratch(this->mark);
+	}
+
+	//! Implicit conversion. Returns converted text, or null, if managed string was null.
+	operator const char *() const
+	{
+		return this->chars;
+	}
+	//! Used when this object has to be passed to the function with variadic parameter list.
+	const char *c_str() const
+	{
+		return this->chars;
+	}
+private:
+	ScratchText(const ScratchText &);
+	ScratchText &operator =(const ScratchText &);
+};
+
 #ifdef CRYCIL_MODULE
 //! Creates a new null-terminated string from given .Net/Mono string.
 //!
 //! @param managedString Instance of type System.String.
-template<typename symbol>
-TextTemplate<symbol>::TextTemplate(mono::string managedString)
+template<typename symbol, typename ReferenceCountType>
+TextTemplate<symbol, ReferenceCountType>::TextTemplate(mono::string managedString)
 {
-	const char *nt = ToNativeString(managedString);
+	ScratchText nt(managedString);
 	this->Assign(nt);
-	delete nt;
 }
 #endif // CRYCIL_MODULE
 
@@ -4,6 +4,7 @@
 
 #include "AssemblyUtilities.h"
 #include "MonoAssemblies.h"
+#include "MonoAotCache.h"
 
 #if 1
   #define CryamblyMessage CryLogAlways
@@ -16,7 +17,7 @@ CryamblyWrapper::CryamblyWrapper(const char *fileName)
 	CryamblyMessage("Started creation of Cryambly object.");
 
 	MonoImageOpenStatus status;
-	this->assembly = mono_assembly_open(fileName, &status);
+	this->assembly = MonoAotCache::OpenAssembly(fileName, &status);
 
 	switch (status)
 	{
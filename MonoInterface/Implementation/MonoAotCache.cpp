@@ -0,0 +1,246 @@
+#include "stdafx.h"
+
+#include "MonoAotCache.h"
+#include "Engine/DirectoryStructure.h"
+
+#include <CrySystem/ICmdLine.h>
+
+#include <fstream>
+
+bool MonoAotCache::enabled = false;
+List<MonoAotCache::PendingImage *> MonoAotCache::pendingImages;
+std::mutex MonoAotCache::pendingImagesLock;
+List<char> MonoAotCache::compilationEnvironment;
+std::thread MonoAotCache::compilationThread;
+std::atomic<bool> MonoAotCache::stopCompilation(false);
+
+void MonoAotCache::Initialize()
+{
+	ICmdLine *commandLine = gEnv->pSystem->GetICmdLine();
+	enabled = commandLine && commandLine->FindArg(eCLAT_Pre, "cil_aot") != nullptr;
+
+	if (enabled)
+	{
+		CryLogAlways("Ahead-of-time compiled images will be loaded from %s.",
+					 DirectoryStructure::GetAotCacheFolder());
+	}
+}
+
+MonoImage *MonoAotCache::OpenImage(char *data, uint32_t size, bool needCopy, const char *path, bool onDisk,
+								   MonoImageOpenStatus *status)
+{
+	if (!enabled)
+	{
+		return mono_image_open_from_data_with_name(data, size, needCopy, status, false, path);
+	}
+
+	// MVID is needed to choose the name of the image, so the metadata is read once without loading the
+	// assembly.
+	MonoImage *metadata = mono_image_open_from_data_full(data, size, false, status, false);
+	if (!metadata)
+	{
+		return nullptr;
+	}
+	Text mvid = mono_image_get_guid(metadata);
+	mono_image_close(metadata);
+
+	const char *fileName = PathUtil::GetFile(path);
+	Text folder = BuildPath({ DirectoryStructure::GetAotCacheFolder(), mvid }, false);
+	Text imageName = BuildPath({ folder, fileName }, true);
+	Text compiledImage = Text({ imageName, ".dll" });
+
+	if (!FileExists(compiledImage))
+	{
+		if (onDisk)
+		{
+			CreateDirectoryA(DirectoryStructure::GetAotCacheFolder(), nullptr);
+			CreateDirectoryA(folder, nullptr);
+
+			PendingImage *pending = new PendingImage();
+			pending->AssemblyFile = path;
+			pending->ImageFile = compiledImage;
+
+			std::lock_guard<std::mutex> guard(pendingImagesLock);
+			pendingImages.Add(pending);
+		}
+		// Mono will not find the compiled image and will JIT-compile the code.
+		return mono_image_open_from_data_with_name(data, size, needCopy, status, false, path);
+	}
+
+	// Mono compares MVIDs stored in the compiled image with the one of the assembly and falls back to JIT,
+	// if they don't match.
+	return mono_image_open_from_data_with_name(data, size, needCopy, status, false, imageName);
+}
+
+MonoAssembly *MonoAotCache::OpenAssembly(const char *path, MonoImageOpenStatus *status)
+{
+	if (!enabled)
+	{
+		return mono_assembly_open(path, status);
+	}
+
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file)
+	{
+		*status = MONO_IMAGE_ERROR_ERRNO;
+		return nullptr;
+	}
+	uint32_t size = uint32_t(file.tellg());
+	char *data = new char[size];
+	file.seekg(0);
+	file.read(data, size);
+
+	MonoImage *image = OpenImage(data, size, true, path, true, status);
+	delete[] data;
+	if (!image)
+	{
+		return nullptr;
+	}
+
+	// The path is used to find assemblies that are referenced by this one.
+	return mono_assembly_load_from_full(image, path, status, false);
+}
+
+void MonoAotCache::CompilePendingImages()
+{
+	std::lock_guard<std::mutex> guard(pendingImagesLock);
+
+	if (pendingImages.Empty || compilationThread.joinable())
+	{
+		return;
+	}
+
+	if (!FileExists(DirectoryStructure::GetMonoExecutableFile()))
+	{
+		CryLogAlways("Unable to compile assemblies ahead-of-time: %s was not found.",
+					 DirectoryStructure::GetMonoExecutableFile());
+		return;
+	}
+
+	CryLogAlways("Compiling %d assemblies ahead-of-time in the background.", pendingImages.Length);
+
+	// Mono executable must be able to find assemblies that are referenced by the compiled ones. The variable
+	// is only given to the compiler, since the environment of the game must stay intact.
+	Text monoPath = Text({ DirectoryStructure::GetCryCilBinariesFolder(), ";", MonoEnv->ProjectPath });
+	BuildCompilationEnvironment(monoPath);
+
+	// Assemblies that are loaded later are added to the other list, so the thread gets its own.
+	List<PendingImage *> *images = new List<PendingImage *>(pendingImages.Length);
+	for (int i = 0; i < pendingImages.Length; i++)
+	{
+		images->Add(pendingImages[i]);
+	}
+	pendingImages.Clear();
+
+	stopCompilation = false;
+	compilationThread = std::thread(Compile, images);
+}
+
+void MonoAotCache::Shutdown()
+{
+	stopCompilation = true;
+	if (compilationThread.joinable())
+	{
+		compilationThread.join();
+	}
+
+	std::lock_guard<std::mutex> guard(pendingImagesLock);
+	for (int i = 0; i < pendingImages.Length; i++)
+	{
+		delete pendingImages[i];
+	}
+	pendingImages.Clear();
+	compilationEnvironment.Clear();
+}
+
+void MonoAotCache::Compile(List<PendingImage *> *images)
+{
+	const char *monoExecutable = DirectoryStructure::GetMonoExecutableFile();
+
+	for (int i = 0; i < images->Length && !stopCompilation; i++)
+	{
+		const PendingImage *pending = (*images)[i];
+
+		// Partial AOT is used, since the code that is compiled at run-time still needs JIT.
+		Text commandLine = Text({ "\"", monoExecutable, "\" --aot=outfile=\"",
+								  pending->ImageFile, "\" \"", pending->AssemblyFile, "\"" });
+
+		STARTUPINFOA startupInfo = {};
+		startupInfo.cb = sizeof startupInfo;
+		PROCESS_INFORMATION processInfo = {};
+		if (!CreateProcessA(nullptr, const_cast<char *>(commandLine.c_str()), nullptr, nullptr, false,
+							CREATE_NO_WINDOW | BELOW_NORMAL_PRIORITY_CLASS, compilationEnvironment.First(),
+							nullptr, &startupInfo, &processInfo))
+		{
+			continue;
+		}
+
+		while (WaitForSingleObject(processInfo.hProcess, 100) == WAIT_TIMEOUT)
+		{
+			if (stopCompilation)
+			{
+				// Incomplete image must not be left in the cache.
+				TerminateProcess(processInfo.hProcess, 1);
+				WaitForSingleObject(processInfo.hProcess, INFINITE);
+				DeleteFileA(pending->ImageFile);
+				break;
+			}
+		}
+
+		CloseHandle(processInfo.hThread);
+		CloseHandle(processInfo.hProcess);
+	}
+
+	for (int i = 0; i < images->Length; i++)
+	{
+		delete (*images)[i];
+	}
+	delete images;
+}
+
+void MonoAotCache::BuildCompilationEnvironment(const char *monoPath)
+{
+	static const char variableName[] = "MONO_PATH";
+	static const size_t variableNameLength = sizeof variableName - 1;
+
+	Text variable = Text({ variableName, "=", monoPath });
+	const char *variableFirst = variable.c_str();
+	const char *variableLast = variableFirst + variable.Length + 1;
+
+	compilationEnvironment.Clear();
+
+	// The block consists of null-terminated "name=value" strings that are sorted by name without regard to
+	// case, and ends with an empty string.
+	char *environment = GetEnvironmentStringsA();
+	bool added = false;
+	for (const char *entry = environment; environment && *entry; entry += strlen(entry) + 1)
+	{
+		bool sameName = _strnicmp(entry, variableName, variableNameLength) == 0 &&
+			entry[variableNameLength] == '=';
+		if (sameName)
+		{
+			continue;
+		}
+		if (!added && _stricmp(entry, variableName) > 0)
+		{
+			compilationEnvironment.AddRange(variableFirst, variableLast);
+			added = true;
+		}
+		compilationEnvironment.AddRange(entry, entry + strlen(entry) + 1);
+	}
+	if (environment)
+	{
+		FreeEnvironmentStringsA(environment);
+	}
+	if (!added)
+	{
+		compilationEnvironment.AddRange(variableFirst, variableLast);
+	}
+	compilationEnvironment.Add('\0');
+}
+
+bool MonoAotCache::FileExists(const char *path)
+{
+	DWORD attributes = GetFileAttributesA(path);
+	return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY) == 0;
+}
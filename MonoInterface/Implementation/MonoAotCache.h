@@ -0,0 +1,61 @@
+#pragma once
+
+#include "IMonoInterface.h"
+
+#include "MonoHeaders.h"
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+//! Provides access to the cache of images of assemblies that were compiled ahead-of-time.
+//!
+//! The cache is used when the game is started with -cil_aot command-line flag. Compiled images are kept in
+//! subfolders of DirectoryStructure::GetAotCacheFolder() that are named after MVIDs of assemblies, so an
+//! image compiled for an older build of the assembly is never picked up. Mono looks for the compiled image
+//! next to the file the image of the assembly is named after, so images are opened with names that point
+//! into the cache. Assemblies that don't have compiled images are JIT-compiled as usual and are compiled
+//! ahead-of-time in the background, so the next start-up can use them.
+struct MonoAotCache
+{
+private:
+	struct PendingImage
+	{
+		Text AssemblyFile;			//!< Path to the file of the assembly to compile.
+		Text ImageFile;				//!< Path to the file where the compiled image must be put.
+	};
+
+	static bool enabled;
+	static List<PendingImage *> pendingImages;
+	static std::mutex pendingImagesLock;	//!< Assemblies can be loaded by any thread attached to Mono.
+	static List<char> compilationEnvironment;
+	static std::thread compilationThread;
+	static std::atomic<bool> stopCompilation;
+public:
+	//! Indicates whether the cache is used.
+	static bool GetEnabled() { return enabled; }
+	//! Checks the command line for the flag that enables the cache.
+	static void Initialize();
+	//! Opens the image of the assembly from memory.
+	//!
+	//! @param data     Pointer to the contents of the file of the assembly.
+	//! @param size     Size of the data.
+	//! @param needCopy Indicates whether Mono must copy the data.
+	//! @param path     Path to the file of the assembly.
+	//! @param onDisk   Indicates whether the file is on the disk, rather than in .pak archive, so it can
+	//!                 be compiled, if the cache doesn't have its image yet.
+	//! @param status   Receives the status of the operation.
+	static MonoImage *OpenImage(char *data, uint32_t size, bool needCopy, const char *path, bool onDisk,
+								MonoImageOpenStatus *status);
+	//! Opens the assembly from the file on the disk using the cache, if it is enabled.
+	static MonoAssembly *OpenAssembly(const char *path, MonoImageOpenStatus *status);
+	//! Starts compiling assemblies that were opened without compiled images on a background thread.
+	static void CompilePendingImages();
+	//! Stops compilation and waits for the background thread to finish.
+	static void Shutdown();
+private:
+	static void Compile(List<PendingImage *> *images);
+	//! Fills compilationEnvironment with the environment of this process, where MONO_PATH is replaced.
+	static void BuildCompilationEnvironment(const char *monoPath);
+	static bool FileExists(const char *path);
+};
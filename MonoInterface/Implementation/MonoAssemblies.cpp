@@ -3,6 +3,7 @@
 #include "MonoAssemblies.h"
 #include "MonoAssembly.h"
 #include "ThunkTables.h"
+#include "MonoAotCache.h"
 
 MonoAssemblies::~MonoAssemblies()
 {
@@ -93,6 +94,8 @@ ptrdiff_t MonoAssemblies::ReadFileToMemory(string path, DataType **data)
 		return 0;
 	}
 
+	gEnv->pCryPak->FindClose(handle);
+
 	// Open the file.
 	FILE *f = gEnv->pCryPak->FOpen(path, "rb", ICryPak::FLAGS_PATH_REAL);
 	int size = gEnv->pCryPak->FGetSize(f);
@@ -104,6 +107,42 @@ ptrdiff_t MonoAssemblies::ReadFileToMemory(string path, DataType **data)
 	return size;
 }
 
+template<typename DataType>
+ptrdiff_t MonoAssemblies::MapFileToMemory(string path, DataType **data)
+{
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+							  FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return 0;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0 || size.HighPart != 0)
+	{
+		CloseHandle(file);
+		return 0;
+	}
+
+	// The view keeps the mapping and the file open, so handles can be closed right away.
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping)
+	{
+		return 0;
+	}
+
+	void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!view)
+	{
+		return 0;
+	}
+
+	*data = static_cast<DataType *>(view);
+	return ptrdiff_t(size.QuadPart);
+}
+
 MonoAssembly *MonoAssemblies::MonoSearchHook(MonoAssemblyName *aname, void *user_data)
 {
 	auto assemblies = static_cast<MonoAssemblies *>(user_data);
@@ -137,30 +176,48 @@ MonoAssembly *MonoAssemblies::MonoSearchHook(MonoAssemblyName *aname, void *user
 		path = PathUtil::Make(MonoEnv->ExePath, fileName);
 	}
 
-	// Try loading the file into memory.
+	CTimeValue startTime = gEnv->pTimer->GetAsyncTime();
+	AssemblyLoadRecord record = {};
+
+	// Files on the disk are mapped into memory, files in .pak archives are read into buffers.
 	char *imageData = nullptr;
-	auto imageSize = assemblies->ReadFileToMemory(path, &imageData);
+	auto imageSize = assemblies->MapFileToMemory(path, &imageData);
+	bool imageMapped = imageSize != 0;
+	if (!imageMapped)
+	{
+		imageSize = assemblies->ReadFileToMemory(path, &imageData);
+	}
 	if (imageSize == 0)
 	{
 		return nullptr;
 	}
+	if (imageMapped) record.MappedBytes += size_t(imageSize);
+	else record.CopiedBytes += size_t(imageSize);
 
 	// Prevent infinite recursion.
 	assemblies->NativeLookUpOnly = true;
 
-	// Try loading the image from memory.
+	// Try loading the image from memory. Mono doesn't modify the data, so it can be used without copying.
 	MonoImageOpenStatus status = MONO_IMAGE_ERROR_ERRNO;
-	MonoImage *image = mono_image_open_from_data_full(imageData, imageSize, false, &status, false);
+	MonoImage *image = MonoAotCache::OpenImage(imageData, uint32_t(imageSize), false, path.c_str(), imageMapped,
+											   &status);
 
 #ifndef _RELEASE
 	// Try loading the .mdb file for debugger.
 	string debugFile = PathUtil::ReplaceExtension(path, "mdb");
 
 	mono_byte *debugData = nullptr;
-	auto debugSize = assemblies->ReadFileToMemory(debugFile, &debugData);
+	auto debugSize = assemblies->MapFileToMemory(debugFile, &debugData);
+	bool debugMapped = debugSize != 0;
+	if (!debugMapped)
+	{
+		debugSize = assemblies->ReadFileToMemory(debugFile, &debugData);
+	}
 	if (debugSize > 0)
 	{
 		mono_debug_open_image_from_memory(image, debugData, debugSize);
+		if (debugMapped) record.MappedBytes += size_t(debugSize);
+		else record.CopiedBytes += size_t(debugSize);
 	}
 #endif // !_RELEASE
 
@@ -169,14 +226,21 @@ MonoAssembly *MonoAssemblies::MonoSearchHook(MonoAssemblyName *aname, void *user
 
 	// Probably should do some clean up here, if assembly fails to load...
 
-	// Tell the wrapper where the data is, so it can delete it when unloaded.
+	// Tell the wrapper where the data is, so it can release it when unloaded.
 	wrapper = assemblies->Wrap(assembly);
 
-	wrapper->AssignData(imageData);
+	MonoAssemblyWrapper *assemblyWrapper = static_cast<MonoAssemblyWrapper *>(wrapper);
+	if (imageMapped) assemblyWrapper->AssignMappedData(imageData);
+	else wrapper->AssignData(imageData);
 #ifndef _RELEASE
-	wrapper->AssignDebugData(debugData);
+	if (debugMapped) assemblyWrapper->AssignMappedDebugData(debugData);
+	else wrapper->AssignDebugData(debugData);
 #endif // _RELEASE
 
+	record.Assembly = wrapper;
+	record.Milliseconds = (gEnv->pTimer->GetAsyncTime() - startTime).GetMilliSeconds();
+	assemblies->LoadRecords.Add(record);
+
 	assemblies->NativeLookUpOnly = false;
 
 	return assembly;
@@ -186,3 +250,28 @@ MonoAssembly *MonoAssemblies::MonoPreLoadHook(MonoAssemblyName *, char **, void
 {
 	return nullptr;
 }
+
+void MonoAssemblies::ReportLoading(IConsoleCmdArgs *)
+{
+	const List<AssemblyLoadRecord> &records = static_cast<MonoAssemblies *>(MonoEnv->Assemblies)->LoadRecords;
+
+	CryLogAlways("%-48s %12s %12s %10s", "Assembly", "Mapped", "Copied", "Time (ms)");
+
+	size_t mappedBytes = 0;
+	size_t copiedBytes = 0;
+	float milliseconds = 0;
+	for (int i = 0; i < records.Length; i++)
+	{
+		const AssemblyLoadRecord &record = records[i];
+
+		CryLogAlways("%-48s %12u %12u %10.2f", record.Assembly ? static_cast<const char *>(record.Assembly->Name) : "<failed>",
+					 unsigned(record.MappedBytes), unsigned(record.CopiedBytes), record.Milliseconds);
+
+		mappedBytes += record.MappedBytes;
+		copiedBytes += record.CopiedBytes;
+		milliseconds += record.Milliseconds;
+	}
+
+	CryLogAlways("%d assemblies were loaded in %.2f ms, %u bytes were mapped, %u bytes were copied.",
+				 records.Length, milliseconds, unsigned(mappedBytes), unsigned(copiedBytes));
+}
@@ -3,10 +3,20 @@
 #include "IMonoInterface.h"
 #include "AssemblyUtilities.h"
 
+//! Represents information about loading of an assembly by the search hook.
+struct AssemblyLoadRecord
+{
+	IMonoAssembly *Assembly;
+	size_t         MappedBytes;		//!< Number of bytes of the image and debug data that were mapped.
+	size_t         CopiedBytes;		//!< Number of bytes of the image and debug data that were read.
+	float          Milliseconds;
+};
+
 struct MonoAssemblies : public IMonoAssemblies
 {
-	AssemblyRegistry Registry;         //!< A collection of wrappers for assemblies.
-	bool             NativeLookUpOnly; //!< Indicates whether a search hook must avoid execution.
+	AssemblyRegistry         Registry;         //!< A collection of wrappers for assemblies.
+	bool                     NativeLookUpOnly; //!< Indicates whether a search hook must avoid execution.
+	List<AssemblyLoadRecord> LoadRecords;      //!< Assemblies that were loaded by the search hook.
 
 	MonoAssemblies() : NativeLookUpOnly(false)
 	{
@@ -38,7 +48,14 @@ struct MonoAssemblies : public IMonoAssemblies
 	static MonoAssembly *MonoSearchHook(MonoAssemblyName *aname, void *user_data);
 	//! Returns null.
 	static MonoAssembly *MonoPreLoadHook(MonoAssemblyName *aname, char **assemblies_path, void *user_data);
+	//! Prints the size of data and time it took to load every assembly that was loaded by the search hook.
+	static void ReportLoading(IConsoleCmdArgs *);
 private:
 	template<typename DataType>
 	ptrdiff_t ReadFileToMemory(string path, DataType **data);
+	//! Maps the file on the disk into memory for reading.
+	//!
+	//! @returns Size of the file, or 0, if the file is not on the disk or cannot be mapped.
+	template<typename DataType>
+	ptrdiff_t MapFileToMemory(string path, DataType **data);
 };
@@ -7,6 +7,8 @@ MonoAssemblyWrapper::MonoAssemblyWrapper(MonoAssembly *assembly)
 	: fileName()
 	, fileData(nullptr)
 	, debugData(nullptr)
+	, fileDataMapped(false)
+	, debugDataMapped(false)
 {
 	if (!assembly)
 	{
@@ -47,13 +49,42 @@ void MonoAssemblyWrapper::AssignDebugData(void *data)
 	this->debugData = data;
 }
 
+void MonoAssemblyWrapper::AssignMappedData(char *view)
+{
+	if (this->fileData || !view)
+	{
+		return;
+	}
+
+	this->fileData = view;
+	this->fileDataMapped = true;
+}
+
+void MonoAssemblyWrapper::AssignMappedDebugData(void *view)
+{
+	if (this->debugData || !view)
+	{
+		return;
+	}
+
+	this->debugData = view;
+	this->debugDataMapped = true;
+}
+
 void MonoAssemblyWrapper::TransferData(IMonoAssembly *other)
 {
-	other->AssignData(this->fileData);
-	other->AssignDebugData(this->debugData);
+	// Views of mapped files must be released differently, so the other wrapper has to know about them.
+	MonoAssemblyWrapper *wrapper = static_cast<MonoAssemblyWrapper *>(other);
+
+	if (this->fileDataMapped) wrapper->AssignMappedData(this->fileData);
+	else other->AssignData(this->fileData);
+	if (this->debugDataMapped) wrapper->AssignMappedDebugData(this->debugData);
+	else other->AssignDebugData(this->debugData);
 
 	this->fileData = nullptr;
 	this->debugData = nullptr;
+	this->fileDataMapped = false;
+	this->debugDataMapped = false;
 }
 
 const Text &MonoAssemblyWrapper::GetName() const
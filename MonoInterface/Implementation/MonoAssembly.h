@@ -20,6 +20,8 @@ private:
 
 	char *fileData;		//!< Pointer to the data this assembly was loaded from.
 	void *debugData;	//!< Pointer to the data debug information was loaded from.
+	bool fileDataMapped;	//!< Indicates whether fileData is a view of the mapped file rather than a buffer.
+	bool debugDataMapped;	//!< Indicates whether debugData is a view of the mapped file rather than a buffer.
 public:
 	//! Wraps given assembly.
 	explicit MonoAssemblyWrapper(MonoAssembly *assembly);
@@ -28,14 +30,26 @@ public:
 		this->assembly = nullptr;
 		this->image    = nullptr;
 
-		if (this->fileData) delete[] this->fileData;
-		if (this->debugData) delete[] this->debugData;
+		if (this->fileData)
+		{
+			if (this->fileDataMapped) UnmapViewOfFile(this->fileData);
+			else delete[] this->fileData;
+		}
+		if (this->debugData)
+		{
+			if (this->debugDataMapped) UnmapViewOfFile(this->debugData);
+			else delete[] this->debugData;
+		}
 	}
 	//! Gets the class.
 	IMonoClass *GetClass(const char *nameSpace, const char *className) const override;
 	void AssignData(char *data) override;
 	void AssignDebugData(void *data) override;
 	void TransferData(IMonoAssembly *other) override;
+	//! Assigns a view of the file the assembly was loaded from, that was mapped into memory.
+	void AssignMappedData(char *view);
+	//! Assigns a view of the file debug information was loaded from, that was mapped into memory.
+	void AssignMappedDebugData(void *view);
 
 	const Text &GetName() const override;
 	const Text &GetFullName() const override;
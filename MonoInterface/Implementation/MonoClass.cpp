@@ -18,10 +18,11 @@
 #endif
 
 MonoClassWrapper::MonoClassWrapper(MonoClass *klass)
-	: events(30)
-	, fields(30)
-	, flatMethodList(100)
-	, flatPropertyList(100)
+	: vtable(nullptr)
+	, hasMethods(false)
+	, hasProperties(false)
+	, hasEvents(false)
+	, hasFields(false)
 {
 	ClassCtorMessage("Creating a wrapper.");
 
@@ -33,18 +34,64 @@ MonoClassWrapper::MonoClassWrapper(MonoClass *klass)
 	this->nameSpace = mono_class_get_namespace(klass);
 
 	ClassCtorMessage("Stored a name and a namespace of the class.");
-	
-	MonoClass *base = klass;
-	while (base)
+}
+MonoClassWrapper::~MonoClassWrapper()
+{
+	for (auto &currentPropertyOverloads : this->properties)
+	{
+		DeleteAll(currentPropertyOverloads.Value2);
+	}
+
+	DeleteAll(this->events);
+
+	for (auto &currentMethodOverloads : this->methods)
+	{
+		DeleteAll(currentMethodOverloads.Value2);
+	}
+
+	DeleteAll(this->fields);
+}
+
+void MonoClassWrapper::EnsureMethods() const
+{
+	std::call_once(this->methodsCached, &MonoClassWrapper::CacheMethods, const_cast<MonoClassWrapper *>(this));
+}
+
+void MonoClassWrapper::EnsureProperties() const
+{
+	std::call_once(this->propertiesCached, &MonoClassWrapper::CacheProperties,
+				   const_cast<MonoClassWrapper *>(this));
+}
+
+void MonoClassWrapper::EnsureEvents() const
+{
+	std::call_once(this->eventsCached, &MonoClassWrapper::CacheEvents, const_cast<MonoClassWrapper *>(this));
+}
+
+void MonoClassWrapper::EnsureFields() const
+{
+	std::call_once(this->fieldsCached, &MonoClassWrapper::CacheFields, const_cast<MonoClassWrapper *>(this));
+}
+
+MonoVTable *MonoClassWrapper::GetVTable() const
+{
+	std::call_once(this->vtableCached, &MonoClassWrapper::CacheVTable, const_cast<MonoClassWrapper *>(this));
+	return this->vtable;
+}
+
+void MonoClassWrapper::CacheMethods()
+{
+	ClassCtorMessage("Caching methods of the class %s.", this->name.c_str());
+
+	for (MonoClass *base = this->wrappedClass; base; base = mono_class_get_parent(base))
 	{
-		// Cache methods.
 		void *iter = nullptr;
-		while (MonoMethod *met  = mono_class_get_methods(base, &iter))
+		while (MonoMethod *met = mono_class_get_methods(base, &iter))
 		{
 			Text methodName = mono_method_get_name(met);
 
 			ClassCtorMessage("Found a method %s", methodName.c_str());
-			
+
 			IMonoFunction *methodWrapper;
 			if (strcmp(mono_method_get_name(met), ".ctor") == 0)
 			{
@@ -59,16 +106,58 @@ MonoClassWrapper::MonoClassWrapper(MonoClass *klass)
 				methodWrapper = new MonoStaticMethod(met, this);
 			}
 
-			ClassCtorMessage("Created a wrapper for a method %s", methodName.c_str());
-
 			auto &overloads = this->methods.Establish(methodName, 5);
 
 			overloads.Add(methodWrapper);
 
 			this->flatMethodList.Add(methodWrapper);
 		}
-		// Cache properties.
-		iter = nullptr;
+	}
+
+	this->methods.Trim();
+	this->flatMethodList.Trim();
+
+	// Keys with null names point at the first suitable overload in the order of names, just like the
+	// search through the whole table did.
+	for (int i = 0; i < this->methods.Length; i++)
+	{
+		const char *methodName = this->methods.Keys[i];
+		const List<IMonoFunction *> &overloads = this->methods.Elements[i];
+
+		this->methodsByName.Add(methodName, -1, nullptr, &overloads);
+		this->methodsByParameterCount.Add(methodName, -1, nullptr, overloads[0]);
+		for (auto currentOverload : overloads)
+		{
+			this->methodsByParameterCount.Add(methodName, currentOverload->ParameterCount, nullptr,
+											  currentOverload);
+			this->methodsBySignature.Add(methodName, -1, currentOverload->Parameters, currentOverload);
+		}
+	}
+	for (int i = 0; i < this->methods.Length; i++)
+	{
+		const List<IMonoFunction *> &overloads = this->methods.Elements[i];
+
+		this->methodsByParameterCount.Add(nullptr, -1, nullptr, overloads[0]);
+		for (auto currentOverload : overloads)
+		{
+			this->methodsByParameterCount.Add(nullptr, currentOverload->ParameterCount, nullptr, currentOverload);
+			this->methodsBySignature.Add(nullptr, -1, currentOverload->Parameters, currentOverload);
+		}
+	}
+	this->methodsByName.Build();
+	this->methodsByParameterCount.Build();
+	this->methodsBySignature.Build();
+
+	this->hasMethods = true;
+}
+
+void MonoClassWrapper::CacheProperties()
+{
+	ClassCtorMessage("Caching properties of the class %s.", this->name.c_str());
+
+	for (MonoClass *base = this->wrappedClass; base; base = mono_class_get_parent(base))
+	{
+		void *iter = nullptr;
 		while (MonoProperty *prop = mono_class_get_properties(base, &iter))
 		{
 			const char *propName = mono_property_get_name(prop);
@@ -83,9 +172,49 @@ MonoClassWrapper::MonoClassWrapper(MonoClass *klass)
 
 			this->flatPropertyList.Add(wrapper);
 		}
-		// Cache events.
-		iter = nullptr;
-		while (MonoEvent *ev   = mono_class_get_events(base, &iter))
+	}
+
+	this->properties.Trim();
+	this->flatPropertyList.Trim();
+
+	for (int i = 0; i < this->properties.Length; i++)
+	{
+		const char *propName = this->properties.Keys[i];
+		const List<IMonoProperty *> &overloads = this->properties.Elements[i];
+
+		this->propertiesByName.Add(propName, -1, nullptr, &overloads);
+		this->propertiesByParameterCount.Add(propName, -1, nullptr, overloads[0]);
+		for (auto currentOverload : overloads)
+		{
+			this->propertiesByParameterCount.Add(propName, currentOverload->ParameterCount, nullptr,
+												 currentOverload);
+		}
+	}
+	for (int i = 0; i < this->properties.Length; i++)
+	{
+		const List<IMonoProperty *> &overloads = this->properties.Elements[i];
+
+		this->propertiesByParameterCount.Add(nullptr, -1, nullptr, overloads[0]);
+		for (auto currentOverload : overloads)
+		{
+			this->propertiesByParameterCount.Add(nullptr, currentOverload->ParameterCount, nullptr,
+												 currentOverload);
+		}
+	}
+	this->propertiesByName.Build();
+	this->propertiesByParameterCount.Build();
+
+	this->hasProperties = true;
+}
+
+void MonoClassWrapper::CacheEvents()
+{
+	ClassCtorMessage("Caching events of the class %s.", this->name.c_str());
+
+	for (MonoClass *base = this->wrappedClass; base; base = mono_class_get_parent(base))
+	{
+		void *iter = nullptr;
+		while (MonoEvent *ev = mono_class_get_events(base, &iter))
 		{
 			MonoEventWrapper *_event = new MonoEventWrapper(ev, this);
 
@@ -93,8 +222,26 @@ MonoClassWrapper::MonoClassWrapper(MonoClass *klass)
 
 			this->events.Add(_event);
 		}
-		// Cache fields.
-		iter = nullptr;
+	}
+
+	this->events.Trim();
+
+	for (auto currentEvent : this->events)
+	{
+		this->eventsByName.Add(currentEvent->Name, -1, nullptr, currentEvent);
+	}
+	this->eventsByName.Build();
+
+	this->hasEvents = true;
+}
+
+void MonoClassWrapper::CacheFields()
+{
+	ClassCtorMessage("Caching fields of the class %s.", this->name.c_str());
+
+	for (MonoClass *base = this->wrappedClass; base; base = mono_class_get_parent(base))
+	{
+		void *iter = nullptr;
 		while (MonoClassField *f = mono_class_get_fields(base, &iter))
 		{
 			MonoField *field = new MonoField(f, this);
@@ -103,62 +250,120 @@ MonoClassWrapper::MonoClassWrapper(MonoClass *klass)
 
 			this->fields.Add(field);
 		}
-
-		base = mono_class_get_parent(base);
-		if (base)
-		{
-			ClassCtorMessage("Proceeding to the next base class.");
-		}
 	}
 
-	this->methods.Trim();
-	this->properties.Trim();
-	this->events.Trim();
 	this->fields.Trim();
 
-	this->flatMethodList.Trim();
-	this->flatPropertyList.Trim();
+	for (auto currentField : this->fields)
+	{
+		this->fieldsByName.Add(currentField->Name, -1, nullptr, currentField);
+	}
+	this->fieldsByName.Build();
 
-	this->vtable = mono_class_vtable(mono_domain_get(), klass);
+	this->hasFields = true;
 }
-MonoClassWrapper::~MonoClassWrapper()
-{
-	for (auto &currentPropertyOverloads : this->properties)
-	{
-		DeleteAll(currentPropertyOverloads.Value2);
-	}
 
-	DeleteAll(this->events);
+void MonoClassWrapper::CacheVTable()
+{
+	this->vtable = mono_class_vtable(mono_domain_get(), this->wrappedClass);
+}
 
-	for (auto &currentMethodOverloads : this->methods)
-	{
-		DeleteAll(currentMethodOverloads.Value2);
+//! Calculates approximate number of bytes that are taken by the function wrapper.
+static size_t GetFunctionMemoryUsage(const IMonoFunction *func)
+{
+	if (!func)
+	{
+		return 0;
 	}
-
-	DeleteAll(this->fields);
+	return sizeof(MonoMethodWrapper) + strlen(func->Parameters) + 1 + func->ParameterCount * sizeof(Text);
 }
 
-const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, int paramCount) const
+size_t MonoClassWrapper::GetMemoryUsage() const
 {
-	if (!name)
+	size_t bytes = sizeof(MonoClassWrapper);
+	bytes += this->name.Capacity + this->nameSpace.Capacity + this->fullName.Capacity + this->fullNameIL.Capacity;
+
+	if (this->hasMethods)
 	{
-		// Take any name.
-		for (auto &currentPair : this->methods)
-		{
-			if (auto foundFunc = this->SearchTheList<IMonoFunction>(currentPair.Value2, paramCount))
-			{
-				return foundFunc;
-			}
+		bytes += this->methods.Keys.Capacity * sizeof(Text) +
+			this->methods.Elements.Capacity * sizeof(List<IMonoFunction *>);
+		for (auto &currentMethodOverloads : this->methods)
+		{
+			bytes += currentMethodOverloads.Value1.Capacity;
+			bytes += currentMethodOverloads.Value2.Capacity * sizeof(IMonoFunction *);
+		}
+		bytes += this->flatMethodList.Capacity * sizeof(IMonoFunction *);
+		bytes += this->methodsByName.GetMemoryUsage() + this->methodsByParameterCount.GetMemoryUsage() +
+			this->methodsBySignature.GetMemoryUsage();
+		for (auto currentMethod : this->flatMethodList)
+		{
+			bytes += GetFunctionMemoryUsage(currentMethod);
 		}
 	}
+	if (this->hasProperties)
+	{
+		bytes += this->properties.Keys.Capacity * sizeof(Text) +
+			this->properties.Elements.Capacity * sizeof(List<IMonoProperty *>);
+		for (auto &currentPropertyOverloads : this->properties)
+		{
+			bytes += currentPropertyOverloads.Value1.Capacity;
+			bytes += currentPropertyOverloads.Value2.Capacity * sizeof(IMonoProperty *);
+		}
+		bytes += this->flatPropertyList.Capacity * sizeof(IMonoProperty *);
+		bytes += this->propertiesByName.GetMemoryUsage() + this->propertiesByParameterCount.GetMemoryUsage();
+		for (auto currentProperty : this->flatPropertyList)
+		{
+			bytes += sizeof(MonoPropertyWrapper) + GetFunctionMemoryUsage(currentProperty->Getter) +
+				GetFunctionMemoryUsage(currentProperty->Setter);
+		}
+	}
+	if (this->hasEvents)
+	{
+		bytes += this->events.Capacity * sizeof(IMonoEvent *) + this->events.Length * sizeof(MonoEventWrapper);
+		bytes += this->eventsByName.GetMemoryUsage();
+	}
+	if (this->hasFields)
+	{
+		bytes += this->fields.Capacity * sizeof(IMonoField *) + this->fields.Length * sizeof(MonoField);
+		bytes += this->fieldsByName.GetMemoryUsage();
+	}
+	return bytes;
+}
 
-	List<IMonoFunction *> overloads;
-	if (this->methods.TryGet(name, overloads))
+//! Writes the number of members into the buffer, or a dash, if wrappers of members were not created.
+static const char *FormatMemberCount(bool cached, int count, char *buffer, size_t bufferSize)
+{
+	if (!cached)
 	{
-		return this->SearchTheList<IMonoFunction>(overloads, paramCount);
+		return "-";
 	}
+	_itoa_s(count, buffer, bufferSize, 10);
+	return buffer;
+}
 
-	return nullptr;
+void MonoClassWrapper::ReportMemoryUsage() const
+{
+	char methodCount[16];
+	char propertyCount[16];
+	char eventCount[16];
+	char fieldCount[16];
+
+	CryLogAlways("%-64s %8s %8s %8s %8s %10u",
+				 Text({ this->nameSpace, ".", this->name }).c_str(),
+				 FormatMemberCount(this->hasMethods, this->flatMethodList.Length, methodCount, sizeof(methodCount)),
+				 FormatMemberCount(this->hasProperties, this->flatPropertyList.Length, propertyCount,
+								   sizeof(propertyCount)),
+				 FormatMemberCount(this->hasEvents, this->events.Length, eventCount, sizeof(eventCount)),
+				 FormatMemberCount(this->hasFields, this->fields.Length, fieldCount, sizeof(fieldCount)),
+				 unsigned(this->GetMemoryUsage()));
+}
+
+const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, int paramCount) const
+{
+	this->EnsureMethods();
+
+	// Null name and -1 as number of parameters are parts of the key.
+	return this->methodsByParameterCount.Find(name, paramCount, nullptr);
 }
 
 const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, const char *params) const
@@ -170,44 +375,9 @@ const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, const char
 		return this->GetFunction(name, int(0));
 	}
 
-	if (!name)
-	{
-		// Take any name.
-		for (auto &currentPair : this->methods)
-		{
-			for (auto currentOverload : currentPair.Value2)
-			{
-				if (strcmp(currentOverload->Parameters, params) == 0)
-				{
-					return currentOverload;
-				}
-			}
-		}
-	}
-
-	List<IMonoFunction *> overloads;
-	if (this->methods.TryGet(name, overloads))
-	{
-#ifdef ClassDebug
-
-		ClassMessage("Looking through overloads of the method %s.", name);
-
-		for (int i = 0; i < overloads.Length; i++)
-		{
-			ClassMessage("Overload #%d: %s", i + 1, overloads[i]->Parameters);
-		}
+	this->EnsureMethods();
 
-#endif // ClassDebug
-
-		for (auto currentOverload : overloads)
-		{
-			if (strcmp(currentOverload->Parameters, params) == 0)
-			{
-				return currentOverload;
-			}
-		}
-	}
-	return nullptr;
+	return this->methodsBySignature.Find(name, -1, params);
 }
 
 const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, IMonoArray<> &types) const
@@ -217,49 +387,53 @@ const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, IMonoArray<
 		return this->GetFunction(name, int(0));
 	}
 
-	List<IMonoFunction *> overloads;
+	this->EnsureMethods();
+
 	if (!name)
 	{
 		// Take any name.
-		for (auto &currentPair : this->methods)
-		{
-			if (auto foundFunc = this->SearchTheList<IMonoFunction>(currentPair.Value2, types))
+		for (int i = 0; i < this->methods.Length; i++)
+		{
+			if (auto foundFunc = this->SearchTheList<IMonoFunction>(this->methods.Elements[i], types))
 			{
 				return foundFunc;
-			}
+			}
 		}
+		return nullptr;
 	}
-	if (this->methods.TryGet(name, overloads))
+	if (auto overloads = this->methodsByName.Find(name, -1, nullptr))
 	{
-		return this->SearchTheList<IMonoFunction>(overloads, types);
+		return this->SearchTheList<IMonoFunction>(*overloads, types);
 	}
 	return nullptr;
 }
 
 const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, List<IMonoClass *> &classes) const
 {
-	List<IMonoFunction *> overloads;
+	this->EnsureMethods();
+
 	if (!name)
 	{
 		// Take any name.
-		for (auto &currentPair : this->methods)
-		{
-			if (auto foundFunc = this->SearchTheList<IMonoFunction>(currentPair.Value2, classes))
+		for (int i = 0; i < this->methods.Length; i++)
+		{
+			if (auto foundFunc = this->SearchTheList<IMonoFunction>(this->methods.Elements[i], classes))
 			{
 				return foundFunc;
-			}
+			}
 		}
+		return nullptr;
 	}
-	if (this->methods.TryGet(name, overloads))
+	if (auto overloads = this->methodsByName.Find(name, -1, nullptr))
 	{
-		return this->SearchTheList<IMonoFunction>(overloads, classes);
+		return this->SearchTheList<IMonoFunction>(*overloads, classes);
 	}
 	return nullptr;
 }
 
 const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, List<ClassSpec> &specifiedClasses) const
 {
-	auto paramTypeNames = List<Text>(specifiedClasses.Length);
+	InlineList<Text, 8> paramTypeNames(specifiedClasses.Length);
 	auto paramTypeNtNames = List<const char *>(specifiedClasses.Length);
 
 	for (const auto &currentClassSpec : specifiedClasses)
@@ -277,21 +451,23 @@ const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, List<ClassS
 
 const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, List<const char *> &paramTypeNames) const
 {
-	List<IMonoFunction *> overloads;
+	this->EnsureMethods();
+
 	if (!name)
 	{
 		// Take any name.
-		for (auto &currentPair : this->methods)
-		{
-			if (auto foundFunc = this->SearchTheList<IMonoFunction>(currentPair.Value2, paramTypeNames))
+		for (int i = 0; i < this->methods.Length; i++)
+		{
+			if (auto foundFunc = this->SearchTheList<IMonoFunction>(this->methods.Elements[i], paramTypeNames))
 			{
 				return foundFunc;
-			}
+			}
 		}
+		return nullptr;
 	}
-	if (this->methods.TryGet(name, overloads))
+	if (auto overloads = this->methodsByName.Find(name, -1, nullptr))
 	{
-		return this->SearchTheList<IMonoFunction>(overloads, paramTypeNames);
+		return this->SearchTheList<IMonoFunction>(*overloads, paramTypeNames);
 	}
 	return nullptr;
 }
@@ -299,18 +475,19 @@ const IMonoFunction *MonoClassWrapper::GetFunction(const char *name, List<const
 //! Gets an array of methods that matches given description.
 List<IMonoFunction *> MonoClassWrapper::GetFunctions(const char *name, int paramCount) const
 {
-	List<IMonoFunction *> foundMethods(this->methods.Length);
+	this->EnsureMethods();
 
-	List<IMonoFunction *> overloads;
-	if (this->methods.TryGet(name, overloads))
-	{
-		for (auto currentOverload : overloads)
-		{
-			if (currentOverload->ParameterCount == paramCount)
-			{
-				foundMethods.Add(currentOverload);
-			}
-		}
+	List<IMonoFunction *> foundMethods;
+
+	if (auto overloads = this->methodsByName.Find(name, -1, nullptr))
+	{
+		for (auto currentOverload : *overloads)
+		{
+			if (currentOverload->ParameterCount == paramCount)
+			{
+				foundMethods.Add(currentOverload);
+			}
+		}
 	}
 
 	return foundMethods;
@@ -318,15 +495,13 @@ List<IMonoFunction *> MonoClassWrapper::GetFunctions(const char *name, int param
 //! Gets an array of overload of the method.
 List<IMonoFunction *> MonoClassWrapper::GetFunctions(const char *name) const
 {
-	List<IMonoFunction *> foundMethods(this->methods.Length);
+	this->EnsureMethods();
 
-	List<IMonoFunction *> overloads;
-	if (this->methods.TryGet(name, overloads))
-	{
-		for (auto currentOverload : overloads)
-		{
-			foundMethods.Add(currentOverload);
-		}
+	List<IMonoFunction *> foundMethods;
+
+	if (auto overloads = this->methodsByName.Find(name, -1, nullptr))
+	{
+		foundMethods.AddRange(overloads->First(), overloads->Last());
 	}
 
 	return foundMethods;
@@ -334,14 +509,9 @@ List<IMonoFunction *> MonoClassWrapper::GetFunctions(const char *name) const
 
 const IMonoField *MonoClassWrapper::GetField(const char *name) const
 {
-	for (int i = 0; i < this->fields.Length; i++)
-	{
-		if (strcmp(this->fields[i]->Name, name) == 0)
-		{
-			return this->fields[i];
-		}
-	}
-	return nullptr;
+	this->EnsureFields();
+
+	return this->fieldsByName.Find(name, -1, nullptr);
 }
 
 //! Gets the value of the object's field.
@@ -380,7 +550,7 @@ void MonoClassWrapper::GetFieldValue(mono::object obj, MonoClassField *field, vo
 	}
 	else
 	{
-		mono_field_static_get_value(this->vtable, field, value);
+		mono_field_static_get_value(this->GetVTable(), field, value);
 	}
 }
 
@@ -392,26 +562,27 @@ void MonoClassWrapper::SetFieldValue(mono::object obj, MonoClassField *field, vo
 	}
 	else
 	{
-		mono_field_static_set_value(this->vtable, field, value);
+		mono_field_static_set_value(this->GetVTable(), field, value);
 	}
 }
 
 
 const IMonoProperty *MonoClassWrapper::GetProperty(const char *name) const
 {
-	List<IMonoProperty *> overloads;
-	if (this->properties.TryGet(name, overloads))
+	this->EnsureProperties();
+
+	if (auto overloads = this->propertiesByName.Find(name, -1, nullptr))
 	{
-		for (auto currentProp : overloads)
+		for (auto currentProp : *overloads)
 		{
 			if (currentProp->Identifier->ParameterCount == 0)
 			{
 				return currentProp;
 			}
 		}
-		if (overloads.Length)
+		if (overloads->Length)
 		{
-			return overloads[0];
+			return (*overloads)[0];
 		}
 	}
 	return nullptr;
@@ -419,49 +590,53 @@ const IMonoProperty *MonoClassWrapper::GetProperty(const char *name) const
 
 const IMonoProperty *MonoClassWrapper::GetProperty(const char *name, IMonoArray<> &types) const
 {
-	List<IMonoProperty *> overloads;
+	this->EnsureProperties();
+
 	if (!name)
 	{
 		// Take any name.
-		for (auto &currentPair : this->properties)
-		{
-			if (auto foundProp = this->SearchTheList<IMonoProperty>(currentPair.Value2, types))
+		for (int i = 0; i < this->properties.Length; i++)
+		{
+			if (auto foundProp = this->SearchTheList<IMonoProperty>(this->properties.Elements[i], types))
 			{
 				return foundProp;
-			}
+			}
 		}
+		return nullptr;
 	}
-	if (this->properties.TryGet(name, overloads))
+	if (auto overloads = this->propertiesByName.Find(name, -1, nullptr))
 	{
-		return this->SearchTheList<IMonoProperty>(overloads, types);
+		return this->SearchTheList<IMonoProperty>(*overloads, types);
 	}
 	return nullptr;
 }
 
 const IMonoProperty *MonoClassWrapper::GetProperty(const char *name, List<IMonoClass *> &classes) const
 {
-	List<IMonoProperty *> overloads;
+	this->EnsureProperties();
+
 	if (!name)
 	{
 		// Take any name.
-		for (auto &currentPair : this->properties)
-		{
-			if (auto foundProp = this->SearchTheList<IMonoProperty>(currentPair.Value2, classes))
+		for (int i = 0; i < this->properties.Length; i++)
+		{
+			if (auto foundProp = this->SearchTheList<IMonoProperty>(this->properties.Elements[i], classes))
 			{
 				return foundProp;
-			}
+			}
 		}
+		return nullptr;
 	}
-	if (this->properties.TryGet(name, overloads))
+	if (auto overloads = this->propertiesByName.Find(name, -1, nullptr))
 	{
-		return this->SearchTheList<IMonoProperty>(overloads, classes);
+		return this->SearchTheList<IMonoProperty>(*overloads, classes);
 	}
 	return nullptr;
 }
 
 const IMonoProperty *MonoClassWrapper::GetProperty(const char *name, List<ClassSpec> &specifiedClasses) const
 {
-	auto paramTypeNames = List<Text>(specifiedClasses.Length);
+	InlineList<Text, 8> paramTypeNames(specifiedClasses.Length);
 	auto paramTypeNtNames = List<const char *>(specifiedClasses.Length);
 
 	for (int i = 0; i < specifiedClasses.Length; i++)
@@ -479,67 +654,37 @@ const IMonoProperty *MonoClassWrapper::GetProperty(const char *name, List<ClassS
 
 const IMonoProperty *MonoClassWrapper::GetProperty(const char *name, List<const char *> &paramTypeNames) const
 {
-	List<IMonoProperty *> overloads;
+	this->EnsureProperties();
+
 	if (!name)
 	{
 		// Take any name.
-		for (auto &currentPair : this->properties)
-		{
-			if (auto foundProp = this->SearchTheList<IMonoProperty>(currentPair.Value2, paramTypeNames))
+		for (int i = 0; i < this->properties.Length; i++)
+		{
+			if (auto foundProp = this->SearchTheList<IMonoProperty>(this->properties.Elements[i], paramTypeNames))
 			{
 				return foundProp;
-			}
+			}
 		}
+		return nullptr;
 	}
-	if (this->properties.TryGet(name, overloads))
+	if (auto overloads = this->propertiesByName.Find(name, -1, nullptr))
 	{
-		return this->SearchTheList<IMonoProperty>(overloads, paramTypeNames);
+		return this->SearchTheList<IMonoProperty>(*overloads, paramTypeNames);
 	}
 	return nullptr;
 }
 
 const IMonoProperty *MonoClassWrapper::GetProperty(const char *name, int paramCount) const
 {
-	List<IMonoProperty *> overloads;
-	if (!name)
-	{
-		// Take any name.
-		for (auto &currentPair : this->properties)
-		{
-			if (auto foundProp = this->SearchTheList<IMonoProperty>(currentPair.Value2, paramCount))
-			{
-				return foundProp;
-			}
-		}
-	}
-	if (this->properties.TryGet(name, overloads))
-	{
-		return this->SearchTheList<IMonoProperty>(overloads, paramCount);
-	}
-	return nullptr;
-}
+	this->EnsureProperties();
 
-template<typename result_type>
-__forceinline result_type *MonoClassWrapper::SearchTheList(List<result_type *> &list, int paramCount) const
-{
-	if (paramCount == -1)
-	{
-		// Take any number of parameters.
-		return list.Length == 0 ? nullptr : list[0];
-	}
-	for (int i = 0; i < list.Length; i++)
-	{
-		auto element = list[i];
-		if (element->ParameterCount == paramCount)
-		{
-			return element;
-		}
-	}
-	return nullptr;
+	// Null name and -1 as number of parameters are parts of the key.
+	return this->propertiesByParameterCount.Find(name, paramCount, nullptr);
 }
 
 template<typename result_type>
-__forceinline result_type *MonoClassWrapper::SearchTheList(List<result_type *> &list,
+__forceinline result_type *MonoClassWrapper::SearchTheList(const List<result_type *> &list,
 														   List<const char *> &paramTypeNames) const
 {
 	for (int i = 0; i < list.Length; i++)
@@ -574,7 +719,7 @@ __forceinline result_type *MonoClassWrapper::SearchTheList(List<result_type *> &
 }
 
 template<typename result_type>
-__forceinline result_type *MonoClassWrapper::SearchTheList(List<result_type *> &list,
+__forceinline result_type *MonoClassWrapper::SearchTheList(const List<result_type *> &list,
 														   List<IMonoClass *> &classes) const
 {
 	for (int i = 0; i < list.Length; i++)
@@ -607,7 +752,7 @@ __forceinline result_type *MonoClassWrapper::SearchTheList(List<result_type *> &
 }
 
 template<typename result_type>
-__forceinline result_type *MonoClassWrapper::SearchTheList(List<result_type *> &list, IMonoArray<> &types) const
+__forceinline result_type *MonoClassWrapper::SearchTheList(const List<result_type *> &list, IMonoArray<> &types) const
 {
 	for (int i = 0; i < list.Length; i++)
 	{
@@ -671,14 +816,9 @@ const char *MonoClassWrapper::BuildFullName(bool ilStyle, Text &field) const
 
 const IMonoEvent *MonoClassWrapper::GetEvent(const char *name) const
 {
-	for (int i = 0; i < this->events.Length; i++)
-	{
-		if (strcmp(this->events[i]->Name, name) == 0)
-		{
-			return this->events[i];
-		}
-	}
-	return nullptr;
+	this->EnsureEvents();
+
+	return this->eventsByName.Find(name, -1, nullptr);
 }
 //! Determines whether this class implements from specified class.
 bool MonoClassWrapper::Inherits(const char *nameSpace, const char *className) const
@@ -946,21 +1086,29 @@ mono::type MonoClassWrapper::MakePointerType() const
 
 const List<IMonoField *> &MonoClassWrapper::GetFields() const
 {
+	this->EnsureFields();
+
 	return this->fields;
 }
 
 const List<IMonoFunction *> &MonoClassWrapper::GetFunctions() const
 {
+	this->EnsureMethods();
+
 	return this->flatMethodList;
 }
 
 const List<IMonoProperty *> &MonoClassWrapper::GetProperties() const
 {
+	this->EnsureProperties();
+
 	return this->flatPropertyList;
 }
 
 const List<IMonoEvent *> &MonoClassWrapper::GetEvents() const
 {
+	this->EnsureEvents();
+
 	return this->events;
 }
 
@@ -985,15 +1133,20 @@ bool MonoClassWrapper::GetIsDelegate() const
 #define ClassCacheMessage(...) void(0)
 #endif
 
-SortedList<MonoClass *, MonoClassWrapper *> MonoClassCache::cachedClasses;
-
+std::atomic<MonoClassCache::Table *> MonoClassCache::table(nullptr);
+std::mutex MonoClassCache::writeLock;
+List<MonoClassCache::Table *> MonoClassCache::retiredTables;
 
 IMonoClass *MonoClassCache::Wrap(MonoClass *klass)
 {
+	if (!klass)
+	{
+		return nullptr;
+	}
+
 	ClassCacheMessage("Looking for the class %s in the cache.", mono_class_get_name(klass));
 
-	MonoClassWrapper *wrapper;
-	if (cachedClasses.TryGet(klass, wrapper))
+	if (MonoClassWrapper *wrapper = Find(table.load(std::memory_order_acquire), klass))
 	{
 		return wrapper;
 	}
@@ -1001,18 +1154,147 @@ IMonoClass *MonoClassCache::Wrap(MonoClass *klass)
 	ClassCacheMessage("Class is not in the cache.");
 
 	// Register a new one.
-	wrapper = new MonoClassWrapper(klass);
+	MonoClassWrapper *wrapper = new MonoClassWrapper(klass);
 
 	ClassCacheMessage("Created a wrapper for a class %s.", mono_class_get_name(klass));
 
-	MonoClassCache::cachedClasses.Add(klass, wrapper);
+	std::lock_guard<std::mutex> guard(writeLock);
+
+	// Another thread could have added the wrapper of the same class while this one was creating its own.
+	Table *current = table.load(std::memory_order_relaxed);
+	if (MonoClassWrapper *existing = Find(current, klass))
+	{
+		delete wrapper;
+		return existing;
+	}
+
+	// Keep the table at most half-full, so the chains of probes stay short.
+	if (!current || (current->Count + 1) * 2 > int(current->Mask + 1))
+	{
+		Table *bigger = CreateTable(current ? (current->Mask + 1) * 2 : 256);
+		if (current)
+		{
+			for (unsigned int i = 0; i <= current->Mask; i++)
+			{
+				MonoClass *key = current->Slots[i].Key.load(std::memory_order_relaxed);
+				if (key)
+				{
+					Insert(bigger, key, current->Slots[i].Value.load(std::memory_order_relaxed));
+				}
+			}
+			retiredTables.Add(current);
+		}
+		table.store(bigger, std::memory_order_release);
+		current = bigger;
+	}
+
+	Insert(current, klass, wrapper);
 
 	ClassCacheMessage("Added a wrapper to the cache.");
 
 	return wrapper;
 }
 
+void MonoClassCache::ReportMemoryUsage(IConsoleCmdArgs *)
+{
+	CryLogAlways("%-64s %8s %8s %8s %8s %10s", "Class", "Methods", "Props", "Events", "Fields", "Bytes");
+
+	std::lock_guard<std::mutex> guard(writeLock);
+
+	size_t totalBytes = 0;
+	int cachedTables = 0;
+	int classCount = 0;
+	if (const Table *current = table.load(std::memory_order_relaxed))
+	{
+		for (unsigned int i = 0; i <= current->Mask; i++)
+		{
+			const MonoClassWrapper *wrapper = current->Slots[i].Value.load(std::memory_order_relaxed);
+			if (!wrapper)
+			{
+				continue;
+			}
+
+			wrapper->ReportMemoryUsage();
+
+			totalBytes += wrapper->GetMemoryUsage();
+			cachedTables += int(wrapper->hasMethods) + int(wrapper->hasProperties) + int(wrapper->hasEvents) +
+				int(wrapper->hasFields);
+		}
+		classCount = current->Count;
+	}
+
+	CryLogAlways("%d classes are wrapped, %d of %d member tables are created, %u bytes are used in total.",
+				 classCount, cachedTables, classCount * 4, unsigned(totalBytes));
+}
+
 void MonoClassCache::Dispose()
 {
-	cachedClasses.~SortedList();
+	std::lock_guard<std::mutex> guard(writeLock);
+
+	retiredTables.Add(table.exchange(nullptr));
+	for (int i = 0; i < retiredTables.Length; i++)
+	{
+		if (retiredTables[i])
+		{
+			delete[] retiredTables[i]->Slots;
+			delete retiredTables[i];
+		}
+	}
+	retiredTables.Clear();
+}
+
+MonoClassWrapper *MonoClassCache::Find(const Table *table, MonoClass *klass)
+{
+	if (!table)
+	{
+		return nullptr;
+	}
+
+	for (unsigned int i = Hash(klass) & table->Mask;; i = (i + 1) & table->Mask)
+	{
+		MonoClass *key = table->Slots[i].Key.load(std::memory_order_acquire);
+		if (key == klass)
+		{
+			return table->Slots[i].Value.load(std::memory_order_relaxed);
+		}
+		if (!key)
+		{
+			return nullptr;
+		}
+	}
+}
+
+void MonoClassCache::Insert(Table *table, MonoClass *klass, MonoClassWrapper *wrapper)
+{
+	unsigned int i = Hash(klass) & table->Mask;
+	while (table->Slots[i].Key.load(std::memory_order_relaxed))
+	{
+		i = (i + 1) & table->Mask;
+	}
+
+	// Value is written first, so readers never see the key without it.
+	table->Slots[i].Value.store(wrapper, std::memory_order_relaxed);
+	table->Slots[i].Key.store(klass, std::memory_order_release);
+	table->Count++;
+}
+
+MonoClassCache::Table *MonoClassCache::CreateTable(unsigned int slotCount)
+{
+	Table *newTable = new Table();
+	newTable->Mask  = slotCount - 1;
+	newTable->Count = 0;
+	newTable->Slots = new Slot[slotCount];
+	for (unsigned int i = 0; i < slotCount; i++)
+	{
+		newTable->Slots[i].Key.store(nullptr, std::memory_order_relaxed);
+		newTable->Slots[i].Value.store(nullptr, std::memory_order_relaxed);
+	}
+	return newTable;
+}
+
+unsigned int MonoClassCache::Hash(MonoClass *klass)
+{
+	// Classes are aligned, so lower bits are the same, and multiplication spreads the rest over the upper ones.
+	unsigned __int64 address = reinterpret_cast<UINT_PTR>(klass) >> 3;
+	return static_cast<unsigned int>((address * 0x9E3779B97F4A7C15ull) >> 32);
 }
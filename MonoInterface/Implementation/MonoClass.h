@@ -4,10 +4,18 @@
 #include "MonoHeaders.h"
 #include "ThunkTables.h"
 #include "Implementation/MonoMethod.h"
+#include "Implementation/MonoMemberIndex.h"
+
+#include <mutex>
+#include <atomic>
 
 //! Represents a wrapper around MonoClass object.
+//!
+//! Wrappers of members of the class are not created until the members of the same kind are queried for the
+//! first time.
 struct MonoClassWrapper : public IMonoClass
 {
+	friend struct MonoClassCache;
 private:
 	MonoClass                               *wrappedClass;
 	Text                                     name;
@@ -22,10 +30,35 @@ private:
 	List<IMonoFunction *>                    flatMethodList;
 	List<IMonoProperty *>                    flatPropertyList;
 
+	MonoMemberIndex<const List<IMonoFunction *> *> methodsByName;
+	MonoMemberIndex<IMonoFunction *>               methodsByParameterCount;
+	MonoMemberIndex<IMonoFunction *>               methodsBySignature;
+	MonoMemberIndex<const List<IMonoProperty *> *> propertiesByName;
+	MonoMemberIndex<IMonoProperty *>               propertiesByParameterCount;
+	MonoMemberIndex<IMonoEvent *>                  eventsByName;
+	MonoMemberIndex<IMonoField *>                  fieldsByName;
+
+	mutable std::once_flag                   methodsCached;
+	mutable std::once_flag                   propertiesCached;
+	mutable std::once_flag                   eventsCached;
+	mutable std::once_flag                   fieldsCached;
+	mutable std::once_flag                   vtableCached;
+	// Indicate which tables were created, used by the memory report.
+	bool                                     hasMethods;
+	bool                                     hasProperties;
+	bool                                     hasEvents;
+	bool                                     hasFields;
+
 public:
 	MonoClassWrapper(MonoClass *klass);
 	~MonoClassWrapper();
 
+	//! Calculates the approximate number of bytes that are taken by this wrapper, its lookup tables and
+	//! wrappers of the members that were created so far.
+	size_t GetMemoryUsage() const;
+	//! Prints a line with number of cached members of each kind and memory usage of this wrapper.
+	void ReportMemoryUsage() const;
+
 	const IMonoFunction *GetFunction(const char *name, IMonoArray<> &types) const override;
 	const IMonoFunction *GetFunction(const char *name, List<IMonoClass *> &classes) const override;
 	const IMonoFunction *GetFunction(const char *name, List<ClassSpec> &specifiedClasses) const override;
@@ -95,22 +128,52 @@ private:
 	void SetFieldValue(mono::object obj, MonoClassField *field, void *value) const;
 
 	template<typename result_type>
-	__forceinline result_type *SearchTheList(List<result_type *> &list, IMonoArray<> &types) const;
-	template<typename result_type>
-	__forceinline result_type *SearchTheList(List<result_type *> &list, List<IMonoClass *> &classes) const;
+	__forceinline result_type *SearchTheList(const List<result_type *> &list, IMonoArray<> &types) const;
 	template<typename result_type>
-	__forceinline result_type *SearchTheList(List<result_type *> &list, List<const char *> &paramTypeNames) const;
+	__forceinline result_type *SearchTheList(const List<result_type *> &list, List<IMonoClass *> &classes) const;
 	template<typename result_type>
-	__forceinline result_type *SearchTheList(List<result_type *> &list, int paramCount) const;
+	__forceinline result_type *SearchTheList(const List<result_type *> &list, List<const char *> &paramTypeNames) const;
 
 	const char *BuildFullName(bool ilStyle, Text &field) const;
+
+	// These functions create wrappers for members of one kind, if that wasn't done yet.
+	void EnsureMethods() const;
+	void EnsureProperties() const;
+	void EnsureEvents() const;
+	void EnsureFields() const;
+	MonoVTable *GetVTable() const;
+
+	void CacheMethods();
+	void CacheProperties();
+	void CacheEvents();
+	void CacheFields();
+	void CacheVTable();
 };
 
 //! Caches MonoClassWrapper objects.
+//!
+//! Wrappers are kept in a hash table with open addressing that can be read from any thread without locking.
+//! Insertions are done by one thread at a time: a slot gets its value before its key, so a reader that finds
+//! the key always sees the wrapper. When the table grows, a bigger copy replaces it, and the old one is kept
+//! until the cache is disposed, since other threads can still be reading it.
 struct MonoClassCache
 {
 private:
-	static SortedList<MonoClass *, MonoClassWrapper *> cachedClasses;
+	struct Slot
+	{
+		std::atomic<MonoClass *>        Key;
+		std::atomic<MonoClassWrapper *> Value;
+	};
+	struct Table
+	{
+		unsigned int Mask;				//!< Number of slots minus one.
+		int          Count;				//!< Number of occupied slots. Only accessed by the writer.
+		Slot        *Slots;
+	};
+
+	static std::atomic<Table *> table;
+	static std::mutex writeLock;		//!< Held by the thread that inserts a wrapper.
+	static List<Table *> retiredTables;	//!< Tables that were replaced with bigger ones.
 public:
 	//! Acquires a pointer to wrapper object for given Mono class.
 	//!
@@ -120,6 +183,15 @@ public:
 	//!
 	//! @returns A wrapper object, either newly created or taken from cache.
 	static IMonoClass *Wrap(MonoClass *klass);
+	//! Prints the memory usage of every cached wrapper and the total.
+	//!
+	//! Used as a console command.
+	static void ReportMemoryUsage(IConsoleCmdArgs *);
 	//! Clears the cache.
 	static void Dispose();
+private:
+	static MonoClassWrapper *Find(const Table *table, MonoClass *klass);
+	static void Insert(Table *table, MonoClass *klass, MonoClassWrapper *wrapper);
+	static Table *CreateTable(unsigned int slotCount);
+	static unsigned int Hash(MonoClass *klass);
 };
\ No newline at end of file
@@ -2,7 +2,7 @@
 #include "MonoFunctions.h"
 #include "MonoClass.h"
 
-#if 1
+#if 0
 #define FunctionsMessage CryLogAlways
 #else
 #define FunctionsMessage(...) void(0)
@@ -35,28 +35,7 @@ void *MonoFunctions::LookupInternalCall(const IMonoFunction *func)
 mono::object MonoFunctions::InternalInvoke(_MonoMethod *func, void *object, void **args, mono::exception *ex,
 										   bool polymorph)
 {
-	MonoMethod *methodToInvoke;
-	if (polymorph)
-	{
-		uint32 flags;
-		mono_method_get_flags(func, &flags);
-		if ((flags & METHOD_ATTRIBUTE_VIRTUAL) == 0)
-		{
-			methodToInvoke = func;
-		}
-		else
-		{
-			FunctionsMessage("Polymorphing the function %p.", func);
-
-			methodToInvoke = mono_object_get_virtual_method(static_cast<MonoObject *>(object), func);
-
-			FunctionsMessage("Acquired the late bound func %p.", methodToInvoke);
-		}
-	}
-	else
-	{
-		methodToInvoke = func;
-	}
+	MonoMethod *methodToInvoke = polymorph ? ResolveVirtualMethod(func, object).Implementation : func;
 
 	MonoObject *exception;
 	MonoObject *result = mono_runtime_invoke(methodToInvoke, object, args, &exception);
@@ -96,15 +75,7 @@ mono::object MonoFunctions::InternalInvoke(_MonoMethod *func, void *object, void
 mono::object MonoFunctions::InternalInvokeArray(_MonoMethod *func, void *object, IMonoArray<> &args,
 												mono::exception *ex, bool polymorph)
 {
-	MonoMethod *methodToInvoke;
-	if (polymorph)
-	{
-		methodToInvoke = mono_object_get_virtual_method(static_cast<MonoObject *>(object), func);
-	}
-	else
-	{
-		methodToInvoke = func;
-	}
+	MonoMethod *methodToInvoke = polymorph ? ResolveVirtualMethod(func, object).Implementation : func;
 	MonoArray *paramsArray = reinterpret_cast<MonoArray *>(mono::object(args));
 	MonoObject *exception;
 	MonoObject *result = mono_runtime_invoke_array(methodToInvoke, object, paramsArray, &exception);
@@ -141,6 +112,16 @@ void *MonoFunctions::GetUnmanagedThunk(_MonoMethod *func)
 	return thunk;
 }
 
+void *MonoFunctions::GetVirtualThunk(_MonoMethod *func, void *object)
+{
+	VirtualMethod &method = ResolveVirtualMethod(func, object);
+	if (!method.Thunk)
+	{
+		method.Thunk = mono_method_get_unmanaged_thunk(method.Implementation);
+	}
+	return method.Thunk;
+}
+
 void *MonoFunctions::GetRawThunk(_MonoMethod *func)
 {
 	FunctionsMessage("Querying the thunk.");
@@ -163,14 +144,14 @@ int MonoFunctions::ParseSignature(_MonoMethod *func, List<Text> &names, Text &pa
 	
 	names = List<Text>(paramCount);
 
-	Text paramsText;
+	TextBuilder paramsText;
 	
 	void *iter = nullptr;
 	while (MonoType *paramType = mono_signature_get_params(sig, &iter))
 	{
 		if (names.Length != 0)
 		{
-			paramsText.Append(",");
+			paramsText.Append(',');
 		}
 		
 		Text typeName = mono_type_get_name(paramType);
@@ -180,7 +161,7 @@ int MonoFunctions::ParseSignature(_MonoMethod *func, List<Text> &names, Text &pa
 		names.Add(typeName);
 	}
 
-	params = paramsText;
+	params = paramsText.ToText();
 
 	return paramCount;
 }
@@ -225,3 +206,115 @@ mono::object MonoFunctions::GetReflectionObject(_MonoMethod *func)
 {
 	return mono::object(mono_method_get_object(mono_domain_get(), func, nullptr));
 }
+
+// Must be a power of 2.
+#define VIRTUAL_METHOD_CACHE_SIZE 256
+
+MonoFunctions::VirtualMethod &MonoFunctions::ResolveVirtualMethod(_MonoMethod *func, void *object)
+{
+	// Implementation of the method for a certain class never changes, so every thread can have its own cache
+	// that doesn't need any synchronization.
+	static thread_local VirtualMethod cache[VIRTUAL_METHOD_CACHE_SIZE];
+
+	MonoClass *klass = object ? mono_object_get_class(static_cast<MonoObject *>(object)) : nullptr;
+
+	UINT_PTR hash = (reinterpret_cast<UINT_PTR>(func) ^ reinterpret_cast<UINT_PTR>(klass) >> 4) >> 3;
+	VirtualMethod &entry = cache[hash & (VIRTUAL_METHOD_CACHE_SIZE - 1)];
+	if (entry.Method == func && entry.Class == klass)
+	{
+		return entry;
+	}
+
+	uint32 flags;
+	mono_method_get_flags(func, &flags);
+
+	entry.Method         = func;
+	entry.Class          = klass;
+	entry.Implementation = klass && (flags & METHOD_ATTRIBUTE_VIRTUAL) != 0
+		? mono_object_get_virtual_method(static_cast<MonoObject *>(object), func)
+		: func;
+	entry.Thunk          = nullptr;
+	return entry;
+}
+
+typedef int(__stdcall *MaxThunk)(int, int, mono::exception *);
+typedef int(*MaxRawThunk)(int, int);
+
+void MonoFunctions::Benchmark(IConsoleCmdArgs *args)
+{
+	int count = args->GetArgCount() > 1 ? atoi(args->GetArg(1)) : 1000000;
+	if (count <= 0)
+	{
+		CryLogAlways("Usage: cil_InvocationBenchmark [number of invocations]");
+		return;
+	}
+
+	const IMonoStaticMethod *max = MonoEnv->CoreLibrary->GetClass("System", "Math")
+		->GetFunction("Max", "System.Int32,System.Int32")->ToStatic();
+	const IMonoMethod *getHashCode = MonoEnv->CoreLibrary->Object->GetFunction("GetHashCode", 0)->ToInstance();
+
+	MaxThunk maxThunk = MaxThunk(max->UnmanagedThunk);
+	MaxRawThunk maxRawThunk = MaxRawThunk(max->RawThunk);
+
+	mono::object text = mono::object(ToMonoString("Invocation benchmark"));
+	MonoGCHandle handle = MonoEnv->GC->Pin(text);
+
+	CryLogAlways("Invoking managed methods %d times:", count);
+
+	// Results are summed up, so the calls cannot be optimized away.
+	__int64 sum = 0;
+	mono::exception ex;
+
+	CTimeValue start = gEnv->pTimer->GetAsyncTime();
+	for (int i = 0; i < count; i++)
+	{
+		int second = 5;
+		void *params[2] = { &i, &second };
+		sum += Unbox<int>(max->Invoke(params, &ex));
+	}
+	float invokeTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = 0; i < count; i++)
+	{
+		sum += maxThunk(i, 5, &ex);
+	}
+	float thunkTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = 0; i < count; i++)
+	{
+		sum += max->Call<int>(&ex, i, 5);
+	}
+	float callTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = 0; i < count; i++)
+	{
+		sum += maxRawThunk(i, 5);
+	}
+	float rawThunkTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = 0; i < count; i++)
+	{
+		sum += Unbox<int>(getHashCode->Invoke(text, &ex, true));
+	}
+	float virtualInvokeTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = 0; i < count; i++)
+	{
+		sum += getHashCode->CallVirtual<int>(text, &ex);
+	}
+	float virtualCallTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	double nanosecondsPerCall = 1000000.0 / count;
+	CryLogAlways("Math.Max through Invoke:                %8.2f ns", invokeTime * nanosecondsPerCall);
+	CryLogAlways("Math.Max through unmanaged thunk:       %8.2f ns", thunkTime * nanosecondsPerCall);
+	CryLogAlways("Math.Max through Call:                  %8.2f ns", callTime * nanosecondsPerCall);
+	CryLogAlways("Math.Max through raw thunk:             %8.2f ns", rawThunkTime * nanosecondsPerCall);
+	CryLogAlways("Object.GetHashCode through Invoke:      %8.2f ns", virtualInvokeTime * nanosecondsPerCall);
+	CryLogAlways("Object.GetHashCode through CallVirtual: %8.2f ns", virtualCallTime * nanosecondsPerCall);
+	CryLogAlways("Checksum: %lld", sum);
+}
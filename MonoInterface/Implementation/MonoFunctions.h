@@ -2,8 +2,20 @@
 
 #include "IMonoInterface.h"
 
+struct _MonoClass;
+
 struct MonoFunctions : public IMonoFunctions
 {
+private:
+	//! Represents an implementation of the virtual method that was found for a certain class.
+	struct VirtualMethod
+	{
+		_MonoMethod *Method;
+		_MonoClass  *Class;
+		_MonoMethod *Implementation;
+		void        *Thunk;				//!< Unmanaged thunk of the implementation, null until requested.
+	};
+public:
 	IMonoClass  *GetDeclaringClass(_MonoMethod *method) override;
 	const char  *GetName(_MonoMethod *method) override;
 	void         AddInternalCall(const char *nameSpace, const char *className, const char *name, void *functionPointer) override;
@@ -11,8 +23,17 @@ struct MonoFunctions : public IMonoFunctions
 	mono::object InternalInvoke(_MonoMethod *func, void *object, void **args, mono::exception *ex, bool polymorph) override;
 	mono::object InternalInvokeArray(_MonoMethod *func, void *object, IMonoArray<> &args, mono::exception *ex, bool polymorph) override;
 	void        *GetUnmanagedThunk(_MonoMethod *func) override;
+	void        *GetVirtualThunk(_MonoMethod *func, void *object) override;
 	void        *GetRawThunk(_MonoMethod *func) override;
 	int          ParseSignature(_MonoMethod *func, List<Text> &names, Text &params) override;
 	void         GetParameterClasses(_MonoMethod *func, List<IMonoClass *> &classes) override;
 	mono::object GetReflectionObject(_MonoMethod *func) override;
+
+	//! Compares the costs of invocation of managed methods through different APIs.
+	//!
+	//! Used as a console command.
+	static void Benchmark(IConsoleCmdArgs *args);
+private:
+	//! Finds the implementation of the method for the class of the object.
+	static VirtualMethod &ResolveVirtualMethod(_MonoMethod *func, void *object);
 };
\ No newline at end of file
@@ -0,0 +1,161 @@
+#pragma once
+
+//! Represents a hash table that is used to find members of the class by name and, optionally, by number of
+//! parameters or by the list of types of parameters.
+//!
+//! Keys refer to the strings that are owned by Mono metadata or by member wrappers, so nothing is copied.
+//! The table is filled once by calling Add for every member and then Build, and it is never changed
+//! after that, so it can be read from multiple threads.
+//!
+//! @tparam ValueType Type of values that are stored in the table. Default value of this type is returned
+//!                   when the key is not found.
+template<typename ValueType>
+class MonoMemberIndex
+{
+	struct Entry
+	{
+		unsigned int Hash;
+		int ParameterCount;			//!< -1, if number of parameters is not a part of the key.
+		const char *Name;			//!< Null, if the key is for a member with any name.
+		const char *Parameters;		//!< Null, if the list of parameters is not a part of the key.
+		ValueType Value;
+	};
+
+	List<Entry> entries;
+	List<int> buckets;				//!< Indexes of entries plus 1, 0 marks an empty bucket.
+	unsigned int mask;
+public:
+	MonoMemberIndex()
+		: mask(0)
+	{
+	}
+
+	//! Adds a key to the table.
+	//!
+	//! If the same key is added more than once, the first value is kept, just like the linear search
+	//! through the list of members would find the first one.
+	//!
+	//! @param name           Name of the member, or null to make the key match the member with any name.
+	//! @param parameterCount Number of parameters, or -1, if it is not a part of the key.
+	//! @param parameters     Comma-separated list of types of parameters, or null, if it is not a part of
+	//!                       the key.
+	//! @param value          Value to associate with the key.
+	void Add(const char *name, int parameterCount, const char *parameters, ValueType value)
+	{
+		Entry entry;
+		entry.Hash           = Hash(name, parameterCount, parameters);
+		entry.ParameterCount = parameterCount;
+		entry.Name           = name;
+		entry.Parameters     = parameters;
+		entry.Value          = value;
+		this->entries.Add(entry);
+	}
+	//! Distributes added keys between buckets. Must be called after the last key is added.
+	void Build()
+	{
+		this->entries.Trim();
+
+		int bucketCount = 4;
+		while (bucketCount < int(this->entries.Length) * 2)
+		{
+			bucketCount *= 2;
+		}
+		this->mask = static_cast<unsigned int>(bucketCount - 1);
+		this->buckets.Reserve(bucketCount);
+		for (int i = 0; i < bucketCount; i++)
+		{
+			this->buckets.Add(0);
+		}
+
+		for (int i = 0; i < this->entries.Length; i++)
+		{
+			const Entry &entry = this->entries[i];
+
+			unsigned int bucket = entry.Hash & this->mask;
+			bool duplicate = false;
+			while (int current = this->buckets[bucket])
+			{
+				if (Matches(this->entries[current - 1], entry.Hash, entry.Name, entry.ParameterCount,
+							entry.Parameters))
+				{
+					duplicate = true;
+					break;
+				}
+				bucket = (bucket + 1) & this->mask;
+			}
+			if (!duplicate)
+			{
+				this->buckets[bucket] = i + 1;
+			}
+		}
+	}
+	//! Looks up the value that is associated with the key.
+	//!
+	//! @param name           Name of the member, or null to look for the member with any name.
+	//! @param parameterCount Number of parameters, or -1, if it is not a part of the key.
+	//! @param parameters     Comma-separated list of types of parameters, or null, if it is not a part of
+	//!                       the key.
+	//!
+	//! @returns Value that is associated with the key, or default value, if the key is not in the table.
+	ValueType Find(const char *name, int parameterCount, const char *parameters) const
+	{
+		if (this->buckets.Empty)
+		{
+			return ValueType();
+		}
+
+		unsigned int hash = Hash(name, parameterCount, parameters);
+		unsigned int bucket = hash & this->mask;
+		while (int current = this->buckets[bucket])
+		{
+			const Entry &entry = this->entries[current - 1];
+			if (Matches(entry, hash, name, parameterCount, parameters))
+			{
+				return entry.Value;
+			}
+			bucket = (bucket + 1) & this->mask;
+		}
+		return ValueType();
+	}
+	//! Gets approximate number of bytes that are taken by the table.
+	size_t GetMemoryUsage() const
+	{
+		return this->entries.Capacity * sizeof(Entry) + this->buckets.Capacity * sizeof(int);
+	}
+private:
+	// FNV-1a hash of all parts of the key.
+	static unsigned int Hash(const char *name, int parameterCount, const char *parameters)
+	{
+		unsigned int hash = 2166136261u;
+		if (name)
+		{
+			for (const char *c = name; *c; c++)
+			{
+				hash = (hash ^ static_cast<unsigned char>(*c)) * 16777619u;
+			}
+		}
+		hash = (hash ^ static_cast<unsigned int>(parameterCount)) * 16777619u;
+		if (parameters)
+		{
+			for (const char *c = parameters; *c; c++)
+			{
+				hash = (hash ^ static_cast<unsigned char>(*c)) * 16777619u;
+			}
+		}
+		return hash;
+	}
+	static bool StringsMatch(const char *a, const char *b)
+	{
+		if (!a || !b)
+		{
+			return a == b;
+		}
+		return strcmp(a, b) == 0;
+	}
+	static bool Matches(const Entry &entry, unsigned int hash, const char *name, int parameterCount,
+						const char *parameters)
+	{
+		return entry.Hash == hash && entry.ParameterCount == parameterCount &&
+			StringsMatch(entry.Name, name) && StringsMatch(entry.Parameters, parameters);
+	}
+};
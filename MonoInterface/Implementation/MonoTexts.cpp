@@ -2,12 +2,386 @@
 
 #include "MonoTexts.h"
 
+#include <emmintrin.h>
+
 #if 0
 #define TextsMessage CryLogAlways
 #else
 #define TextsMessage(...) void(0)
 #endif
 
+//! Represents a stack of memory blocks that hold temporary native versions of managed strings.
+//!
+//! Every thread has its own scratch memory, so no synchronization is needed. Positions within the scratch
+//! are counted through all blocks, so a single number is enough to mark the top of the stack.
+struct TextScratch
+{
+	struct Block
+	{
+		Block *Previous;
+		size_t Start;				//!< Position of the first byte of this block.
+		size_t Size;
+	};
+
+	static const size_t DefaultBlockSize = 16 * 1024;
+
+	Block *top;
+	size_t position;
+
+	TextScratch()
+		: top(nullptr)
+		, position(0)
+	{
+	}
+	~TextScratch()
+	{
+		while (this->top)
+		{
+			Block *previous = this->top->Previous;
+			::operator delete(this->top);
+			this->top = previous;
+		}
+	}
+
+	//! Gets the scratch memory of the calling thread.
+	static TextScratch &Current()
+	{
+		static thread_local TextScratch scratch;
+		return scratch;
+	}
+
+	//! Makes sure that specified number of bytes is available at the top of the stack.
+	//!
+	//! @returns A pointer to the top of the stack.
+	char *Reserve(size_t size)
+	{
+		if (!this->top || this->position + size > this->top->Start + this->top->Size)
+		{
+			// Memory in the blocks below can still be used by earlier strings, so a new block is added.
+			size_t blockSize = size > DefaultBlockSize ? size : DefaultBlockSize;
+			Block *block = static_cast<Block *>(::operator new(sizeof(Block) + blockSize));
+			block->Previous = this->top;
+			block->Start = this->position;
+			block->Size = blockSize;
+			this->top = block;
+		}
+		return reinterpret_cast<char *>(this->top + 1) + (this->position - this->top->Start);
+	}
+	//! Moves the top of the stack up after the reserved memory was filled.
+	void Commit(size_t size)
+	{
+		this->position += size;
+	}
+	//! Moves the top of the stack back to the mark, releasing the blocks that are above it.
+	//!
+	//! The bottom block is always kept, so the thread doesn't go to the heap on every conversion.
+	void Release(size_t mark)
+	{
+		while (this->top->Previous && this->top->Start > mark)
+		{
+			Block *previous = this->top->Previous;
+			::operator delete(this->top);
+			this->top = previous;
+		}
+		this->position = mark;
+	}
+};
+
+//! Transcodes UTF-16 text to UTF-8.
+//!
+//! Unpaired surrogates are replaced with U+FFFD.
+//!
+//! @param source      Pointer to the first UTF-16 code unit.
+//! @param length      Number of code units.
+//! @param destination Pointer to the buffer that can fit at least 3 bytes per code unit plus the
+//!                    terminating null.
+//!
+//! @returns Number of bytes that were written, not including the terminating null.
+static size_t Utf16ToUtf8(const mono_unichar2 *source, int length, char *destination)
+{
+	char *current = destination;
+	int i = 0;
+	while (i < length)
+	{
+		// Most texts that are passed to the engine are ASCII, so they are copied 8 code units at a time.
+		__m128i nonAsciiMask = _mm_set1_epi16(short(0xFF80));
+		while (i + 8 <= length)
+		{
+			__m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+			__m128i nonAscii = _mm_cmpeq_epi16(_mm_and_si128(units, nonAsciiMask), _mm_setzero_si128());
+			if (_mm_movemask_epi8(nonAscii) != 0xFFFF)
+			{
+				break;
+			}
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(current), _mm_packus_epi16(units, units));
+			current += 8;
+			i += 8;
+		}
+		if (i >= length)
+		{
+			break;
+		}
+
+		unsigned int unit = source[i++];
+		if (unit < 0x80)
+		{
+			*current++ = char(unit);
+			continue;
+		}
+		if (unit < 0x800)
+		{
+			*current++ = char(0xC0 | (unit >> 6));
+			*current++ = char(0x80 | (unit & 0x3F));
+			continue;
+		}
+		if (unit >= 0xD800 && unit < 0xDC00 && i < length && source[i] >= 0xDC00 && source[i] < 0xE000)
+		{
+			unsigned int codePoint = 0x10000 + ((unit - 0xD800) << 10) + (source[i++] - 0xDC00);
+			*current++ = char(0xF0 | (codePoint >> 18));
+			*current++ = char(0x80 | ((codePoint >> 12) & 0x3F));
+			*current++ = char(0x80 | ((codePoint >> 6) & 0x3F));
+			*current++ = char(0x80 | (codePoint & 0x3F));
+			continue;
+		}
+		if (unit >= 0xD800 && unit < 0xE000)
+		{
+			unit = 0xFFFD;
+		}
+		*current++ = char(0xE0 | (unit >> 12));
+		*current++ = char(0x80 | ((unit >> 6) & 0x3F));
+		*current++ = char(0x80 | (unit & 0x3F));
+	}
+	*current = '\0';
+	return current - destination;
+}
+
+MonoTextCache::MonoTextCache()
+	: mask(0)
+	, freeEntries(-1)
+	, liveEntries(0)
+	, hand(0)
+	, memoryUsage(0)
+	, hits(0)
+	, misses(0)
+	, evictions(0)
+	, MemoryLimit(1024)
+{
+}
+
+MonoTextCache::~MonoTextCache()
+{
+	this->Clear();
+}
+
+mono::string MonoTextCache::Get(const char *text)
+{
+	if (!text)
+	{
+		return nullptr;
+	}
+
+	size_t length;
+	unsigned int hash = Hash(text, length);
+
+	std::lock_guard<std::mutex> guard(this->lock);
+
+	if (!this->buckets.Empty)
+	{
+		for (int i = this->buckets[hash & this->mask]; i != -1; i = this->entries[i].Next)
+		{
+			Entry &entry = this->entries[i];
+			if (entry.Hash == hash && entry.Length == length && memcmp(entry.Text, text, length) == 0)
+			{
+				entry.Used = true;
+				this->hits++;
+				return mono::string(mono_gchandle_get_target(entry.Handle));
+			}
+		}
+	}
+
+	this->misses++;
+
+	MonoString *str = mono_string_new(mono_domain_get(), text);
+
+	// Size of the managed string is estimated as a header plus UTF-16 characters.
+	size_t size = sizeof(Entry) + length + 1 + sizeof(MonoObject) + sizeof(int) +
+		(mono_string_length(str) + 1) * sizeof(mono_unichar2);
+	size_t limit = this->MemoryLimit > 0 ? size_t(this->MemoryLimit) * 1024 : 0;
+	if (size > limit)
+	{
+		// The limit could have been lowered since the last call.
+		this->Trim(limit);
+		return mono::string(str);
+	}
+	this->Trim(limit - size);
+
+	int index;
+	if (this->freeEntries != -1)
+	{
+		index = this->freeEntries;
+		this->freeEntries = this->entries[index].Next;
+	}
+	else
+	{
+		index = int(this->entries.Length);
+		this->entries.Add(Entry());
+	}
+
+	if (int(this->buckets.Length) < (this->liveEntries + 1) * 2)
+	{
+		this->Rehash(this->buckets.Empty ? 64 : int(this->buckets.Length) * 2);
+	}
+
+	Entry &entry = this->entries[index];
+	entry.Hash   = hash;
+	entry.Handle = mono_gchandle_new(reinterpret_cast<MonoObject *>(str), false);
+	entry.Used   = false;
+	entry.Length = length;
+	entry.Size   = size;
+	entry.Text   = new char[length + 1];
+	memcpy(entry.Text, text, length + 1);
+
+	unsigned int bucket = hash & this->mask;
+	entry.Next = this->buckets[bucket];
+	this->buckets[bucket] = index;
+
+	this->liveEntries++;
+	this->memoryUsage += size;
+
+	return mono::string(str);
+}
+
+void MonoTextCache::Clear()
+{
+	std::lock_guard<std::mutex> guard(this->lock);
+
+	this->Trim(0);
+}
+
+void MonoTextCache::Report()
+{
+	std::lock_guard<std::mutex> guard(this->lock);
+
+	unsigned __int64 lookups = this->hits + this->misses;
+	CryLogAlways("%d texts are cached, %u of %u bytes are used.", this->liveEntries,
+				 unsigned(this->memoryUsage), unsigned(this->MemoryLimit > 0 ? this->MemoryLimit : 0) * 1024);
+	CryLogAlways("%llu hits, %llu misses (%.1f%% hit rate), %llu evictions.", this->hits, this->misses,
+				 lookups ? 100.0 * this->hits / lookups : 0.0, this->evictions);
+}
+
+// FNV-1a hash of the text.
+unsigned int MonoTextCache::Hash(const char *text, size_t &length)
+{
+	unsigned int hash = 2166136261u;
+	const char *c = text;
+	for (; *c; c++)
+	{
+		hash = (hash ^ static_cast<unsigned char>(*c)) * 16777619u;
+	}
+	length = c - text;
+	return hash;
+}
+
+void MonoTextCache::Trim(size_t limit)
+{
+	while (this->memoryUsage > limit && this->liveEntries > 0)
+	{
+		if (this->hand >= int(this->entries.Length))
+		{
+			this->hand = 0;
+		}
+
+		Entry &entry = this->entries[this->hand];
+		if (entry.Handle != 0)
+		{
+			if (entry.Used)
+			{
+				// Give the entry a second chance.
+				entry.Used = false;
+			}
+			else
+			{
+				this->Remove(this->hand);
+				this->evictions++;
+			}
+		}
+		this->hand++;
+	}
+}
+
+void MonoTextCache::Remove(int index)
+{
+	Entry &entry = this->entries[index];
+
+	// Unlink the entry from its bucket.
+	int *link = &this->buckets[entry.Hash & this->mask];
+	while (*link != index)
+	{
+		link = &this->entries[*link].Next;
+	}
+	*link = entry.Next;
+
+	mono_gchandle_free(entry.Handle);
+	delete[] entry.Text;
+
+	this->memoryUsage -= entry.Size;
+	this->liveEntries--;
+
+	entry.Handle = 0;
+	entry.Text   = nullptr;
+	entry.Next   = this->freeEntries;
+	this->freeEntries = index;
+}
+
+void MonoTextCache::Rehash(int bucketCount)
+{
+	this->buckets.Clear();
+	this->buckets.Reserve(bucketCount);
+	for (int i = 0; i < bucketCount; i++)
+	{
+		this->buckets.Add(-1);
+	}
+	this->mask = static_cast<unsigned int>(bucketCount - 1);
+
+	for (int i = 0; i < int(this->entries.Length); i++)
+	{
+		Entry &entry = this->entries[i];
+		if (entry.Handle != 0)
+		{
+			unsigned int bucket = entry.Hash & this->mask;
+			entry.Next = this->buckets[bucket];
+			this->buckets[bucket] = i;
+		}
+	}
+}
+
+MonoTexts::MonoTexts()
+{
+	if (gEnv && gEnv->pConsole)
+	{
+		gEnv->pConsole->Register("cil_TextCacheMemoryLimit", &this->cache.MemoryLimit, this->cache.MemoryLimit,
+								 VF_NULL, "Maximal number of kilobytes that can be taken by managed strings that "
+								 "are cached for frequently converted native texts. 0 - disable the cache.");
+		gEnv->pConsole->AddCommand("cil_TextCacheReport", ReportTextCache, VF_NULL,
+								   "Prints number of cached managed strings, memory usage and hit rate of the "
+								   "cache.");
+	}
+}
+
+MonoTexts::~MonoTexts()
+{
+	if (gEnv && gEnv->pConsole)
+	{
+		gEnv->pConsole->UnregisterVariable("cil_TextCacheMemoryLimit", true);
+		gEnv->pConsole->RemoveCommand("cil_TextCacheReport");
+	}
+}
+
+void MonoTexts::ReportTextCache(IConsoleCmdArgs *)
+{
+	static_cast<MonoTexts *>(MonoEnv->Objects->Texts)->cache.Report();
+}
+
 mono::string MonoTexts::ToManaged(const char *text)
 {
 	return mono::string(mono_string_new(mono_domain_get(), text));
@@ -19,6 +393,11 @@ mono::string MonoTexts::ToManaged(const wchar_t *text)
 		reinterpret_cast<const mono_unichar2 *>(text), wcslen(text)));
 }
 
+mono::string MonoTexts::ToManagedCached(const char *text)
+{
+	return this->cache.Get(text);
+}
+
 const char *MonoTexts::ToNative(mono::string text)
 {
 	if (!text)
@@ -28,23 +407,15 @@ const char *MonoTexts::ToNative(mono::string text)
 
 	TextsMessage("Getting the unmanaged version of text.");
 
-	MonoError er;
-	char *t = mono_string_to_utf8_checked(reinterpret_cast<MonoString *>(text), &er);
-	if (!mono_error_ok(&er))
-	{
-		gEnv->pLog->LogError("%s", mono_error_get_message(&er));
-		return nullptr;
-	}
-
-	TextsMessage("Got the unmanaged version of text.");
+	MonoString *str = reinterpret_cast<MonoString *>(text);
+	int length = mono_string_length(str);
 
-	int length = strlen(t);
-	char *chars = new char[length];
-	memcpy(chars, t, length * sizeof(char));
+	char *chars = new char[length * 3 + 1];
+	Utf16ToUtf8(mono_string_chars(str), length, chars);
 
-	mono_free(t);
+	TextsMessage("Got the unmanaged version of text.");
 
-	return t;
+	return chars;
 }
 
 const wchar_t *MonoTexts::ToNative16(mono::string text)
@@ -54,19 +425,39 @@ const wchar_t *MonoTexts::ToNative16(mono::string text)
 		return nullptr;
 	}
 
-	wchar_t *chars = reinterpret_cast<wchar_t *>(mono_string_to_utf16(reinterpret_cast<MonoString *>(text)));
-
-	int length = wcslen(chars);
+	MonoString *str = reinterpret_cast<MonoString *>(text);
+	int length = mono_string_length(str);
 
 	wchar_t *t = new wchar_t[length + 1];
+	memcpy(t, mono_string_chars(str), length * sizeof(wchar_t));
+	t[length] = '\0';
 
-	for (int i = 0; i < length; i++)
+	return t;
+}
+
+const char *MonoTexts::ToScratch(mono::string text, size_t &mark)
+{
+	TextScratch &scratch = TextScratch::Current();
+	mark = scratch.position;
+
+	if (!text)
 	{
-		t[i] = chars[i];
+		return nullptr;
 	}
-	t[length] = '\0';
 
-	mono_free(chars);
+	MonoString *str = reinterpret_cast<MonoString *>(text);
+	int length = mono_string_length(str);
 
-	return t;
+	char *chars = scratch.Reserve(length * 3 + 1);
+	scratch.Commit(Utf16ToUtf8(mono_string_chars(str), length, chars) + 1);
+	return chars;
+}
+
+void MonoTexts::ReleaseScratch(size_t mark)
+{
+	TextScratch &scratch = TextScratch::Current();
+	if (scratch.top)
+	{
+		scratch.Release(mark);
+	}
 }
@@ -2,11 +2,75 @@
 
 #include "IMonoInterface.h"
 
+#include <mutex>
+
+//! Represents a cache of managed strings that were created from native texts.
+//!
+//! Entries are found by contents of the native text rather than by its address, since the memory that held
+//! one text can be reused for another one. Every entry keeps its managed string alive with a strong GC
+//! handle. When the memory limit is reached, entries are evicted using the clock algorithm: every hit
+//! marks the entry as used, and the clock hand clears that mark once before evicting the entry.
+class MonoTextCache
+{
+	struct Entry
+	{
+		unsigned int Hash;
+		unsigned int Handle;		//!< Strong GC handle of the managed string, 0, if the entry is free.
+		bool         Used;			//!< Indicates whether the entry was hit since the clock hand passed it.
+		int          Next;			//!< Index of the next entry in the bucket or in the list of free entries.
+		size_t       Length;
+		size_t       Size;			//!< Number of bytes that are taken by the entry.
+		char        *Text;
+	};
+
+	std::mutex lock;
+	List<Entry> entries;
+	List<int> buckets;				//!< Indexes of first entries in the buckets, -1 marks an empty bucket.
+	unsigned int mask;
+	int freeEntries;				//!< Index of the first free entry, or -1.
+	int liveEntries;
+	int hand;
+	size_t memoryUsage;
+	unsigned __int64 hits;
+	unsigned __int64 misses;
+	unsigned __int64 evictions;
+public:
+	//! Maximal number of kilobytes that can be taken by the cache. Bound to cil_TextCacheMemoryLimit.
+	int MemoryLimit;
+
+	MonoTextCache();
+	~MonoTextCache();
+
+	//! Gets the cached managed string that contains given text, or creates and caches a new one.
+	mono::string Get(const char *text);
+	//! Releases all cached strings.
+	void Clear();
+	//! Prints the statistics of the cache.
+	void Report();
+private:
+	static unsigned int Hash(const char *text, size_t &length);
+	//! Evicts entries until memory usage drops to the limit.
+	void Trim(size_t limit);
+	void Remove(int index);
+	void Rehash(int bucketCount);
+};
+
 struct MonoTexts : public IMonoTexts
 {
+	MonoTextCache cache;
+
+	MonoTexts();
+	~MonoTexts();
+
 	mono::string ToManaged(const char *text) override;
 	mono::string ToManaged(const wchar_t *text) override;
+	mono::string ToManagedCached(const char *text) override;
 
 	const char    *ToNative(mono::string text) override;
 	const wchar_t *ToNative16(mono::string text) override;
-};
\ No newline at end of file
+
+	const char *ToScratch(mono::string text, size_t &mark) override;
+	void        ReleaseScratch(size_t mark) override;
+
+	static void ReportTextCache(IConsoleCmdArgs *);
+};
@@ -0,0 +1,535 @@
+#pragma once
+
+#include "List.hpp"
+
+//! Represents a dynamic array that keeps up to a certain number of elements inside itself.
+//!
+//! Unlike List`2, this type has no reference-counted header and doesn't allocate anything until more than
+//! InlineCapacity elements are added to it, which makes it a better fit for short-lived lists that are
+//! created on the stack. Copying the list copies its elements, and moving the list that didn't spill its
+//! elements into the heap moves the elements one by one.
+//!
+//! Most functions mirror the ones of List`2, so the call sites can switch between them by changing the
+//! declaration. Pointers to elements are used instead of iterators.
+//!
+//! @tparam ElementType    Type of objects that are going to be contained within this array.
+//! @tparam InlineCapacity Number of elements that are kept inside the object.
+//! @tparam AllocatorType  Type of object to use to allocate and deallocate memory when elements don't fit
+//!                        inside the object, and to initialize and destroy objects.
+template<typename ElementType, size_t InlineCapacity, typename AllocatorType = DefaultAllocator<ElementType>>
+class InlineList
+{
+	static_assert(InlineCapacity > 0, "Inline capacity of the list must be positive.");
+public:
+	typedef ElementType value_type;
+	typedef ElementType &reference;
+	typedef const ElementType &const_reference;
+	typedef ElementType *pointer;
+	typedef const ElementType *const_pointer;
+
+	typedef size_t size_type;
+	typedef ptrdiff_t difference_type;
+
+	typedef AllocatorType allocator_type;
+
+private:
+	typename std::aligned_storage<sizeof(value_type) * InlineCapacity, alignof(value_type)>::type buffer;
+	pointer first;				//!< Pointer to the first element.
+	pointer last;				//!< Pointer to the element after the last live one.
+	pointer storageEnd;			//!< Pointer to the element after the end of the storage.
+	allocator_type allocator;
+
+	pointer InlineBuffer()
+	{
+		return reinterpret_cast<pointer>(&this->buffer);
+	}
+	const_pointer InlineBuffer() const
+	{
+		return reinterpret_cast<const_pointer>(&this->buffer);
+	}
+
+public:
+	//! Gets the object that is used to allocate and deallocate memory, and initialize and destroy objects.
+	const allocator_type &Allocator() const
+	{
+		return this->allocator;
+	}
+
+	//! Gets the pointer to the first element in the list.
+	pointer First()
+	{
+		return this->first;
+	}
+	const_pointer First() const
+	{
+		return this->first;
+	}
+	//! Gets the pointer to the element after last live object in the list.
+	pointer Last()
+	{
+		return this->last;
+	}
+	const_pointer Last() const
+	{
+		return this->last;
+	}
+
+	//! Gets the number of live objects that can fit into this list before it has to expand.
+	__declspec(property(get = GetCapacity)) size_type Capacity;
+	size_type GetCapacity() const
+	{
+		return this->storageEnd - this->first;
+	}
+	//! Gets the number of live objects that can be added to this list before it has to expand.
+	__declspec(property(get = GetUnusedCapacity)) size_type UnusedCapacity;
+	size_type GetUnusedCapacity() const
+	{
+		return this->storageEnd - this->last;
+	}
+	//! Gets the number of live objects that are currently currently contained within this list.
+	__declspec(property(get = GetLength)) size_type Length;
+	size_type GetLength() const
+	{
+		return this->last - this->first;
+	}
+	//! Indicates whether this list is empty.
+	__declspec(property(get = IsEmpty)) bool Empty;
+	bool IsEmpty() const
+	{
+		return this->last == this->first;
+	}
+	//! Indicates whether elements of this list are kept inside the object.
+	__declspec(property(get = IsInline)) bool Inline;
+	bool IsInline() const
+	{
+		return this->first == this->InlineBuffer();
+	}
+
+	//! Provides read/write access to the element in the list.
+	//!
+	//! @param index Zero-based index of the element to access.
+	reference operator [](size_type index)
+	{
+#ifdef DEBUG_ITERATION
+		if (index >= this->Length)
+		{
+			throw std::out_of_range("Attempted to access an element outside the list.");
+		}
+#endif // DEBUG_ITERATION
+		return this->first[index];
+	}
+	//! Provides read-only access to the element in the list.
+	//!
+	//! @param index Zero-based index of the element to access.
+	const_reference operator[](size_type index) const
+	{
+#ifdef DEBUG_ITERATION
+		if (index >= this->Length)
+		{
+			throw std::out_of_range("Attempted to access an element outside the list.");
+		}
+#endif // DEBUG_ITERATION
+		return this->first[index];
+	}
+
+	//! Creates an empty list.
+	InlineList(const allocator_type &allocator = allocator_type())
+		: first(this->InlineBuffer())
+		, last(this->first)
+		, storageEnd(this->first + InlineCapacity)
+		, allocator(allocator)
+	{
+	}
+	//! Creates an empty list that can fit specified number of elements without expanding.
+	//!
+	//! @param initialCapacity Number of elements to make space for. Nothing is allocated, if they fit inside
+	//!                        the object.
+	explicit InlineList(size_type initialCapacity, const allocator_type &allocator = allocator_type())
+		: first(this->InlineBuffer())
+		, last(this->first)
+		, storageEnd(this->first + InlineCapacity)
+		, allocator(allocator)
+	{
+		this->EnsureCapacity(initialCapacity);
+	}
+	//! Creates a list out of the brace initialization list.
+	InlineList(std::initializer_list<value_type> elements, const allocator_type &allocator = allocator_type())
+		: first(this->InlineBuffer())
+		, last(this->first)
+		, storageEnd(this->first + InlineCapacity)
+		, allocator(allocator)
+	{
+		this->AddRange(elements.begin(), elements.end());
+	}
+	//! Creates a copy of another list.
+	InlineList(const InlineList &other)
+		: first(this->InlineBuffer())
+		, last(this->first)
+		, storageEnd(this->first + InlineCapacity)
+		, allocator(other.allocator)
+	{
+		this->AddRange(other.first, other.last);
+	}
+	//! Moves contents of the temporary list into the new one.
+	InlineList(InlineList &&other)
+		: first(this->InlineBuffer())
+		, last(this->first)
+		, storageEnd(this->first + InlineCapacity)
+		, allocator(other.allocator)
+	{
+		this->Steal(other);
+	}
+	~InlineList()
+	{
+		this->Clear();
+		this->ReleaseStorage();
+	}
+
+	//! Assigns a copy of another list to this one.
+	InlineList &operator =(const InlineList &other)
+	{
+		if (this != &other)
+		{
+			this->Clear();
+			this->AddRange(other.first, other.last);
+		}
+		return *this;
+	}
+	//! Moves contents of the temporary list into this one.
+	InlineList &operator =(InlineList &&other)
+	{
+		if (this != &other)
+		{
+			this->Clear();
+			this->ReleaseStorage();
+			this->Steal(other);
+		}
+		return *this;
+	}
+	//! Assigns contents of the brace initialization list to this one.
+	InlineList &operator =(std::initializer_list<value_type> items)
+	{
+		this->Clear();
+		this->AddRange(items.begin(), items.end());
+		return *this;
+	}
+
+	//! Removes all live objects from this list.
+	void Clear()
+	{
+		this->allocator.DeinitializeRange(this->first, this->last);
+		this->last = this->first;
+	}
+	//! Ensure that this list can fit specified number of elements.
+	//!
+	//! The capacity grows exponentially.
+	//!
+	//! @param capacity The number of objects that must fit into this list before it has to expand after this
+	//!                 method is done.
+	void EnsureCapacity(size_type capacity)
+	{
+		if (this->Capacity < capacity)
+		{
+			size_type newCapacity = this->Capacity + this->Capacity / 2;
+			this->Reallocate(newCapacity < capacity ? capacity : newCapacity);
+		}
+	}
+	//! Ensures that this list can have _count_ items added to it.
+	//!
+	//! @param count The number of objects that must be allowed to be added to this list without it having
+	//!              to expand after this method is done.
+	void Reserve(size_type count)
+	{
+		this->EnsureCapacity(count + this->Length);
+	}
+
+	//! Copies an element into the end of the list.
+	//!
+	//! @param item Reference to the object to copy into this list.
+	void Add(const_reference item)
+	{
+		if (this->last == this->storageEnd)
+		{
+			// The item can be an element of this list, so it's copied before the storage is moved.
+			value_type copy(item);
+			this->Reserve(1);
+			this->allocator.Initialize(this->last, std::move(copy));
+		}
+		else
+		{
+			this->allocator.Initialize(this->last, item);
+		}
+		this->last++;
+	}
+	//! Moves an element into the end of this list.
+	//!
+	//! @param item Reference to the object to move into this list.
+	void Add(value_type &&item)
+	{
+		if (this->last == this->storageEnd)
+		{
+			value_type temporary(std::move(item));
+			this->Reserve(1);
+			this->allocator.Initialize(this->last, std::move(temporary));
+		}
+		else
+		{
+			this->allocator.Initialize(this->last, std::move(item));
+		}
+		this->last++;
+	}
+	//! Adds an item to the end of this list.
+	InlineList &operator <<(const_reference item)
+	{
+		this->Add(item);
+		return *this;
+	}
+	//! Adds an item to the end of this list.
+	InlineList &operator <<(value_type &&item)
+	{
+		this->Add(std::move(item));
+		return *this;
+	}
+	//! Adds a range of elements to the end of this list.
+	//!
+	//! @param left  Pointer or iterator to the first element to add.
+	//! @param right Pointer or iterator to the element after the last one to add.
+	template<typename IteratorType>
+	void AddRange(IteratorType left, IteratorType right)
+	{
+		for (; left != right; ++left)
+		{
+			this->Add(*left);
+		}
+	}
+	//! Adds contents of the brace initialization list to the end of this list.
+	void AddRange(std::initializer_list<value_type> items)
+	{
+		this->AddRange(items.begin(), items.end());
+	}
+	//! Constructs a new element at the end of this list.
+	//!
+	//! @param arguments A sequence of arguments to pass to the constructor of the new element.
+	template<typename... ArgumentTypes>
+	void Make(ArgumentTypes &&... arguments)
+	{
+		if (this->last == this->storageEnd)
+		{
+			value_type temporary(std::forward<ArgumentTypes>(arguments)...);
+			this->Reserve(1);
+			this->allocator.Initialize(this->last, std::move(temporary));
+		}
+		else
+		{
+			this->allocator.Initialize(this->last, std::forward<ArgumentTypes>(arguments)...);
+		}
+		this->last++;
+	}
+	//! Inserts a copy of the element into this list.
+	//!
+	//! @param index Zero-based index of the position to insert the element at.
+	//! @param item  Reference to the object to copy into this list.
+	void Insert(size_type index, const_reference item)
+	{
+		this->Emplace(index, item);
+	}
+	//! Moves an element into this list.
+	//!
+	//! @param index Zero-based index of the position to insert the element at.
+	//! @param item  Reference to the object to move into this list.
+	void Insert(size_type index, value_type &&item)
+	{
+		this->Emplace(index, std::move(item));
+	}
+	//! Constructs a new element at specified position within this list.
+	//!
+	//! @param index     Zero-based index of the position to construct the element at.
+	//! @param arguments A sequence of arguments to pass to the constructor of the new element.
+	template<typename... ArgumentTypes>
+	void Emplace(size_type index, ArgumentTypes &&... arguments)
+	{
+#ifdef DEBUG_ITERATION
+		if (index > this->Length)
+		{
+			throw std::out_of_range("Attempted to insert an element outside the list.");
+		}
+#endif // DEBUG_ITERATION
+		// Arguments can refer to elements of this list, so the element is created before they are shifted.
+		value_type item(std::forward<ArgumentTypes>(arguments)...);
+		this->Reserve(1);
+
+		pointer position = this->first + index;
+		for (pointer current = this->last; current != position; current--)
+		{
+			this->allocator.Initialize(current, std::move(current[-1]));
+			this->allocator.Deinitialize(current - 1);
+		}
+		this->allocator.Initialize(position, std::move(item));
+		this->last++;
+	}
+	//! Replaces the element in this list.
+	//!
+	//! @param index Zero-based index of the element to replace.
+	//! @param item  Reference to the object to copy into this list.
+	void Replace(size_type index, const value_type &item)
+	{
+		(*this)[index] = item;
+	}
+	//! Replaces the element in this list.
+	//!
+	//! @param index Zero-based index of the element to replace.
+	//! @param item  Reference to the object to move into this list.
+	void Replace(size_type index, value_type &&item)
+	{
+		(*this)[index] = std::move(item);
+	}
+	//! Removes specified number of elements from the back of this list.
+	//!
+	//! @param count Number of elements to remove.
+	void Cut(size_type count = 1)
+	{
+		if (count > this->Length)
+		{
+			count = this->Length;
+		}
+		this->allocator.DeinitializeRange(this->last - count, this->last);
+		this->last -= count;
+	}
+	//! Removes a range of elements from this list.
+	//!
+	//! @param index Zero-based index of the first element to erase.
+	//! @param count Number of elements to remove.
+	void Erase(size_type index, size_type count)
+	{
+#ifdef DEBUG_ITERATION
+		if (index + count > this->Length)
+		{
+			throw std::out_of_range("Attempted to remove elements outside the list.");
+		}
+#endif // DEBUG_ITERATION
+		std::move(this->first + index + count, this->last, this->first + index);
+		this->Cut(count);
+	}
+	//! Removes an element from this list.
+	//!
+	//! @param index Zero-based index of the element to erase.
+	void Erase(size_type index)
+	{
+		this->Erase(index, 1);
+	}
+	//! Shrinks the capacity of this list to be exact fit for all live objects currently in it, or moves them
+	//! back inside the object, if they fit there.
+	void Trim()
+	{
+		if (!this->IsInline() && this->UnusedCapacity != 0)
+		{
+			this->Reallocate(this->Length);
+		}
+	}
+	//! Performs a linear search for the element using the equality operator ==.
+	//!
+	//! @param value Value to look for in this list.
+	//!
+	//! @returns True, if a value was found in the list, otherwise false.
+	template<typename ValType>
+	bool Contains(ValType &&value) const
+	{
+		return this->IndexOf(std::forward<ValType>(value)) >= 0;
+	}
+	//! Performs a linear search for the element using the equality operator ==.
+	//!
+	//! @param value Value to look for in this list.
+	//!
+	//! @returns Zero-based index of the first element that is equal to the value, or -1, if there is none.
+	template<typename ValType>
+	difference_type IndexOf(ValType &&value) const
+	{
+		for (const_pointer current = this->first; current != this->last; current++)
+		{
+			if (*current == value)
+			{
+				return current - this->first;
+			}
+		}
+		return -1;
+	}
+	//! Creates a List`2 with copies of elements of this list.
+	List<value_type, allocator_type> ToList() const
+	{
+		List<value_type, allocator_type> list(this->Length, this->allocator);
+		list.AddRange(this->first, this->last);
+		return list;
+	}
+
+	pointer begin()
+	{
+		return this->first;
+	}
+	pointer end()
+	{
+		return this->last;
+	}
+	const_pointer begin() const
+	{
+		return this->first;
+	}
+	const_pointer end() const
+	{
+		return this->last;
+	}
+private:
+	// Moves elements into the storage of specified capacity, which is inside the object, when they fit.
+	void Reallocate(size_type capacity)
+	{
+		pointer storage = capacity <= InlineCapacity ? this->InlineBuffer() : this->allocator.Allocate(capacity);
+		if (storage == this->first)
+		{
+			return;
+		}
+
+		size_type length = this->Length;
+		for (size_type i = 0; i < length; i++)
+		{
+			this->allocator.Initialize(storage + i, std::move(this->first[i]));
+			this->allocator.Deinitialize(this->first + i);
+		}
+
+		this->ReleaseStorage();
+		this->first = storage;
+		this->last = storage + length;
+		this->storageEnd = storage + (storage == this->InlineBuffer() ? InlineCapacity : capacity);
+	}
+	// Deallocates the storage, if it's on the heap.
+	void ReleaseStorage()
+	{
+		if (!this->IsInline())
+		{
+			this->allocator.Deallocate(this->first);
+		}
+	}
+	// Takes the contents of the list that was released or is empty.
+	void Steal(InlineList &other)
+	{
+		if (other.IsInline())
+		{
+			this->first = this->InlineBuffer();
+			this->last = this->first;
+			this->storageEnd = this->first + InlineCapacity;
+			for (pointer current = other.first; current != other.last; current++)
+			{
+				this->allocator.Initialize(this->last++, std::move(*current));
+			}
+			other.Clear();
+		}
+		else
+		{
+			this->first = other.first;
+			this->last = other.last;
+			this->storageEnd = other.storageEnd;
+
+			other.first = other.InlineBuffer();
+			other.last = other.first;
+			other.storageEnd = other.first + InlineCapacity;
+		}
+	}
+};
@@ -188,10 +188,13 @@ struct IMonoEvent;
 struct IMonoField;
 struct IMonoConstructor;
 struct IMonoSystemListener;
+struct IMonoInteropBase;
 struct IMonoInterface;
 struct MonoGCHandle;
 struct IMonoGC;
 
-template<typename symbol> struct TextTemplate;
-typedef TextTemplate<char> Text;
-typedef TextTemplate<wchar_t> Text16;
\ No newline at end of file
+template<typename symbol, typename ReferenceCountType> struct TextTemplate;
+template<typename CountType> class AtomicReferenceCount;
+typedef TextTemplate<char, int> Text;
+typedef TextTemplate<wchar_t, int> Text16;
+typedef TextTemplate<char, AtomicReferenceCount<int>> SharedText;
\ No newline at end of file
@@ -397,6 +397,13 @@ public:
 	{
 		return MonoEnv->Functions->GetReflectionObject(this->wrappedMethod);
 	}
+protected:
+	//! Gets the unmanaged thunk without logging anything, once it was acquired.
+	__forceinline void *GetCachedUnmanagedThunk() const
+	{
+		return this->unmanagedThunk ? this->unmanagedThunk : this->GetUnmanagedThunk();
+	}
+public:
 
 	virtual const char *GetName() const override
 	{
@@ -228,6 +228,13 @@ struct IMonoFunctions
 
 	//! @see IMonoFunction::UnmanagedThunk property.
 	VIRTUAL_API virtual void        *GetUnmanagedThunk(_MonoMethod *func) = 0;
+	//! Gets the unmanaged thunk of the implementation of the method that is specific to the object.
+	//!
+	//! Implementations and their thunks are cached for every pair of a method and a class of the object.
+	//!
+	//! @param func   Pointer to Mono runtime representation of the method.
+	//! @param object Pointer to the object which class provides the implementation.
+	VIRTUAL_API virtual void        *GetVirtualThunk(_MonoMethod *func, void *object) = 0;
 	//! @see IMonoFunction::RawThunk property.
 	VIRTUAL_API virtual void        *GetRawThunk(_MonoMethod *func) = 0;
 	//! Parses signature of given Mono method and fills a number of lists.
@@ -45,9 +45,23 @@ struct IMonoInteropBase : public IMonoSystemListener
 	virtual void OnRunTimeInitializing() override {}
 	//! When implemented in derived class, initializes interop between CryEngine and Mono.
 	virtual void InitializeInterops() = 0;
+	//! Indicates whether InitializeInterops does nothing but registration of internal calls.
+	//!
+	//! Registration of internal calls is thread-safe, so such interops are initialized on worker threads.
+	//! Interops that acquire thunks, subscribe to events or do anything else must return false.
+	virtual bool IsPureRegistration()
+	{
+		return false;
+	}
 	//! Initiates initialization of the interop.
 	virtual void OnRunTimeInitialized() override
 	{
+		if (this->IsPureRegistration())
+		{
+			MonoEnv->QueueInteropInitialization(this);
+			return;
+		}
+
 		const char *nameSpace = this->GetInteropNameSpace();
 		const char *className = this->GetInteropClassName();
 
@@ -71,7 +85,10 @@ struct IMonoInteropBase : public IMonoSystemListener
 			CryLogAlways("Commencing initialization of interops for type %s.%s.", nameSpace, className);
 		}
 
+		// Interops that rely on MonoEnv don't have the internal field set.
+		MonoEnv->BeginStartupPhase(noNameSpace ? "Interops" : nameSpace, noClass ? "Multiple types" : className);
 		this->InitializeInterops();
+		MonoEnv->EndStartupPhase();
 
 		if (noNameSpace && noClass)
 		{
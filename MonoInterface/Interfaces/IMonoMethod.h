@@ -73,6 +73,51 @@ public:
 	//! @example DoxygenExampleFiles\MonoMethodInvocations.h
 	VIRTUAL_API virtual mono::object Invoke(void *object, void **params, mono::exception *exc = nullptr,
 											bool polymorph = false) const = 0;
+	//! Invokes this method through its unmanaged thunk.
+	//!
+	//! Arguments are passed as they are, without boxing, so their types must match the signature of the
+	//! method the same way they would in a typedef of the thunk. Use explicit template arguments, when the
+	//! types of arguments cannot be deduced correctly.
+	//!
+	//! @tparam ResultType    Type of the value that is returned by the method.
+	//! @tparam ArgumentTypes Types of arguments that are passed to the method.
+	//!
+	//! @param object The instance to invoke the method on. Instances of value types must be boxed.
+	//! @param exc    A pointer to the exception object that will hold a reference to the unhandled
+	//!               exception that could have been raised during method's execution. Cannot be null.
+	//! @param args   Arguments to pass to the method.
+	//!
+	//! @returns Result of execution, if no unhandled exception was thrown.
+	template<typename ResultType, typename... ArgumentTypes>
+	ResultType Call(mono::object object, mono::exception *exc, ArgumentTypes... args) const
+	{
+		typedef ResultType(__stdcall *ThunkType)(mono::object, ArgumentTypes..., mono::exception *);
+
+		return reinterpret_cast<ThunkType>(this->GetCachedUnmanagedThunk())(object, args..., exc);
+	}
+	//! Invokes the implementation of this method that is specific to the instance through its unmanaged
+	//! thunk.
+	//!
+	//! Implementations and their thunks are cached for every class, so only the first invocation for
+	//! objects of a certain class has to look them up.
+	//!
+	//! @tparam ResultType    Type of the value that is returned by the method.
+	//! @tparam ArgumentTypes Types of arguments that are passed to the method.
+	//!
+	//! @param object The instance to invoke the method on. Instances of value types must be boxed.
+	//! @param exc    A pointer to the exception object that will hold a reference to the unhandled
+	//!               exception that could have been raised during method's execution. Cannot be null.
+	//! @param args   Arguments to pass to the method.
+	//!
+	//! @returns Result of execution, if no unhandled exception was thrown.
+	template<typename ResultType, typename... ArgumentTypes>
+	ResultType CallVirtual(mono::object object, mono::exception *exc, ArgumentTypes... args) const
+	{
+		typedef ResultType(__stdcall *ThunkType)(mono::object, ArgumentTypes..., mono::exception *);
+
+		void *thunk = MonoEnv->Functions->GetVirtualThunk(this->wrappedMethod, object);
+		return reinterpret_cast<ThunkType>(thunk)(object, args..., exc);
+	}
 };
 
 __forceinline const IMonoMethod *IMonoFunction::ToInstance() const
@@ -50,6 +50,28 @@ public:
 	//!          If result is of value-type, it's boxed.
 	//! @example DoxygenExampleFiles\MonoMethodInvocations.h
 	VIRTUAL_API virtual mono::object Invoke(void **params, mono::exception *exc = nullptr) const = 0;
+	//! Invokes this method through its unmanaged thunk.
+	//!
+	//! Arguments are passed as they are, without boxing, so their types must match the signature of the
+	//! method the same way they would in a typedef of the thunk: value-type objects are passed by value,
+	//! ref and out parameters are passed as pointers, and references to objects as mono::object and similar
+	//! types. Use explicit template arguments, when the types of arguments cannot be deduced correctly.
+	//!
+	//! @tparam ResultType    Type of the value that is returned by the method.
+	//! @tparam ArgumentTypes Types of arguments that are passed to the method.
+	//!
+	//! @param exc  A pointer to the exception object that will hold a reference to the unhandled exception
+	//!             that could have been raised during method's execution. Cannot be null.
+	//! @param args Arguments to pass to the method.
+	//!
+	//! @returns Result of execution, if no unhandled exception was thrown.
+	template<typename ResultType, typename... ArgumentTypes>
+	ResultType Call(mono::exception *exc, ArgumentTypes... args) const
+	{
+		typedef ResultType(__stdcall *ThunkType)(ArgumentTypes..., mono::exception *);
+
+		return reinterpret_cast<ThunkType>(this->GetCachedUnmanagedThunk())(args..., exc);
+	}
 };
 
 __forceinline const IMonoStaticMethod *IMonoFunction::ToStatic() const
@@ -9,6 +9,13 @@ struct IMonoTexts
 	VIRTUAL_API virtual mono::string ToManaged(const char *text) = 0;
 	//! Converts given null-terminated string to Mono managed object.
 	VIRTUAL_API virtual mono::string ToManaged(const wchar_t *text) = 0;
+	//! Gets managed string that contains given text from the cache of frequently converted texts.
+	//!
+	//! The cache keeps the strings alive between calls, so names and other texts that are passed to
+	//! managed code over and over don't create garbage. Size of the cache is limited by
+	//! cil_TextCacheMemoryLimit console variable. Returned object can be shared between multiple callers,
+	//! so it must not be modified.
+	VIRTUAL_API virtual mono::string ToManagedCached(const char *text) = 0;
 	//! Converts given managed string to null-terminated one using UTF-8 encoding.
 	//!
 	//! The result must be deleted when not needed anymore.
@@ -17,4 +24,16 @@ struct IMonoTexts
 	//!
 	//! The result must be deleted when not needed anymore.
 	VIRTUAL_API virtual const wchar_t *ToNative16(mono::string text) = 0;
+	//! Converts given managed string to null-terminated one using UTF-8 encoding and puts it into the
+	//! scratch memory of the calling thread.
+	//!
+	//! The result must not be deleted, it stays valid until ReleaseScratch is called with the mark that
+	//! was returned along with it. Use ScratchText objects instead of calling this function directly.
+	//!
+	//! @param text Managed string to convert.
+	//! @param mark Receives position of the scratch memory before the conversion.
+	VIRTUAL_API virtual const char *ToScratch(mono::string text, size_t &mark) = 0;
+	//! Releases the scratch memory of the calling thread that was taken after the mark was returned by
+	//! ToScratch.
+	VIRTUAL_API virtual void ReleaseScratch(size_t mark) = 0;
 };
\ No newline at end of file
@@ -32,6 +32,7 @@ public:
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Input.ActionMapping"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	virtual void OnAction(const ActionId& action, int activationMode, float value) override;
 
@@ -37,6 +37,7 @@ struct ActionMapsInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Input.ActionMapping"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void        AddDeviceMapping(SupportedInputDevices device);
 	static IActionMap *CreateActionMap(mono::string name);
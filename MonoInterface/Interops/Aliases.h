@@ -8,6 +8,7 @@ struct AliasesInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Files"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static mono::string Get(mono::string alias, bool returnName);
 	static void         Set(mono::string alias, mono::string value);
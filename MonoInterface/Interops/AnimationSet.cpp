@@ -35,7 +35,7 @@ int AnimationSetInterop::GetAnimIDByName(IAnimationSet *handle, mono::string szA
 
 mono::string AnimationSetInterop::GetNameByAnimID(IAnimationSet *handle, int nAnimationId)
 {
-	return ToMonoString(handle->GetNameByAnimID(nAnimationId));
+	return ToMonoStringCached(handle->GetNameByAnimID(nAnimationId));
 }
 
 int AnimationSetInterop::GetAnimIDByCRC(IAnimationSet *handle, uint animationCRC)
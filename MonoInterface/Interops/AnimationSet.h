@@ -9,6 +9,7 @@ struct AnimationSetInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static uint         GetAnimationCount(IAnimationSet *handle);
 	static int          GetAnimIDByName(IAnimationSet *handle, mono::string szAnimationName);
@@ -8,6 +8,7 @@ struct ArchiveStreamInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Files"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void UpdateFile(mono::object obj, const char *path, byte* data, uint length);
 };
\ No newline at end of file
@@ -18,6 +18,7 @@ struct AttachedObjectsCommonsInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Attachments"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void                ProcessAttachment(IAttachmentObject *handle, IAttachment *pIAttachment);
 	static AABB                GetAabb(IAttachmentObject *handle);
@@ -12,6 +12,7 @@ struct AttachmentManagerInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Attachments"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static ICharacterInstance *GetSkelInstance(IAttachmentManager *handle);
 	static uint         LoadAttachmentList(IAttachmentManager *handle, mono::string pathname);
@@ -25,7 +25,7 @@ void AttachmentProxyInterop::InitializeInterops()
 
 mono::string AttachmentProxyInterop::GetName(IProxy *handle)
 {
-	return ToMonoString(handle->GetName());
+	return ToMonoStringCached(handle->GetName());
 }
 
 uint AttachmentProxyInterop::GetNameCrc(IProxy *handle)
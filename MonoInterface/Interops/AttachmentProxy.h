@@ -10,6 +10,7 @@ struct AttachmentProxyInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Attachments"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static mono::string GetName(IProxy *handle);
 	static uint  GetNameCrc(IProxy *handle);
@@ -10,6 +10,7 @@ struct AttachmentSimulationParametersInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Attachments"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static mono::Array GetProxyNames(SimulationParams *handle);
 	static void SetProxyNames(SimulationParams *handle, mono::Array names);
@@ -11,6 +11,7 @@ struct AttachmentSkinInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Attachments"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void   AddRef(IAttachmentSkin *handle);
 	static void   Release(IAttachmentSkin *handle);
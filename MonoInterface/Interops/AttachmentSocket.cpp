@@ -50,7 +50,7 @@ void AttachmentSocketInterop::Release(IAttachment *handle)
 
 mono::string AttachmentSocketInterop::GetName(IAttachment *handle)
 {
-	return ToMonoString(handle->GetName());
+	return ToMonoStringCached(handle->GetName());
 }
 
 uint32 AttachmentSocketInterop::GetNameCRC(IAttachment *handle)
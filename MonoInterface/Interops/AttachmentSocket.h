@@ -12,6 +12,7 @@ struct AttachmentSocketInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Attachments"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void                 AddRef(IAttachment *handle);
 	static void                 Release(IAttachment *handle);
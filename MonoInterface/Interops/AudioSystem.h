@@ -9,6 +9,7 @@ struct AudioSystemInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Audio"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static CryAudio::Impl::IAudioImpl *CreateNativeImplementationObject(mono::object managedObject);
 	static bool                        GetPreloadRequestId(mono::string name, uint32 &id);
@@ -17,6 +17,7 @@ struct AuxiliaryGeometryInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.DebugServices"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static bool CacheApi();
 
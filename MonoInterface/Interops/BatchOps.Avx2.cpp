@@ -0,0 +1,7 @@
+// This file is compiled with /arch:AVX2 and without precompiled header: nothing from it may be executed,
+// unless BatchOps has confirmed that the processor supports AVX2 and FMA3.
+
+#include "BatchOps.Avx2.h"
+#include "BatchOps.Math.hpp"
+
+const BatchKernelTable Avx2BatchKernels = BATCH_KERNEL_TABLE("AVX2", Avx2Single, Avx2Double);
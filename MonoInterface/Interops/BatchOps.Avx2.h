@@ -0,0 +1,200 @@
+#pragma once
+
+#include <immintrin.h>
+
+// Packs of floating point numbers that are processed with AVX2 and FMA3 instructions.
+//
+// This header must only be included into translation units that are never executed on processors without
+// AVX2 support. See BatchOps.Sse2.h for general notes.
+
+//! Represents a pack of 4 double-precision floating point numbers.
+struct Avx2Double
+{
+	typedef double Scalar;
+	static const int Width = 4;
+
+	__m256d v;
+
+	Avx2Double()
+	{}
+	Avx2Double(__m256d value)
+		: v(value)
+	{}
+	//! Creates a pack where every lane is equal to given value.
+	explicit Avx2Double(double value)
+		: v(_mm256_set1_pd(value))
+	{}
+
+	static Avx2Double Load(const double *ptr)
+	{
+		return _mm256_loadu_pd(ptr);
+	}
+	void Store(double *ptr) const
+	{
+		_mm256_storeu_pd(ptr, this->v);
+	}
+
+	static Avx2Double SignMask()
+	{
+		return _mm256_castsi256_pd(_mm256_set1_epi64x(0x8000000000000000LL));
+	}
+	static Avx2Double Infinity()
+	{
+		return _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff0000000000000LL));
+	}
+	static Avx2Double NaN()
+	{
+		return _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff8000000000000LL));
+	}
+	//! Creates a pack from integral values that are stored as floating point numbers.
+	//!
+	//! Every lane must be within the range of normal exponents.
+	static Avx2Double Pow2(Avx2Double exponent)
+	{
+		__m256i n = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(exponent.v));
+		n = _mm256_add_epi64(n, _mm256_set1_epi64x(1023));
+		return _mm256_castsi256_pd(_mm256_slli_epi64(n, 52));
+	}
+	//! Splits a positive normal number into a mantissa within [0.5; 1) range and exponent.
+	static Avx2Double Frexp(Avx2Double x, Avx2Double &exponent)
+	{
+		__m256i bits = _mm256_castpd_si256(x.v);
+		// Gather lower halves of 64-bit lanes into the lower 128 bits.
+		__m256i e = _mm256_permutevar8x32_epi32(_mm256_srli_epi64(bits, 52),
+												_mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+		exponent = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(e)), _mm256_set1_pd(1022));
+		__m256i mantissa = _mm256_and_si256(bits, _mm256_set1_epi64x(0x800fffffffffffffLL));
+		return _mm256_castsi256_pd(_mm256_or_si256(mantissa, _mm256_set1_epi64x(0x3fe0000000000000LL)));
+	}
+};
+
+inline Avx2Double operator +(Avx2Double a, Avx2Double b) { return _mm256_add_pd(a.v, b.v); }
+inline Avx2Double operator -(Avx2Double a, Avx2Double b) { return _mm256_sub_pd(a.v, b.v); }
+inline Avx2Double operator *(Avx2Double a, Avx2Double b) { return _mm256_mul_pd(a.v, b.v); }
+inline Avx2Double operator /(Avx2Double a, Avx2Double b) { return _mm256_div_pd(a.v, b.v); }
+inline Avx2Double operator &(Avx2Double a, Avx2Double b) { return _mm256_and_pd(a.v, b.v); }
+inline Avx2Double operator |(Avx2Double a, Avx2Double b) { return _mm256_or_pd(a.v, b.v); }
+inline Avx2Double operator ^(Avx2Double a, Avx2Double b) { return _mm256_xor_pd(a.v, b.v); }
+inline Avx2Double operator <(Avx2Double a, Avx2Double b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ); }
+inline Avx2Double operator <=(Avx2Double a, Avx2Double b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ); }
+inline Avx2Double operator >(Avx2Double a, Avx2Double b) { return _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ); }
+inline Avx2Double operator >=(Avx2Double a, Avx2Double b) { return _mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ); }
+inline Avx2Double operator ==(Avx2Double a, Avx2Double b) { return _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ); }
+
+//! Calculates a * b + c.
+inline Avx2Double MulAdd(Avx2Double a, Avx2Double b, Avx2Double c) { return _mm256_fmadd_pd(a.v, b.v, c.v); }
+inline Avx2Double Sqrt(Avx2Double a) { return _mm256_sqrt_pd(a.v); }
+inline Avx2Double Min(Avx2Double a, Avx2Double b) { return _mm256_min_pd(a.v, b.v); }
+inline Avx2Double Max(Avx2Double a, Avx2Double b) { return _mm256_max_pd(a.v, b.v); }
+inline Avx2Double Abs(Avx2Double a) { return _mm256_andnot_pd(Avx2Double::SignMask().v, a.v); }
+//! Picks lanes from a where mask is set, and from b otherwise.
+inline Avx2Double Select(Avx2Double mask, Avx2Double a, Avx2Double b) { return _mm256_blendv_pd(b.v, a.v, mask.v); }
+//! Rounds every lane to the nearest integer.
+inline Avx2Double Round(Avx2Double a) { return _mm256_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+//! Determines whether any lane of the mask is set.
+inline bool Any(Avx2Double mask) { return _mm256_movemask_pd(mask.v) != 0; }
+//! Determines whether all lanes of the mask are set.
+inline bool All(Avx2Double mask) { return _mm256_movemask_pd(mask.v) == 0xf; }
+//! Calculates the rounding error of the product that was calculated as a * b.
+inline Avx2Double ProductError(Avx2Double a, Avx2Double b, Avx2Double product)
+{
+	return _mm256_fmsub_pd(a.v, b.v, product.v);
+}
+
+//! Represents a pack of 8 single-precision floating point numbers.
+struct Avx2Single
+{
+	typedef float Scalar;
+	typedef Avx2Double Wide;
+	static const int Width = 8;
+
+	__m256 v;
+
+	Avx2Single()
+	{}
+	Avx2Single(__m256 value)
+		: v(value)
+	{}
+	//! Creates a pack where every lane is equal to given value.
+	explicit Avx2Single(double value)
+		: v(_mm256_set1_ps(float(value)))
+	{}
+
+	static Avx2Single Load(const float *ptr)
+	{
+		return _mm256_loadu_ps(ptr);
+	}
+	void Store(float *ptr) const
+	{
+		_mm256_storeu_ps(ptr, this->v);
+	}
+
+	static Avx2Single SignMask()
+	{
+		return _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+	}
+	static Avx2Single Infinity()
+	{
+		return _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000));
+	}
+	static Avx2Single NaN()
+	{
+		return _mm256_castsi256_ps(_mm256_set1_epi32(0x7fc00000));
+	}
+	//! Creates a pack from integral values that are stored as floating point numbers.
+	//!
+	//! Every lane must be within the range of normal exponents.
+	static Avx2Single Pow2(Avx2Single exponent)
+	{
+		__m256i n = _mm256_add_epi32(_mm256_cvtps_epi32(exponent.v), _mm256_set1_epi32(127));
+		return _mm256_castsi256_ps(_mm256_slli_epi32(n, 23));
+	}
+	//! Splits a positive normal number into a mantissa within [0.5; 1) range and exponent.
+	static Avx2Single Frexp(Avx2Single x, Avx2Single &exponent)
+	{
+		__m256i bits = _mm256_castps_si256(x.v);
+		__m256i e = _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126));
+		exponent = _mm256_cvtepi32_ps(e);
+		__m256i mantissa = _mm256_and_si256(bits, _mm256_set1_epi32(0x807fffff));
+		return _mm256_castsi256_ps(_mm256_or_si256(mantissa, _mm256_set1_epi32(0x3f000000)));
+	}
+	//! Converts the pack to double precision.
+	static void Widen(Avx2Single x, Avx2Double &low, Avx2Double &high)
+	{
+		low = _mm256_cvtps_pd(_mm256_castps256_ps128(x.v));
+		high = _mm256_cvtps_pd(_mm256_extractf128_ps(x.v, 1));
+	}
+	//! Converts 2 packs of double-precision numbers to a pack of single-precision ones.
+	static Avx2Single Narrow(Avx2Double low, Avx2Double high)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(low.v)), _mm256_cvtpd_ps(high.v), 1);
+	}
+};
+
+inline Avx2Single operator +(Avx2Single a, Avx2Single b) { return _mm256_add_ps(a.v, b.v); }
+inline Avx2Single operator -(Avx2Single a, Avx2Single b) { return _mm256_sub_ps(a.v, b.v); }
+inline Avx2Single operator *(Avx2Single a, Avx2Single b) { return _mm256_mul_ps(a.v, b.v); }
+inline Avx2Single operator /(Avx2Single a, Avx2Single b) { return _mm256_div_ps(a.v, b.v); }
+inline Avx2Single operator &(Avx2Single a, Avx2Single b) { return _mm256_and_ps(a.v, b.v); }
+inline Avx2Single operator |(Avx2Single a, Avx2Single b) { return _mm256_or_ps(a.v, b.v); }
+inline Avx2Single operator ^(Avx2Single a, Avx2Single b) { return _mm256_xor_ps(a.v, b.v); }
+inline Avx2Single operator <(Avx2Single a, Avx2Single b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+inline Avx2Single operator <=(Avx2Single a, Avx2Single b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ); }
+inline Avx2Single operator >(Avx2Single a, Avx2Single b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+inline Avx2Single operator >=(Avx2Single a, Avx2Single b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ); }
+inline Avx2Single operator ==(Avx2Single a, Avx2Single b) { return _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ); }
+
+//! Calculates a * b + c.
+inline Avx2Single MulAdd(Avx2Single a, Avx2Single b, Avx2Single c) { return _mm256_fmadd_ps(a.v, b.v, c.v); }
+inline Avx2Single Sqrt(Avx2Single a) { return _mm256_sqrt_ps(a.v); }
+inline Avx2Single Min(Avx2Single a, Avx2Single b) { return _mm256_min_ps(a.v, b.v); }
+inline Avx2Single Max(Avx2Single a, Avx2Single b) { return _mm256_max_ps(a.v, b.v); }
+inline Avx2Single Abs(Avx2Single a) { return _mm256_andnot_ps(Avx2Single::SignMask().v, a.v); }
+//! Picks lanes from a where mask is set, and from b otherwise.
+inline Avx2Single Select(Avx2Single mask, Avx2Single a, Avx2Single b) { return _mm256_blendv_ps(b.v, a.v, mask.v); }
+//! Rounds every lane to the nearest integer.
+inline Avx2Single Round(Avx2Single a) { return _mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+//! Determines whether any lane of the mask is set.
+inline bool Any(Avx2Single mask) { return _mm256_movemask_ps(mask.v) != 0; }
+//! Determines whether all lanes of the mask are set.
+inline bool All(Avx2Single mask) { return _mm256_movemask_ps(mask.v) == 0xff; }
@@ -0,0 +1,88 @@
+#pragma once
+
+// Declarations of vectorized kernels that are used by BatchOps.
+//
+// This header is included by translation units that are compiled with different instruction set
+// options, so it must not include any engine headers.
+
+enum MathSimpleOperations
+{
+	Sine = 0,
+	Cosine,
+	Tangent,
+	Cotangent,
+	Arcsine,
+	Arccosine,
+	Arctangent,
+	Arccotangent,
+	SineHyperbolic,
+	CosineHyperbolic,
+	TangentHyperbolic,
+	CotangentHyperbolic,
+	ArcsineHyperbolic,
+	ArccosineHyperbolic,
+	ArctangentHyperbolic,
+	ArccotangentHyperbolic,
+	LogarithmNatural,
+	LogarithmDecimal,
+	Exponent
+};
+
+//! Number of operations defined in MathSimpleOperations enumeration.
+const int MathSimpleOperationsCount = Exponent + 1;
+
+enum Math3NumberOperations
+{
+	Power = 0,
+	Logarithm,
+	SineCosine,
+	Arctangent2
+};
+
+//! Number of operations defined in Math3NumberOperations enumeration.
+const int Math3NumberOperationsCount = Arctangent2 + 1;
+
+//! Enumeration of modes that define how the batch math operations are calculated.
+enum BatchOpsAccuracy
+{
+	//! Vectorized polynomial approximations are used. Errors are bounded by the table in BatchOps.Math.hpp.
+	BatchOpsAccuracyFast = 0,
+	//! Standard library functions are called for every number.
+	BatchOpsAccuracyPrecise
+};
+
+//! Processes the array in packs of numbers until either less then a whole pack is left or a pack of
+//! arguments that cannot be processed by the kernel is encountered.
+//!
+//! @returns Number of processed numbers, the rest must be processed by the scalar code.
+typedef __int64(*BatchKernelSingle)(float *numbers, __int64 count);
+//! Processes the array in packs of numbers until either less then a whole pack is left or a pack of
+//! arguments that cannot be processed by the kernel is encountered.
+//!
+//! @returns Number of processed numbers, the rest must be processed by the scalar code.
+typedef __int64(*BatchKernelDouble)(double *numbers, __int64 count);
+//! Processes 3 arrays in packs of numbers the same way BatchKernelSingle does.
+//!
+//! First 2 arrays contain the arguments, the results are written to the last one, except for the sine
+//! that is calculated by SineCosine operation and written to the second array.
+typedef __int64(*Batch3KernelSingle)(float *x, float *y, float *z, __int64 count);
+//! Processes 3 arrays in packs of numbers the same way BatchKernelDouble does.
+//!
+//! First 2 arrays contain the arguments, the results are written to the last one, except for the sine
+//! that is calculated by SineCosine operation and written to the second array.
+typedef __int64(*Batch3KernelDouble)(double *x, double *y, double *z, __int64 count);
+
+//! Represents a set of kernels that are compiled for one instruction set.
+struct BatchKernelTable
+{
+	const char *InstructionSet;
+	int SingleWidth;			//!< Number of single-precision numbers in one pack.
+	int DoubleWidth;			//!< Number of double-precision numbers in one pack.
+	BatchKernelSingle SimpleSingle[MathSimpleOperationsCount];
+	BatchKernelDouble SimpleDouble[MathSimpleOperationsCount];
+	Batch3KernelSingle ThreeNumberSingle[Math3NumberOperationsCount];
+	Batch3KernelDouble ThreeNumberDouble[Math3NumberOperationsCount];
+};
+
+extern const BatchKernelTable Sse2BatchKernels;
+extern const BatchKernelTable Avx2BatchKernels;
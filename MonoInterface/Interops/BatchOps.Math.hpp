@@ -0,0 +1,917 @@
+#pragma once
+
+#include "BatchOps.Kernels.h"
+
+// Polynomial approximations of elementary functions that work on packs of floating point numbers.
+//
+// Approximations are based on the ones from Cephes Math Library by Stephen L. Moshier. Every function
+// is written once for all packs, with separate cores for single and double precision where coefficients
+// differ.
+//
+// Maximal errors in ULP, measured against extended precision results on 2 * 10^6 random arguments per
+// function within stated domain (single / double):
+//
+// Sine, Cosine                |x| <= 2^20 ............................ 1.6 / 1.6
+// Tangent, Cotangent          |x| <= 2^20 ............................ 3.6 / 3.6
+// Arcsine, Arccosine          [-1; 1] ................................ 1.9 / 2.1
+// Arctangent                  whole range ............................ 2.3 / 1.3
+// Arccotangent                whole range ............................ 1.9 / 1.3
+// SineHyperbolic              whole range ............................ 1.8 / 1.9
+// CosineHyperbolic            whole range ............................ 1.7 / 2.0
+// TangentHyperbolic           whole range ............................ 2.5 / 2.7
+// CotangentHyperbolic         whole range ............................ 3.4 / 3.3
+// ArcsineHyperbolic           whole range ............................ 2.6 / 2.8
+// ArccosineHyperbolic         [1; +inf) .............................. 3.1 / 3.4
+// ArctangentHyperbolic        (-1; 1) ................................ 2.9 / 2.9
+// ArccotangentHyperbolic      |x| > 1 ................................ 2.8 / 2.9
+// LogarithmNatural            (0; +inf) .............................. 0.8 / 0.8
+// LogarithmDecimal            (0; +inf) .............................. 1.9 / 1.8
+// Exponent                    whole range ............................ 1.0 / 1.6
+// Power                       x > 0, finite result ................... 0.5 / 2.2
+// Logarithm (ln(x) / ln(y))   x, y > 0 ............................... 2.6 / 1.7
+// Arctangent2                 not both zero .......................... 2.9 / 1.5
+//
+// Arguments of trigonometric functions that are outside of stated domain, as well as non-positive
+// bases of powers and non-finite arguments of Power and Arctangent2 are not accepted by vectorized
+// kernels and are processed by the standard library instead. Special values (zeros, infinities and
+// NaNs) yield the same results as in the standard library.
+
+//! Provides implementations of elementary functions for packs of numbers.
+//!
+//! @tparam Pack Type of packs of numbers to work with (e.g. Sse2Single).
+template<typename Pack>
+struct BatchMath
+{
+	template<typename> friend struct BatchMath;
+
+	typedef typename Pack::Scalar Scalar;
+
+	//! Calculates exponent of every number in the pack.
+	static Pack Exp(Pack x)
+	{
+		return ExpCore(x, Scalar());
+	}
+	//! Calculates natural logarithm of every number in the pack.
+	static Pack Log(Pack x)
+	{
+		return LogCore(x, Scalar());
+	}
+	//! Calculates decimal logarithm of every number in the pack.
+	static Pack Log10(Pack x)
+	{
+		return Log(x) * Pack(0.43429448190325182765);
+	}
+	//! Calculates ln(1 + x) without loss of precision for small arguments.
+	static Pack Log1p(Pack x)
+	{
+		Pack u = Pack(1.0) + x;
+		Pack d = u - Pack(1.0);
+		// Corrects the rounding error of 1 + x (W. Kahan's trick). d == x also covers infinite arguments.
+		Pack logarithm = Log(u);
+		Pack corrected = Select(d == x, logarithm, logarithm * (x / d));
+		return Select(d == Pack(0.0), x, corrected);
+	}
+	//! Returns true, if all numbers in the pack can be reduced by trigonometric functions.
+	static bool AcceptsTrigonometric(Pack x)
+	{
+		return !Any(Abs(x) > Pack(TrigonometricLimit(Scalar())));
+	}
+	//! Calculates sines and cosines of every number in the pack.
+	//!
+	//! All arguments must be accepted by AcceptsTrigonometric.
+	static void SinCos(Pack x, Pack &sine, Pack &cosine)
+	{
+		// Reduce the argument to [-pi/4; pi/4] range.
+		Pack k;
+		Pack r = ReduceQuadrant(x, k, Scalar());
+
+		Pack s, c;
+		SinCosCore(r, s, c, Scalar());
+		// Sine of -0 must be -0, but -0 + 0 yields +0 in the polynomial.
+		s = s | (r & Pack::SignMask());
+
+		// Find the quadrant number modulo 4: the fraction is one of 0, 0.25, 0.5 or 0.75.
+		Pack quarter = k * Pack(0.25);
+		Pack fraction = quarter - Floor(quarter);
+
+		Pack swap = (fraction == Pack(0.25)) | (fraction == Pack(0.75));
+		Pack negateSine = fraction >= Pack(0.5);
+		Pack negateCosine = (fraction == Pack(0.25)) | (fraction == Pack(0.5));
+
+		Pack signMask = Pack::SignMask();
+		sine = Select(swap, c, s) ^ (negateSine & signMask);
+		cosine = Select(swap, s, c) ^ (negateCosine & signMask);
+	}
+	static Pack Sin(Pack x)
+	{
+		Pack s, c;
+		SinCos(x, s, c);
+		return s;
+	}
+	static Pack Cos(Pack x)
+	{
+		Pack s, c;
+		SinCos(x, s, c);
+		return c;
+	}
+	static Pack Tan(Pack x)
+	{
+		Pack s, c;
+		SinCos(x, s, c);
+		return s / c;
+	}
+	static Pack Cot(Pack x)
+	{
+		Pack s, c;
+		SinCos(x, s, c);
+		return c / s;
+	}
+	static Pack Asin(Pack x)
+	{
+		Pack a = Abs(x);
+		Pack sign = x & Pack::SignMask();
+
+		// asin(a) = pi/2 - 2 * asin(sqrt((1 - a) / 2)) is used for a > 0.5.
+		Pack big = a > Pack(0.5);
+		Pack t = Select(big, Sqrt(Pack(0.5) * (Pack(1.0) - a)), a);
+		Pack p = AsinCore(t, Scalar());
+
+		Pack result = Select(big, (Pack(PiOver2High) - (p + p)) + Pack(PiOver2Low(Scalar())), p);
+		return result ^ sign;
+	}
+	static Pack Acos(Pack x)
+	{
+		Pack positive = x > Pack(0.5);
+		Pack negative = x < Pack(-0.5);
+		Pack t = Select(positive | negative, Sqrt(Pack(0.5) * (Pack(1.0) - Abs(x))), x);
+		Pack p = AsinCore(t, Scalar());
+
+		Pack low = Pack(PiOver2Low(Scalar()));
+		Pack doubled = p + p;
+		Pack result = Select(negative, (Pack(2 * PiOver2High) - doubled) + (low + low),
+							 (Pack(PiOver2High) - p) + low);
+		return Select(positive, doubled, result);
+	}
+	static Pack Atan(Pack x)
+	{
+		return AtanCore(x, Scalar());
+	}
+	static Pack Acot(Pack x)
+	{
+		return AcotCore(x, Scalar());
+	}
+	static Pack Sinh(Pack x)
+	{
+		Pack a = Abs(x);
+		Pack sign = x & Pack::SignMask();
+
+		Pack e = Exp(a);
+		Pack large = Select(a > Pack(ExpMax(Scalar()) - 0.69314718055994530942), HalfExpSquare(a),
+							Pack(0.5) * (e - Pack(1.0) / e));
+		Pack result = Select(a < Pack(1.0), SinhSmall(a, Scalar()), large);
+		return result ^ sign;
+	}
+	static Pack Cosh(Pack x)
+	{
+		Pack a = Abs(x);
+		Pack e = Exp(a);
+		Pack regular = Pack(0.5) * (e + Pack(1.0) / e);
+		return Select(a > Pack(ExpMax(Scalar()) - 0.69314718055994530942), HalfExpSquare(a), regular);
+	}
+	static Pack Tanh(Pack x)
+	{
+		Pack a = Abs(x);
+		Pack sign = x & Pack::SignMask();
+
+		Pack e = Exp(a);
+		Pack small = SinhSmall(a, Scalar()) / (Pack(0.5) * (e + Pack(1.0) / e));
+		Pack large = Pack(1.0) - Pack(2.0) / (Exp(a + a) + Pack(1.0));
+		Pack result = Select(a < Pack(0.625), small, large);
+		return result ^ sign;
+	}
+	static Pack Coth(Pack x)
+	{
+		return Pack(1.0) / Tanh(x);
+	}
+	static Pack Asinh(Pack x)
+	{
+		Pack a = Abs(x);
+		Pack sign = x & Pack::SignMask();
+
+		Pack square = a * a;
+		Pack regular = Log1p(a + square / (Pack(1.0) + Sqrt(Pack(1.0) + square)));
+		Pack huge = Log(a) + Pack(0.69314718055994530942);
+		Pack result = Select(a > Pack(HyperbolicLimit(Scalar())), huge, regular);
+		return result ^ sign;
+	}
+	static Pack Acosh(Pack x)
+	{
+		Pack t = x - Pack(1.0);
+		Pack regular = Log1p(t + Sqrt(t * (x + Pack(1.0))));
+		Pack huge = Log(x) + Pack(0.69314718055994530942);
+		Pack result = Select(x > Pack(HyperbolicLimit(Scalar())), huge, regular);
+		return Select(x < Pack(1.0), Pack::NaN(), result);
+	}
+	static Pack Atanh(Pack x)
+	{
+		Pack a = Abs(x);
+		Pack sign = x & Pack::SignMask();
+
+		Pack result = Pack(0.5) * Log1p((a + a) / (Pack(1.0) - a));
+		return result ^ sign;
+	}
+	static Pack Acoth(Pack x)
+	{
+		Pack a = Abs(x);
+		Pack sign = x & Pack::SignMask();
+
+		// Unlike atanh(1 / x), a - 1 is exact near 1.
+		Pack result = Pack(0.5) * Log1p(Pack(2.0) / (a - Pack(1.0)));
+		return result ^ sign;
+	}
+	//! Returns true, if all pairs of numbers in the packs can be processed by Pow.
+	static bool AcceptsPower(Pack x, Pack y)
+	{
+		// Non-positive bases and non-finite arguments have too many special cases to handle them here.
+		Pack infinity = Pack::Infinity();
+		return All((x > Pack(0.0)) & (x < infinity) & (Abs(y) < infinity));
+	}
+	//! Raises every number in the first pack to the power from the second one.
+	//!
+	//! All arguments must be accepted by AcceptsPower.
+	static Pack Pow(Pack x, Pack y)
+	{
+		return PowCore(x, y, Scalar());
+	}
+	//! Calculates logarithms of numbers from the first pack using bases from the second one.
+	static Pack LogBase(Pack x, Pack base)
+	{
+		return Log(x) / Log(base);
+	}
+	//! Returns true, if all pairs of numbers in the packs can be processed by Atan2.
+	static bool AcceptsArctangent2(Pack y, Pack x)
+	{
+		Pack infinity = Pack::Infinity();
+		Pack finite = (Abs(y) < infinity) & (Abs(x) < infinity);
+		return All(finite & (Max(Abs(y), Abs(x)) > Pack(0.0)));
+	}
+	//! Calculates angles between positive X-axis and vectors (x; y).
+	//!
+	//! All arguments must be accepted by AcceptsArctangent2.
+	static Pack Atan2(Pack y, Pack x)
+	{
+		Pack result = Atan(y / x);
+
+		// Left half-plane: add pi with the sign of y, -0 and +0 are distinguished too.
+		Pack sign = y & Pack::SignMask();
+		Pack low = Pack(2 * PiOver2Low(Scalar())) ^ sign;
+		Pack shifted = (Pack(2 * PiOver2High) ^ sign) + (result + low);
+		result = Select(x < Pack(0.0), shifted, result);
+		// Division by -0 would flip the sign of the angle.
+		return Select(x == Pack(0.0), Pack(PiOver2High) ^ sign, result);
+	}
+private:
+	static const double PiOver2High;
+
+	static double PiOver2Low(float)
+	{
+		return -4.37113900018624283e-8;
+	}
+	static double PiOver2Low(double)
+	{
+		return 6.12323399573676588613e-17;
+	}
+	static double ExpMax(float)
+	{
+		return 88.7228391116729996;
+	}
+	static double ExpMax(double)
+	{
+		return 709.782712893383973096;
+	}
+	static double TrigonometricLimit(float)
+	{
+		return 1048576.0;
+	}
+	static double TrigonometricLimit(double)
+	{
+		return 1048576.0;
+	}
+	//! Arguments above this limit make x^2 + 1 == x^2 in inverse hyperbolic functions.
+	static double HyperbolicLimit(float)
+	{
+		return 4096.0;
+	}
+	static double HyperbolicLimit(double)
+	{
+		return 268435456.0;
+	}
+
+	static Pack Floor(Pack x)
+	{
+		Pack rounded = Round(x);
+		return rounded - (Pack(1.0) & (rounded > x));
+	}
+	//! Calculates x * 2^n, where n is integral. Result may be denormal.
+	static Pack Scale(Pack x, Pack n)
+	{
+		Pack half = Round(n * Pack(0.5));
+		return x * Pack::Pow2(half) * Pack::Pow2(n - half);
+	}
+	//! Evaluates a polynomial using Horner's scheme. Coefficients start from the highest power.
+	template<int count>
+	static Pack Polynomial(Pack x, const double (&coefficients)[count])
+	{
+		Pack result(coefficients[0]);
+		for (int i = 1; i < count; i++)
+		{
+			result = MulAdd(result, x, Pack(coefficients[i]));
+		}
+		return result;
+	}
+	//! Evaluates a polynomial with implied leading coefficient that is equal to 1.
+	template<int count>
+	static Pack MonicPolynomial(Pack x, const double (&coefficients)[count])
+	{
+		Pack result = x + Pack(coefficients[0]);
+		for (int i = 1; i < count; i++)
+		{
+			result = MulAdd(result, x, Pack(coefficients[i]));
+		}
+		return result;
+	}
+	//! Calculates e^a / 2 as (e^(a/2))^2 / 2, for arguments where e^a itself overflows.
+	static Pack HalfExpSquare(Pack a)
+	{
+		Pack half = Exp(Pack(0.5) * a);
+		return Pack(0.5) * half * half;
+	}
+
+	static Pack ExpCore(Pack x, float)
+	{
+		static const double coefficients[] =
+		{
+			1.9875691500E-4, 1.3981999507E-3, 8.3334519073E-3, 4.1665795894E-2, 1.6666665459E-1,
+			5.0000001201E-1
+		};
+		const double maximal = ExpMax(float());
+		const double minimal = -103.972077083991796;
+
+		Pack clamped = Min(Max(x, Pack(minimal)), Pack(maximal));
+
+		Pack n = Round(clamped * Pack(1.44269504088896341));
+		Pack r = clamped - n * Pack(0.693359375);
+		r = r - n * Pack(-2.12194440e-4);
+
+		Pack z = r * r;
+		Pack p = MulAdd(Polynomial(r, coefficients), z, r) + Pack(1.0);
+
+		Pack result = Scale(p, n);
+		result = Select(x > Pack(maximal), Pack::Infinity(), result);
+		result = Select(x < Pack(minimal), Pack(0.0), result);
+		// NaNs are lost by clamping.
+		return Select(x == x, result, x + x);
+	}
+	static Pack ExpCore(Pack x, double)
+	{
+		static const double p[] =
+		{
+			1.26177193074810590878E-4, 3.02994407707441961300E-2, 9.99999999999999999910E-1
+		};
+		static const double q[] =
+		{
+			3.00198505138664455042E-6, 2.52448340349684104192E-3, 2.27265548208155028766E-1,
+			2.00000000000000000009E0
+		};
+		const double maximal = ExpMax(double());
+		const double minimal = -745.133219101941108420;
+
+		Pack clamped = Min(Max(x, Pack(minimal)), Pack(maximal));
+
+		Pack n = Round(clamped * Pack(1.4426950408889634073599));
+		Pack r = clamped - n * Pack(6.93145751953125E-1);
+		r = r - n * Pack(1.42860682030941723212E-6);
+
+		// e^r = 1 + 2 * r * P(r^2) / (Q(r^2) - r * P(r^2))
+		Pack rr = r * r;
+		Pack px = r * Polynomial(rr, p);
+		Pack e = px / (Polynomial(rr, q) - px);
+		e = MulAdd(e, Pack(2.0), Pack(1.0));
+
+		Pack result = Scale(e, n);
+		result = Select(x > Pack(maximal), Pack::Infinity(), result);
+		result = Select(x < Pack(minimal), Pack(0.0), result);
+		return Select(x == x, result, x + x);
+	}
+	//! Prepares the argument of the logarithm: extracts the exponent and reduces the mantissa to
+	//! [sqrt(0.5) - 1; sqrt(2) - 1] range.
+	static Pack ReduceLogarithm(Pack x, Pack &exponent, double minNormal, double denormalScale, double scalePower)
+	{
+		Pack denormal = x < Pack(minNormal);
+		Pack scaled = Select(denormal, x * Pack(denormalScale), x);
+
+		Pack m = Pack::Frexp(scaled, exponent);
+		exponent = exponent - (denormal & Pack(scalePower));
+
+		Pack below = m < Pack(0.70710678118654752440);
+		exponent = exponent - (below & Pack(1.0));
+		return Select(below, m + m, m) - Pack(1.0);
+	}
+	//! Handles zero, negative and infinite arguments of the logarithm.
+	static Pack FinishLogarithm(Pack x, Pack result)
+	{
+		result = Select(x == Pack::Infinity(), x, result);
+		result = Select(x == Pack(0.0), Pack(0.0) - Pack::Infinity(), result);
+		// NaN arguments fail the comparison as well.
+		return Select(x >= Pack(0.0), result, Pack::NaN() | x);
+	}
+	static Pack LogCore(Pack x, float)
+	{
+		static const double coefficients[] =
+		{
+			7.0376836292E-2, -1.1514610310E-1, 1.1676998740E-1, -1.2420140846E-1, 1.4249322787E-1,
+			-1.6668057665E-1, 2.0000714765E-1, -2.4999993993E-1, 3.3333331174E-1
+		};
+		Pack e;
+		Pack m = ReduceLogarithm(x, e, 1.17549435082228750797e-38, 33554432.0, 25.0);
+
+		Pack z = m * m;
+		Pack y = Polynomial(m, coefficients) * m * z;
+		y = MulAdd(e, Pack(-2.12194440e-4), y);
+		y = MulAdd(z, Pack(-0.5), y);
+		Pack result = MulAdd(e, Pack(0.693359375), m + y);
+
+		return FinishLogarithm(x, result);
+	}
+	static Pack LogCore(Pack x, double)
+	{
+		static const double p[] =
+		{
+			1.01875663804580931796E-4, 4.97494994976747001425E-1, 4.70579119878881725854E0,
+			1.44989225341610930846E1, 1.79368678507819816313E1, 7.70838733755885391666E0
+		};
+		static const double q[] =
+		{
+			1.12873587189167450590E1, 4.52279145837532221105E1, 8.29875266912776603211E1,
+			7.11544750618563894466E1, 2.31251620126765340583E1
+		};
+		Pack e;
+		Pack m = ReduceLogarithm(x, e, 2.22507385850720138309e-308, 18014398509481984.0, 54.0);
+
+		Pack z = m * m;
+		Pack y = m * (z * Polynomial(m, p) / MonicPolynomial(m, q));
+		y = MulAdd(e, Pack(-2.121944400546905827679e-4), y);
+		y = MulAdd(z, Pack(-0.5), y);
+		Pack result = MulAdd(e, Pack(0.693359375), m + y);
+
+		return FinishLogarithm(x, result);
+	}
+	static Pack PowCore(Pack x, Pack y, float)
+	{
+		// Error of y * ln(x) is multiplied by the power, which is too much for single precision.
+		typedef typename Pack::Wide Wide;
+
+		Wide xLow, xHigh, yLow, yHigh;
+		Pack::Widen(x, xLow, xHigh);
+		Pack::Widen(y, yLow, yHigh);
+		Wide low = BatchMath<Wide>::Exp(yLow * BatchMath<Wide>::Log(xLow));
+		Wide high = BatchMath<Wide>::Exp(yHigh * BatchMath<Wide>::Log(xHigh));
+		return Pack::Narrow(low, high);
+	}
+	static Pack PowCore(Pack x, Pack y, double)
+	{
+		Pack logarithmLow;
+		Pack logarithm = LogExtended(x, logarithmLow);
+
+		Pack t = y * logarithm;
+		Pack tLow = MulAdd(y, logarithmLow, ProductError(y, logarithm, t));
+		// The low part doesn't matter when the result overflows or underflows, and it is NaN when
+		// y is too big for ProductError.
+		tLow = Select((Abs(t) < Pack(1024.0)) & (tLow == tLow), tLow, Pack(0.0));
+
+		// e^(t + tLow) = e^t * (1 + tLow)
+		Pack e = Exp(t);
+		return Select(e < Pack::Infinity(), MulAdd(e, tLow, e), e);
+	}
+	//! Calculates natural logarithm of a positive finite number as a sum of high and low parts.
+	//!
+	//! Used by Pow, where the error of Log would be magnified by the power.
+	static Pack LogExtended(Pack x, Pack &low)
+	{
+		// 2 / (2k + 1) for k = 12..2.
+		static const double coefficients[] =
+		{
+			0.08, 0.086956521739130434783, 0.095238095238095238095, 0.10526315789473684211,
+			0.11764705882352941176, 0.13333333333333333333, 0.15384615384615384615, 0.18181818181818181818,
+			0.22222222222222222222, 0.28571428571428571429, 0.4
+		};
+		// 2 / 3 as a sum of 2 numbers.
+		const double twoThirdsHigh = 0.66666666666666662966;
+		const double twoThirdsLow = 3.7007434154171882e-17;
+
+		Pack e;
+		Pack f = ReduceLogarithm(x, e, 2.22507385850720138309e-308, 18014398509481984.0, 54.0);
+
+		// ln(1 + f) = 2 * atanh(s) = 2s + 2s^3 / 3 + 2s^5 / 5 + ..., where s = f / (2 + f). Every term
+		// except the last ones has to be calculated with extra precision.
+		Pack u = Pack(2.0) + f;
+		Pack uLow = f - (u - Pack(2.0));
+		Pack s = f / u;
+		Pack su = s * u;
+		Pack sLow = (((f - su) - ProductError(s, u, su)) - s * uLow) / u;
+
+		Pack z = s * s;
+		Pack zLow = ProductError(s, s, z);
+		Pack cube = s * z;
+		Pack cubeLow = ProductError(s, z, cube) + MulAdd(s, zLow, Pack(3.0) * z * sLow);
+		Pack third = cube * Pack(twoThirdsHigh);
+		Pack thirdLow = ProductError(cube, Pack(twoThirdsHigh), third) +
+			MulAdd(cube, Pack(twoThirdsLow), cubeLow * Pack(twoThirdsHigh));
+		Pack rest = cube * z * Polynomial(z, coefficients);
+
+		// ln(2) = 6.93147180369123816490e-01 + 1.90821492927058770002e-10, e * high part is exact.
+		Pack eHigh = e * Pack(6.93147180369123816490e-01);
+		Pack doubled = s + s;
+		Pack partial = eHigh + doubled;
+		Pack high = partial + third;
+		low = SumError(eHigh, doubled, partial) + SumError(partial, third, high);
+		low = low + (thirdLow + (sLow + sLow)) + MulAdd(e, Pack(1.90821492927058770002e-10), rest);
+
+		// Normalize the sum, so the low part is smaller than one ULP of the high part.
+		Pack result = high + low;
+		low = low - (result - high);
+		return result;
+	}
+	//! Calculates the rounding error of the sum that was calculated as a + b.
+	static Pack SumError(Pack a, Pack b, Pack sum)
+	{
+		Pack bVirtual = sum - a;
+		return (a - (sum - bVirtual)) + (b - bVirtual);
+	}
+	//! Calculates x - k * pi / 2, where k is the nearest integer to x * 2 / pi.
+	//!
+	//! Single-precision arguments are reduced in double precision, otherwise results near multiples
+	//! of pi / 2 lose too many significant digits.
+	static Pack ReduceQuadrant(Pack x, Pack &k, float)
+	{
+		typedef typename Pack::Wide Wide;
+
+		Wide low, high, lowK, highK;
+		Pack::Widen(x, low, high);
+		low = BatchMath<Wide>::ReduceQuadrantWide(low, lowK);
+		high = BatchMath<Wide>::ReduceQuadrantWide(high, highK);
+		k = Pack::Narrow(lowK, highK);
+		return Pack::Narrow(low, high);
+	}
+	static Pack ReduceQuadrant(Pack x, Pack &k, double)
+	{
+		return ReduceQuadrantWide(x, k);
+	}
+	static Pack ReduceQuadrantWide(Pack x, Pack &k)
+	{
+		k = Round(x * Pack(0.63661977236758134308));
+		Pack r = x - k * Pack(1.57079625129699707031E0);
+		r = r - k * Pack(7.54978941586159635335E-8);
+		return r - k * Pack(5.39030285815811905290E-15);
+	}
+	//! Calculates sine and cosine of the argument within [-pi/4; pi/4] range.
+	static void SinCosCore(Pack r, Pack &sine, Pack &cosine, float)
+	{
+		static const double sineCoefficients[] =
+		{
+			-1.9515295891E-4, 8.3321608736E-3, -1.6666654611E-1
+		};
+		static const double cosineCoefficients[] =
+		{
+			2.443315711809948E-005, -1.388731625493765E-003, 4.166664568298827E-002
+		};
+		Pack z = r * r;
+		sine = MulAdd(Polynomial(z, sineCoefficients) * z, r, r);
+		cosine = MulAdd(Polynomial(z, cosineCoefficients) * z, z, MulAdd(z, Pack(-0.5), Pack(1.0)));
+	}
+	static void SinCosCore(Pack r, Pack &sine, Pack &cosine, double)
+	{
+		static const double sineCoefficients[] =
+		{
+			1.58962301576546568060E-10, -2.50507477628578072866E-8, 2.75573136213857245213E-6,
+			-1.98412698295895385996E-4, 8.33333333332211858878E-3, -1.66666666666666307295E-1
+		};
+		static const double cosineCoefficients[] =
+		{
+			-1.13585365213876817300E-11, 2.08757008419747316778E-9, -2.75573141792967388112E-7,
+			2.48015872888517045348E-5, -1.38888888888730564116E-3, 4.16666666666665929218E-2
+		};
+		Pack z = r * r;
+		sine = MulAdd(Polynomial(z, sineCoefficients) * z, r, r);
+		cosine = MulAdd(Polynomial(z, cosineCoefficients) * z, z, MulAdd(z, Pack(-0.5), Pack(1.0)));
+	}
+	//! Calculates arcsine of the argument within [-0.5; 0.5] range.
+	static Pack AsinCore(Pack t, float)
+	{
+		static const double coefficients[] =
+		{
+			4.2163199048E-2, 2.4181311049E-2, 4.5470025998E-2, 7.4953002686E-2, 1.6666752422E-1
+		};
+		Pack z = t * t;
+		return MulAdd(Polynomial(z, coefficients) * z, t, t);
+	}
+	static Pack AsinCore(Pack t, double)
+	{
+		static const double p[] =
+		{
+			4.253011369004428248960E-3, -6.019598008014123785661E-1, 5.444622390564711410273E0,
+			-1.626247967210700244449E1, 1.956261983317594739197E1, -8.198089802484824371615E0
+		};
+		static const double q[] =
+		{
+			-1.474091372988853791896E1, 7.049610280856842141659E1, -1.471791292232726029859E2,
+			1.395105614657485689735E2, -4.918853881490881290097E1
+		};
+		Pack z = t * t;
+		return MulAdd(z * Polynomial(z, p) / MonicPolynomial(z, q), t, t);
+	}
+	static Pack AtanCore(Pack x, float)
+	{
+		Pack a = Abs(x);
+		Pack sign = x & Pack::SignMask();
+
+		// Reduce the argument to [0; tan(pi/8)] range.
+		Pack big = a > Pack(2.414213562373095);
+		Pack middle = a > Pack(0.4142135623730950);
+		Pack t = Select(big, Pack(-1.0) / a, Select(middle, (a - Pack(1.0)) / (a + Pack(1.0)), a));
+		Pack offset = Select(big, Pack(PiOver2High), Select(middle, Pack(0.5 * PiOver2High), Pack(0.0)));
+		Pack correction = Select(big, Pack(PiOver2Low(float())),
+								 Select(middle, Pack(0.5 * PiOver2Low(float())), Pack(0.0)));
+
+		return AtanReduced(t, offset, correction) ^ sign;
+	}
+	static Pack AtanCore(Pack x, double)
+	{
+		static const double p[] =
+		{
+			-8.750608600031904122785E-1, -1.615753718733365076637E1, -7.500855792314704667340E1,
+			-1.228866684490136173410E2, -6.485021904942025371773E1
+		};
+		static const double q[] =
+		{
+			2.485846490142306297962E1, 1.650270098316988542046E2, 4.328810604912902668951E2,
+			4.853903996359136964868E2, 1.945506571482613964425E2
+		};
+		const double moreBits = PiOver2Low(double());
+
+		Pack a = Abs(x);
+		Pack sign = x & Pack::SignMask();
+
+		// Reduce the argument to [0; 0.66] range.
+		Pack big = a > Pack(2.41421356237309504880);
+		Pack middle = a > Pack(0.66);
+		Pack t = Select(big, Pack(-1.0) / a, Select(middle, (a - Pack(1.0)) / (a + Pack(1.0)), a));
+		Pack offset = Select(big, Pack(PiOver2High), Select(middle, Pack(0.5 * PiOver2High), Pack(0.0)));
+		Pack correction = Select(big, Pack(moreBits), Select(middle, Pack(0.5 * moreBits), Pack(0.0)));
+
+		Pack z = t * t;
+		z = z * Polynomial(z, p) / MonicPolynomial(z, q);
+		Pack result = offset + (MulAdd(t, z, t) + correction);
+		return result ^ sign;
+	}
+	//! Calculates arccotangent directly instead of taking arctangent of the reciprocal, since in single
+	//! precision rounding of the reciprocal adds up to a whole ULP to the error.
+	static Pack AcotCore(Pack x, float)
+	{
+		Pack a = Abs(x);
+		Pack sign = x & Pack::SignMask();
+
+		// acot(a) is pi/2 - atan(a), pi/4 - atan((a - 1) / (a + 1)) or atan(1 / a) in the same ranges that
+		// are used by AtanCore.
+		Pack big = a > Pack(2.414213562373095);
+		Pack middle = a > Pack(0.4142135623730950);
+		Pack t = Select(big, Pack(1.0) / a, Select(middle, (Pack(1.0) - a) / (a + Pack(1.0)), Pack(0.0) - a));
+		Pack offset = Select(big, Pack(0.0), Select(middle, Pack(0.5 * PiOver2High), Pack(PiOver2High)));
+		Pack correction = Select(big, Pack(0.0),
+								 Select(middle, Pack(0.5 * PiOver2Low(float())), Pack(PiOver2Low(float()))));
+
+		return AtanReduced(t, offset, correction) ^ sign;
+	}
+	static Pack AcotCore(Pack x, double)
+	{
+		return AtanCore(Pack(1.0) / x, double());
+	}
+	//! Calculates offset + atan(t) in single precision for the argument within [-tan(pi/8); tan(pi/8)] range.
+	static Pack AtanReduced(Pack t, Pack offset, Pack correction)
+	{
+		static const double coefficients[] =
+		{
+			8.05374449538e-2, -1.38776856032E-1, 1.99777106478E-1, -3.33329491539E-1
+		};
+		Pack z = t * t;
+		return offset + (MulAdd(Polynomial(z, coefficients) * z, t, t) + correction);
+	}
+	//! Calculates hyperbolic sine of the argument within [0; 1) range using Taylor series.
+	static Pack SinhSmall(Pack a, float)
+	{
+		static const double coefficients[] =
+		{
+			2.505210838544172e-8, 2.755731922398589e-6, 1.984126984126984e-4, 8.333333333333333e-3,
+			1.666666666666667e-1
+		};
+		Pack z = a * a;
+		return MulAdd(Polynomial(z, coefficients) * z, a, a);
+	}
+	static Pack SinhSmall(Pack a, double)
+	{
+		static const double coefficients[] =
+		{
+			8.220635246624329e-18, 2.811457254345521e-15, 7.647163731819816e-13, 1.605904383682161e-10,
+			2.505210838544172e-8, 2.755731922398589e-6, 1.984126984126984e-4, 8.333333333333333e-3,
+			1.666666666666667e-1
+		};
+		Pack z = a * a;
+		return MulAdd(Polynomial(z, coefficients) * z, a, a);
+	}
+};
+
+template<typename Pack>
+const double BatchMath<Pack>::PiOver2High = 1.57079632679489661923;
+
+#pragma region Kernels
+
+//! Applies the operation to every pack in the array.
+//!
+//! @tparam Pack      Type of packs to process the array with.
+//! @tparam Operation Type that defines static functions Accepts and Apply.
+template<typename Pack, typename Operation>
+__int64 ApplyBatchKernel(typename Pack::Scalar *numbers, __int64 count)
+{
+	__int64 i = 0;
+	for (; i + Pack::Width <= count; i += Pack::Width)
+	{
+		Pack x = Pack::Load(numbers + i);
+		if (!Operation::Accepts(x))
+		{
+			break;
+		}
+		Operation::Apply(x).Store(numbers + i);
+	}
+	return i;
+}
+
+// Defines a type that can be used as Operation template argument of ApplyBatchKernel.
+#define BATCH_OPERATION(name, function, accepts)							\
+	template<typename Pack>													\
+	struct name																\
+	{																		\
+		static bool Accepts(Pack x) { return accepts; }						\
+		static Pack Apply(Pack x) { return BatchMath<Pack>::function(x); }	\
+	}
+
+BATCH_OPERATION(BatchSineOperation, Sin, BatchMath<Pack>::AcceptsTrigonometric(x));
+BATCH_OPERATION(BatchCosineOperation, Cos, BatchMath<Pack>::AcceptsTrigonometric(x));
+BATCH_OPERATION(BatchTangentOperation, Tan, BatchMath<Pack>::AcceptsTrigonometric(x));
+BATCH_OPERATION(BatchCotangentOperation, Cot, BatchMath<Pack>::AcceptsTrigonometric(x));
+BATCH_OPERATION(BatchArcsineOperation, Asin, true);
+BATCH_OPERATION(BatchArccosineOperation, Acos, true);
+BATCH_OPERATION(BatchArctangentOperation, Atan, true);
+BATCH_OPERATION(BatchArccotangentOperation, Acot, true);
+BATCH_OPERATION(BatchSineHyperbolicOperation, Sinh, true);
+BATCH_OPERATION(BatchCosineHyperbolicOperation, Cosh, true);
+BATCH_OPERATION(BatchTangentHyperbolicOperation, Tanh, true);
+BATCH_OPERATION(BatchCotangentHyperbolicOperation, Coth, true);
+BATCH_OPERATION(BatchArcsineHyperbolicOperation, Asinh, true);
+BATCH_OPERATION(BatchArccosineHyperbolicOperation, Acosh, true);
+BATCH_OPERATION(BatchArctangentHyperbolicOperation, Atanh, true);
+BATCH_OPERATION(BatchArccotangentHyperbolicOperation, Acoth, true);
+BATCH_OPERATION(BatchLogarithmNaturalOperation, Log, true);
+BATCH_OPERATION(BatchLogarithmDecimalOperation, Log10, true);
+BATCH_OPERATION(BatchExponentOperation, Exp, true);
+
+//! Applies the operation to every pack of numbers from 3 arrays.
+//!
+//! @tparam Pack      Type of packs to process the arrays with.
+//! @tparam Operation Type that defines static functions Accepts and Apply that take 2 packs of
+//!                   arguments.
+template<typename Pack, typename Operation>
+__int64 ApplyBatch3Kernel(typename Pack::Scalar *x, typename Pack::Scalar *y, typename Pack::Scalar *z,
+						  __int64 count)
+{
+	__int64 i = 0;
+	for (; i + Pack::Width <= count; i += Pack::Width)
+	{
+		Pack a = Pack::Load(x + i);
+		Pack b = Pack::Load(y + i);
+		if (!Operation::Accepts(a, b))
+		{
+			break;
+		}
+		Operation::Apply(a, b, y + i, z + i);
+	}
+	return i;
+}
+
+template<typename Pack>
+struct BatchPowerOperation
+{
+	typedef typename Pack::Scalar Scalar;
+
+	static bool Accepts(Pack x, Pack y) { return BatchMath<Pack>::AcceptsPower(x, y); }
+	static void Apply(Pack x, Pack y, Scalar *, Scalar *z) { BatchMath<Pack>::Pow(x, y).Store(z); }
+};
+
+template<typename Pack>
+struct BatchLogarithmOperation
+{
+	typedef typename Pack::Scalar Scalar;
+
+	static bool Accepts(Pack, Pack) { return true; }
+	static void Apply(Pack x, Pack y, Scalar *, Scalar *z) { BatchMath<Pack>::LogBase(x, y).Store(z); }
+};
+
+template<typename Pack>
+struct BatchSineCosineOperation
+{
+	typedef typename Pack::Scalar Scalar;
+
+	static bool Accepts(Pack x, Pack) { return BatchMath<Pack>::AcceptsTrigonometric(x); }
+	static void Apply(Pack x, Pack, Scalar *y, Scalar *z)
+	{
+		Pack sine, cosine;
+		BatchMath<Pack>::SinCos(x, sine, cosine);
+		sine.Store(y);
+		cosine.Store(z);
+	}
+};
+
+template<typename Pack>
+struct BatchArctangent2Operation
+{
+	typedef typename Pack::Scalar Scalar;
+
+	static bool Accepts(Pack x, Pack y) { return BatchMath<Pack>::AcceptsArctangent2(x, y); }
+	static void Apply(Pack x, Pack y, Scalar *, Scalar *z) { BatchMath<Pack>::Atan2(x, y).Store(z); }
+};
+
+// Defines an initializer of BatchKernelTable for given pack types. Initializer is a constant expression,
+// so no code from translation units that are compiled for extended instruction sets is executed when
+// the module is loaded.
+
+#define BATCH_KERNEL_TABLE(instructionSet, single, dbl)					\
+	{																	\
+		instructionSet,													\
+		single::Width,													\
+		dbl::Width,														\
+		{																\
+			ApplyBatchKernel<single, BatchSineOperation<single>>,					\
+			ApplyBatchKernel<single, BatchCosineOperation<single>>,					\
+			ApplyBatchKernel<single, BatchTangentOperation<single>>,				\
+			ApplyBatchKernel<single, BatchCotangentOperation<single>>,				\
+			ApplyBatchKernel<single, BatchArcsineOperation<single>>,				\
+			ApplyBatchKernel<single, BatchArccosineOperation<single>>,				\
+			ApplyBatchKernel<single, BatchArctangentOperation<single>>,				\
+			ApplyBatchKernel<single, BatchArccotangentOperation<single>>,			\
+			ApplyBatchKernel<single, BatchSineHyperbolicOperation<single>>,			\
+			ApplyBatchKernel<single, BatchCosineHyperbolicOperation<single>>,		\
+			ApplyBatchKernel<single, BatchTangentHyperbolicOperation<single>>,		\
+			ApplyBatchKernel<single, BatchCotangentHyperbolicOperation<single>>,	\
+			ApplyBatchKernel<single, BatchArcsineHyperbolicOperation<single>>,		\
+			ApplyBatchKernel<single, BatchArccosineHyperbolicOperation<single>>,	\
+			ApplyBatchKernel<single, BatchArctangentHyperbolicOperation<single>>,	\
+			ApplyBatchKernel<single, BatchArccotangentHyperbolicOperation<single>>,	\
+			ApplyBatchKernel<single, BatchLogarithmNaturalOperation<single>>,		\
+			ApplyBatchKernel<single, BatchLogarithmDecimalOperation<single>>,		\
+			ApplyBatchKernel<single, BatchExponentOperation<single>>				\
+		},																\
+		{																\
+			ApplyBatchKernel<dbl, BatchSineOperation<dbl>>,							\
+			ApplyBatchKernel<dbl, BatchCosineOperation<dbl>>,						\
+			ApplyBatchKernel<dbl, BatchTangentOperation<dbl>>,						\
+			ApplyBatchKernel<dbl, BatchCotangentOperation<dbl>>,					\
+			ApplyBatchKernel<dbl, BatchArcsineOperation<dbl>>,						\
+			ApplyBatchKernel<dbl, BatchArccosineOperation<dbl>>,					\
+			ApplyBatchKernel<dbl, BatchArctangentOperation<dbl>>,					\
+			ApplyBatchKernel<dbl, BatchArccotangentOperation<dbl>>,					\
+			ApplyBatchKernel<dbl, BatchSineHyperbolicOperation<dbl>>,				\
+			ApplyBatchKernel<dbl, BatchCosineHyperbolicOperation<dbl>>,				\
+			ApplyBatchKernel<dbl, BatchTangentHyperbolicOperation<dbl>>,			\
+			ApplyBatchKernel<dbl, BatchCotangentHyperbolicOperation<dbl>>,			\
+			ApplyBatchKernel<dbl, BatchArcsineHyperbolicOperation<dbl>>,			\
+			ApplyBatchKernel<dbl, BatchArccosineHyperbolicOperation<dbl>>,			\
+			ApplyBatchKernel<dbl, BatchArctangentHyperbolicOperation<dbl>>,			\
+			ApplyBatchKernel<dbl, BatchArccotangentHyperbolicOperation<dbl>>,		\
+			ApplyBatchKernel<dbl, BatchLogarithmNaturalOperation<dbl>>,				\
+			ApplyBatchKernel<dbl, BatchLogarithmDecimalOperation<dbl>>,				\
+			ApplyBatchKernel<dbl, BatchExponentOperation<dbl>>						\
+		},																\
+		{																\
+			ApplyBatch3Kernel<single, BatchPowerOperation<single>>,					\
+			ApplyBatch3Kernel<single, BatchLogarithmOperation<single>>,				\
+			ApplyBatch3Kernel<single, BatchSineCosineOperation<single>>,			\
+			ApplyBatch3Kernel<single, BatchArctangent2Operation<single>>			\
+		},																\
+		{																\
+			ApplyBatch3Kernel<dbl, BatchPowerOperation<dbl>>,						\
+			ApplyBatch3Kernel<dbl, BatchLogarithmOperation<dbl>>,					\
+			ApplyBatch3Kernel<dbl, BatchSineCosineOperation<dbl>>,					\
+			ApplyBatch3Kernel<dbl, BatchArctangent2Operation<dbl>>					\
+		}																\
+	}
+
+#pragma endregion
@@ -0,0 +1,136 @@
+#include "stdafx.h"
+
+#include "BatchOps.Parallel.h"
+
+BatchWorkerPool::BatchWorkerPool()
+	: generation(0)
+	, busyThreads(0)
+	, stopping(false)
+	, processor(nullptr)
+	, batch(nullptr)
+	, count(0)
+	, chunkLength(0)
+	, nextChunk(0)
+{
+}
+
+BatchWorkerPool::~BatchWorkerPool()
+{
+	this->Stop();
+}
+
+void BatchWorkerPool::Run(ChunkProcessor processor, void *batch, __int64 count, __int64 chunkLength,
+						  int threadCount)
+{
+	std::unique_lock<std::mutex> runGuard(this->runLock, std::try_to_lock);
+	if (!runGuard.owns_lock() || threadCount < 2 || count <= chunkLength)
+	{
+		processor(batch, 0, count);
+		return;
+	}
+
+	// The calling thread processes chunks as well.
+	this->Resize(threadCount - 1);
+
+	this->processor = processor;
+	this->batch = batch;
+	this->count = count;
+	this->chunkLength = chunkLength;
+	this->nextChunk = 0;
+	{
+		std::lock_guard<std::mutex> guard(this->stateLock);
+		this->busyThreads = int(this->threads.size());
+		this->generation++;
+	}
+	this->wake.notify_all();
+
+	this->ProcessChunks();
+
+	std::unique_lock<std::mutex> guard(this->stateLock);
+	while (this->busyThreads != 0)
+	{
+		this->finished.wait(guard);
+	}
+}
+
+int BatchWorkerPool::GetProcessorCount()
+{
+	unsigned int count = std::thread::hardware_concurrency();
+	return count > 0 ? int(count) : 1;
+}
+
+void BatchWorkerPool::Resize(int threadCount)
+{
+	if (int(this->threads.size()) == threadCount)
+	{
+		return;
+	}
+
+	this->Stop();
+
+	// Generation is passed to the threads, otherwise a thread that starts late would not notice the
+	// first batch.
+	for (int i = 0; i < threadCount; i++)
+	{
+		this->threads.push_back(std::thread(&BatchWorkerPool::WorkerLoop, this, this->generation));
+	}
+}
+
+void BatchWorkerPool::Stop()
+{
+	{
+		std::lock_guard<std::mutex> guard(this->stateLock);
+		this->stopping = true;
+	}
+	this->wake.notify_all();
+
+	for (size_t i = 0; i < this->threads.size(); i++)
+	{
+		this->threads[i].join();
+	}
+	this->threads.clear();
+	this->stopping = false;
+}
+
+void BatchWorkerPool::WorkerLoop(unsigned int startGeneration)
+{
+	unsigned int processedGeneration = startGeneration;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> guard(this->stateLock);
+			while (!this->stopping && this->generation == processedGeneration)
+			{
+				this->wake.wait(guard);
+			}
+			if (this->stopping)
+			{
+				return;
+			}
+			processedGeneration = this->generation;
+		}
+
+		this->ProcessChunks();
+
+		std::lock_guard<std::mutex> guard(this->stateLock);
+		if (--this->busyThreads == 0)
+		{
+			this->finished.notify_one();
+		}
+	}
+}
+
+void BatchWorkerPool::ProcessChunks()
+{
+	while (true)
+	{
+		__int64 start = this->nextChunk.fetch_add(this->chunkLength);
+		if (start >= this->count)
+		{
+			return;
+		}
+
+		__int64 left = this->count - start;
+		this->processor(this->batch, start, left < this->chunkLength ? left : this->chunkLength);
+	}
+}
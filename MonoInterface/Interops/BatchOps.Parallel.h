@@ -0,0 +1,54 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+//! Represents a fixed pool of threads that help the calling thread with processing of large batches.
+//!
+//! Batches are split into chunks that are picked up by the threads one by one, so threads that get
+//! chunks which are faster to process take more of them.
+struct BatchWorkerPool
+{
+	//! Processes a part of the batch.
+	typedef void(*ChunkProcessor)(void *batch, __int64 start, __int64 length);
+private:
+	std::vector<std::thread> threads;
+
+	std::mutex runLock;				//!< Held while a batch is processed.
+	std::mutex stateLock;			//!< Guards the fields below.
+	std::condition_variable wake;
+	std::condition_variable finished;
+	unsigned int generation;		//!< Incremented every time a new batch is started.
+	int busyThreads;
+	bool stopping;
+
+	ChunkProcessor processor;
+	void *batch;
+	__int64 count;
+	__int64 chunkLength;
+	std::atomic<__int64> nextChunk;
+public:
+	BatchWorkerPool();
+	~BatchWorkerPool();
+
+	//! Processes the batch using given number of threads, including the calling one.
+	//!
+	//! Returns when the whole batch is processed. If the pool is busy with another batch, this one is
+	//! processed by the calling thread alone.
+	//!
+	//! @param processor   Pointer to the function that processes chunks of the batch.
+	//! @param batch       Pointer to the object that is passed to the processor.
+	//! @param count       Number of elements in the batch.
+	//! @param chunkLength Maximal number of elements in one chunk.
+	//! @param threadCount Number of threads to use.
+	void Run(ChunkProcessor processor, void *batch, __int64 count, __int64 chunkLength, int threadCount);
+	//! Gets the number of logical processors.
+	static int GetProcessorCount();
+private:
+	void Resize(int threadCount);
+	void Stop();
+	void WorkerLoop(unsigned int startGeneration);
+	void ProcessChunks();
+};
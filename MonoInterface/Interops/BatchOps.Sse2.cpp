@@ -0,0 +1,6 @@
+#include "stdafx.h"
+
+#include "BatchOps.Sse2.h"
+#include "BatchOps.Math.hpp"
+
+const BatchKernelTable Sse2BatchKernels = BATCH_KERNEL_TABLE("SSE2", Sse2Single, Sse2Double);
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <emmintrin.h>
+
+// Packs of floating point numbers that are processed with SSE2 instructions.
+//
+// Packs only wrap the intrinsics that are needed by the polynomial approximations in
+// BatchOps.Math.hpp, and are deliberately free of any engine headers, so they can be included into
+// translation units that are compiled with different instruction set options.
+//
+// Comparison operators return masks where every bit of the lane is set, if comparison is true.
+
+//! Represents a pack of 2 double-precision floating point numbers.
+struct Sse2Double
+{
+	typedef double Scalar;
+	static const int Width = 2;
+
+	__m128d v;
+
+	Sse2Double()
+	{}
+	Sse2Double(__m128d value)
+		: v(value)
+	{}
+	//! Creates a pack where every lane is equal to given value.
+	explicit Sse2Double(double value)
+		: v(_mm_set1_pd(value))
+	{}
+
+	static Sse2Double Load(const double *ptr)
+	{
+		return _mm_loadu_pd(ptr);
+	}
+	void Store(double *ptr) const
+	{
+		_mm_storeu_pd(ptr, this->v);
+	}
+
+	static Sse2Double SignMask()
+	{
+		return _mm_castsi128_pd(_mm_set_epi32(0x80000000, 0, 0x80000000, 0));
+	}
+	static Sse2Double Infinity()
+	{
+		return _mm_castsi128_pd(_mm_set_epi32(0x7ff00000, 0, 0x7ff00000, 0));
+	}
+	static Sse2Double NaN()
+	{
+		return _mm_castsi128_pd(_mm_set_epi32(0x7ff80000, 0, 0x7ff80000, 0));
+	}
+	//! Creates a pack from integral values that are stored as floating point numbers.
+	//!
+	//! Every lane must be within the range of normal exponents.
+	static Sse2Double Pow2(Sse2Double exponent)
+	{
+		__m128i n = _mm_add_epi32(_mm_cvtpd_epi32(exponent.v), _mm_set1_epi32(1023));
+		// Move each 32-bit value into the lower half of its 64-bit lane, the garbage in upper half is
+		// shifted out.
+		n = _mm_shuffle_epi32(n, _MM_SHUFFLE(1, 1, 0, 0));
+		return _mm_castsi128_pd(_mm_slli_epi64(n, 52));
+	}
+	//! Splits a positive normal number into a mantissa within [0.5; 1) range and exponent.
+	static Sse2Double Frexp(Sse2Double x, Sse2Double &exponent)
+	{
+		__m128i bits = _mm_castpd_si128(x.v);
+		__m128i e = _mm_srli_epi64(bits, 52);
+		e = _mm_shuffle_epi32(e, _MM_SHUFFLE(3, 1, 2, 0));
+		exponent = _mm_sub_pd(_mm_cvtepi32_pd(e), _mm_set1_pd(1022));
+		__m128i mantissaMask = _mm_set_epi32(0x800fffff, 0xffffffff, 0x800fffff, 0xffffffff);
+		__m128i half = _mm_set_epi32(0x3fe00000, 0, 0x3fe00000, 0);
+		return _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(bits, mantissaMask), half));
+	}
+};
+
+inline Sse2Double operator +(Sse2Double a, Sse2Double b) { return _mm_add_pd(a.v, b.v); }
+inline Sse2Double operator -(Sse2Double a, Sse2Double b) { return _mm_sub_pd(a.v, b.v); }
+inline Sse2Double operator *(Sse2Double a, Sse2Double b) { return _mm_mul_pd(a.v, b.v); }
+inline Sse2Double operator /(Sse2Double a, Sse2Double b) { return _mm_div_pd(a.v, b.v); }
+inline Sse2Double operator &(Sse2Double a, Sse2Double b) { return _mm_and_pd(a.v, b.v); }
+inline Sse2Double operator |(Sse2Double a, Sse2Double b) { return _mm_or_pd(a.v, b.v); }
+inline Sse2Double operator ^(Sse2Double a, Sse2Double b) { return _mm_xor_pd(a.v, b.v); }
+inline Sse2Double operator <(Sse2Double a, Sse2Double b) { return _mm_cmplt_pd(a.v, b.v); }
+inline Sse2Double operator <=(Sse2Double a, Sse2Double b) { return _mm_cmple_pd(a.v, b.v); }
+inline Sse2Double operator >(Sse2Double a, Sse2Double b) { return _mm_cmpgt_pd(a.v, b.v); }
+inline Sse2Double operator >=(Sse2Double a, Sse2Double b) { return _mm_cmpge_pd(a.v, b.v); }
+inline Sse2Double operator ==(Sse2Double a, Sse2Double b) { return _mm_cmpeq_pd(a.v, b.v); }
+
+//! Calculates a * b + c.
+inline Sse2Double MulAdd(Sse2Double a, Sse2Double b, Sse2Double c) { return _mm_add_pd(_mm_mul_pd(a.v, b.v), c.v); }
+inline Sse2Double Sqrt(Sse2Double a) { return _mm_sqrt_pd(a.v); }
+inline Sse2Double Min(Sse2Double a, Sse2Double b) { return _mm_min_pd(a.v, b.v); }
+inline Sse2Double Max(Sse2Double a, Sse2Double b) { return _mm_max_pd(a.v, b.v); }
+inline Sse2Double Abs(Sse2Double a) { return _mm_andnot_pd(Sse2Double::SignMask().v, a.v); }
+//! Picks lanes from a where mask is set, and from b otherwise.
+inline Sse2Double Select(Sse2Double mask, Sse2Double a, Sse2Double b)
+{
+	return _mm_or_pd(_mm_and_pd(mask.v, a.v), _mm_andnot_pd(mask.v, b.v));
+}
+//! Rounds every lane to the nearest integer. Lanes must be within the range of 32-bit integers.
+inline Sse2Double Round(Sse2Double a) { return _mm_cvtepi32_pd(_mm_cvtpd_epi32(a.v)); }
+//! Determines whether any lane of the mask is set.
+inline bool Any(Sse2Double mask) { return _mm_movemask_pd(mask.v) != 0; }
+//! Determines whether all lanes of the mask are set.
+inline bool All(Sse2Double mask) { return _mm_movemask_pd(mask.v) == 0x3; }
+//! Calculates the rounding error of the product that was calculated as a * b.
+inline Sse2Double ProductError(Sse2Double a, Sse2Double b, Sse2Double product)
+{
+	// Dekker's algorithm: factors are split into halves that can be multiplied exactly. Factors must
+	// be below 2^996.
+	Sse2Double splitter(134217729.0);
+	Sse2Double ac = a * splitter;
+	Sse2Double bc = b * splitter;
+	Sse2Double aHigh = ac - (ac - a);
+	Sse2Double bHigh = bc - (bc - b);
+	Sse2Double aLow = a - aHigh;
+	Sse2Double bLow = b - bHigh;
+	return (((aHigh * bHigh - product) + aHigh * bLow) + aLow * bHigh) + aLow * bLow;
+}
+
+//! Represents a pack of 4 single-precision floating point numbers.
+struct Sse2Single
+{
+	typedef float Scalar;
+	typedef Sse2Double Wide;
+	static const int Width = 4;
+
+	__m128 v;
+
+	Sse2Single()
+	{}
+	Sse2Single(__m128 value)
+		: v(value)
+	{}
+	//! Creates a pack where every lane is equal to given value.
+	explicit Sse2Single(double value)
+		: v(_mm_set1_ps(float(value)))
+	{}
+
+	static Sse2Single Load(const float *ptr)
+	{
+		return _mm_loadu_ps(ptr);
+	}
+	void Store(float *ptr) const
+	{
+		_mm_storeu_ps(ptr, this->v);
+	}
+
+	static Sse2Single SignMask()
+	{
+		return _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+	}
+	static Sse2Single Infinity()
+	{
+		return _mm_castsi128_ps(_mm_set1_epi32(0x7f800000));
+	}
+	static Sse2Single NaN()
+	{
+		return _mm_castsi128_ps(_mm_set1_epi32(0x7fc00000));
+	}
+	//! Creates a pack from integral values that are stored as floating point numbers.
+	//!
+	//! Every lane must be within the range of normal exponents.
+	static Sse2Single Pow2(Sse2Single exponent)
+	{
+		__m128i n = _mm_add_epi32(_mm_cvtps_epi32(exponent.v), _mm_set1_epi32(127));
+		return _mm_castsi128_ps(_mm_slli_epi32(n, 23));
+	}
+	//! Splits a positive normal number into a mantissa within [0.5; 1) range and exponent.
+	static Sse2Single Frexp(Sse2Single x, Sse2Single &exponent)
+	{
+		__m128i bits = _mm_castps_si128(x.v);
+		__m128i e = _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126));
+		exponent = _mm_cvtepi32_ps(e);
+		__m128i mantissa = _mm_and_si128(bits, _mm_set1_epi32(0x807fffff));
+		return _mm_castsi128_ps(_mm_or_si128(mantissa, _mm_set1_epi32(0x3f000000)));
+	}
+	//! Converts the pack to double precision.
+	static void Widen(Sse2Single x, Sse2Double &low, Sse2Double &high)
+	{
+		low = _mm_cvtps_pd(x.v);
+		high = _mm_cvtps_pd(_mm_movehl_ps(x.v, x.v));
+	}
+	//! Converts 2 packs of double-precision numbers to a pack of single-precision ones.
+	static Sse2Single Narrow(Sse2Double low, Sse2Double high)
+	{
+		return _mm_movelh_ps(_mm_cvtpd_ps(low.v), _mm_cvtpd_ps(high.v));
+	}
+};
+
+inline Sse2Single operator +(Sse2Single a, Sse2Single b) { return _mm_add_ps(a.v, b.v); }
+inline Sse2Single operator -(Sse2Single a, Sse2Single b) { return _mm_sub_ps(a.v, b.v); }
+inline Sse2Single operator *(Sse2Single a, Sse2Single b) { return _mm_mul_ps(a.v, b.v); }
+inline Sse2Single operator /(Sse2Single a, Sse2Single b) { return _mm_div_ps(a.v, b.v); }
+inline Sse2Single operator &(Sse2Single a, Sse2Single b) { return _mm_and_ps(a.v, b.v); }
+inline Sse2Single operator |(Sse2Single a, Sse2Single b) { return _mm_or_ps(a.v, b.v); }
+inline Sse2Single operator ^(Sse2Single a, Sse2Single b) { return _mm_xor_ps(a.v, b.v); }
+inline Sse2Single operator <(Sse2Single a, Sse2Single b) { return _mm_cmplt_ps(a.v, b.v); }
+inline Sse2Single operator <=(Sse2Single a, Sse2Single b) { return _mm_cmple_ps(a.v, b.v); }
+inline Sse2Single operator >(Sse2Single a, Sse2Single b) { return _mm_cmpgt_ps(a.v, b.v); }
+inline Sse2Single operator >=(Sse2Single a, Sse2Single b) { return _mm_cmpge_ps(a.v, b.v); }
+inline Sse2Single operator ==(Sse2Single a, Sse2Single b) { return _mm_cmpeq_ps(a.v, b.v); }
+
+//! Calculates a * b + c.
+inline Sse2Single MulAdd(Sse2Single a, Sse2Single b, Sse2Single c) { return _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v); }
+inline Sse2Single Sqrt(Sse2Single a) { return _mm_sqrt_ps(a.v); }
+inline Sse2Single Min(Sse2Single a, Sse2Single b) { return _mm_min_ps(a.v, b.v); }
+inline Sse2Single Max(Sse2Single a, Sse2Single b) { return _mm_max_ps(a.v, b.v); }
+inline Sse2Single Abs(Sse2Single a) { return _mm_andnot_ps(Sse2Single::SignMask().v, a.v); }
+//! Picks lanes from a where mask is set, and from b otherwise.
+inline Sse2Single Select(Sse2Single mask, Sse2Single a, Sse2Single b)
+{
+	return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v));
+}
+//! Rounds every lane to the nearest integer. Lanes must be within the range of 32-bit integers.
+inline Sse2Single Round(Sse2Single a) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a.v)); }
+//! Determines whether any lane of the mask is set.
+inline bool Any(Sse2Single mask) { return _mm_movemask_ps(mask.v) != 0; }
+//! Determines whether all lanes of the mask are set.
+inline bool All(Sse2Single mask) { return _mm_movemask_ps(mask.v) == 0xf; }
@@ -1,233 +1,619 @@
 #include "stdafx.h"
 
 #include "BatchOps.h"
+#include "BatchOps.Parallel.h"
+
+#include <intrin.h>
 
 void BatchOps::InitializeInterops()
 {
 	REGISTER_METHOD(MathSimpleOpSingle);
 	REGISTER_METHOD(MathSimpleOpDouble);
+	REGISTER_METHOD(MathSimpleProgramSingle);
+	REGISTER_METHOD(MathSimpleProgramDouble);
 	REGISTER_METHOD(Math3NumberOpSingle);
 	REGISTER_METHOD(Math3NumberOpDouble);
+	REGISTER_METHOD(Math3NumberOpSingleArrays);
+	REGISTER_METHOD(Math3NumberOpDoubleArrays);
+	REGISTER_METHOD(GetAccuracy);
+	REGISTER_METHOD(SetAccuracy);
+
+	CryLogAlways("Batch operations will use %s kernels.", GetKernels().InstructionSet);
+
+	workers = new BatchWorkerPool();
+
+	if (gEnv && gEnv->pConsole)
+	{
+		gEnv->pConsole->Register("cil_BatchOpsParallelThreshold", &parallelThreshold, parallelThreshold, VF_NULL,
+								 "Minimal number of elements in a batch operation that makes it split between "
+								 "multiple threads.");
+		gEnv->pConsole->Register("cil_BatchOpsWorkers", &workerCount, workerCount, VF_NULL,
+								 "Number of threads (including the calling one) that process large batch "
+								 "operations. 0 - use one thread per logical processor, 1 - disable parallel "
+								 "processing.");
+		gEnv->pConsole->AddCommand("cil_BatchOpsBenchmark", Benchmark, VF_NULL,
+								   "Measures time it takes to calculate sines of an array of single-precision "
+								   "numbers with different number of threads. Usage: cil_BatchOpsBenchmark "
+								   "[number of elements]");
+	}
 }
 
-void BatchOps::MathSimpleOpSingle(float* numbers, __int64 count, MathSimpleOperations op)
+void BatchOps::Shutdown()
+{
+	if (gEnv && gEnv->pConsole)
+	{
+		gEnv->pConsole->UnregisterVariable("cil_BatchOpsParallelThreshold", true);
+		gEnv->pConsole->UnregisterVariable("cil_BatchOpsWorkers", true);
+		gEnv->pConsole->RemoveCommand("cil_BatchOpsBenchmark");
+	}
+
+	// Worker threads must be joined before the module is unloaded.
+	delete workers;
+	workers = nullptr;
+}
+
+BatchOpsAccuracy BatchOps::accuracy = BatchOpsAccuracyFast;
+int BatchOps::parallelThreshold = 65536;
+int BatchOps::workerCount = 0;
+BatchWorkerPool *BatchOps::workers = nullptr;
+
+//! Determines whether the processor and operating system support AVX2 and FMA3 instructions.
+static bool IsAvx2Supported()
+{
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+	{
+		return false;
+	}
+
+	__cpuid(info, 1);
+	bool fma = (info[2] & (1 << 12)) != 0;
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	bool avx = (info[2] & (1 << 28)) != 0;
+	// The OS must save YMM registers on context switches.
+	if (!fma || !osxsave || !avx || (_xgetbv(0) & 6) != 6)
+	{
+		return false;
+	}
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+}
+
+const BatchKernelTable &BatchOps::GetKernels()
+{
+	static const BatchKernelTable &kernels = IsAvx2Supported() ? Avx2BatchKernels : Sse2BatchKernels;
+	return kernels;
+}
+
+BatchOpsAccuracy BatchOps::GetAccuracy()
+{
+	return accuracy;
+}
+
+void BatchOps::SetAccuracy(BatchOpsAccuracy value)
+{
+	accuracy = value;
+}
+
+#pragma region Scalar Operations
+
+// Standard library versions of simple operations. They are used in precise mode, for the numbers at the end
+// of the array that don't fill a whole pack and for the packs that are not accepted by the kernels.
+
+static float CotangentSingle(float x) { return 1 / tanf(x); }
+static float ArccotangentSingle(float x) { return atanf(1 / x); }
+static float CotangentHyperbolicSingle(float x) { return 1 / tanhf(x); }
+static float ArccotangentHyperbolicSingle(float x) { return atanhf(1 / x); }
+
+static double CotangentDouble(double x) { return 1 / tan(x); }
+static double ArccotangentDouble(double x) { return atan(1 / x); }
+static double CotangentHyperbolicDouble(double x) { return 1 / tanh(x); }
+static double ArccotangentHyperbolicDouble(double x) { return atanh(1 / x); }
+
+template<typename NumberType, NumberType(*operation)(NumberType)>
+static void ApplyScalar(NumberType *numbers, __int64 count)
 {
 	for (__int64 i = 0; i < count; i++)
 	{
-		switch (op)
-		{
-		case Sine:
-			numbers[i] = sinf(numbers[i]);
-			break;
-		case Cosine:
-			numbers[i] = cosf(numbers[i]);
-			break;
-		case Tangent:
-			numbers[i] = tanf(numbers[i]);
-			break;
-		case Cotangent:
-			numbers[i] = 1 / tanf(numbers[i]);
-			break;
-		case Arcsine:
-			numbers[i] = asinf(numbers[i]);
-			break;
-		case Arccosine:
-			numbers[i] = acosf(numbers[i]);
-			break;
-		case Arctangent:
-			numbers[i] = atanf(numbers[i]);
-			break;
-		case Arccotangent:
-			numbers[i] = atanf(1 / numbers[i]);
-			break;
-		case SineHyperbolic:
-			numbers[i] = sinhf(numbers[i]);
-			break;
-		case CosineHyperbolic:
-			numbers[i] = coshf(numbers[i]);
-			break;
-		case TangentHyperbolic:
-			numbers[i] = tanhf(numbers[i]);
-			break;
-		case CotangentHyperbolic:
+		numbers[i] = operation(numbers[i]);
+	}
+}
+
+typedef void(*ScalarOperationSingle)(float *numbers, __int64 count);
+typedef void(*ScalarOperationDouble)(double *numbers, __int64 count);
+
+static const ScalarOperationSingle scalarOperationsSingle[MathSimpleOperationsCount] =
+{
+	ApplyScalar<float, sinf>,
+	ApplyScalar<float, cosf>,
+	ApplyScalar<float, tanf>,
+	ApplyScalar<float, CotangentSingle>,
+	ApplyScalar<float, asinf>,
+	ApplyScalar<float, acosf>,
+	ApplyScalar<float, atanf>,
+	ApplyScalar<float, ArccotangentSingle>,
+	ApplyScalar<float, sinhf>,
+	ApplyScalar<float, coshf>,
+	ApplyScalar<float, tanhf>,
+	ApplyScalar<float, CotangentHyperbolicSingle>,
+	ApplyScalar<float, asinhf>,
+	ApplyScalar<float, acoshf>,
+	ApplyScalar<float, atanhf>,
+	ApplyScalar<float, ArccotangentHyperbolicSingle>,
+	ApplyScalar<float, logf>,
+	ApplyScalar<float, log10f>,
+	ApplyScalar<float, expf>
+};
+
+static const ScalarOperationDouble scalarOperationsDouble[MathSimpleOperationsCount] =
+{
+	ApplyScalar<double, sin>,
+	ApplyScalar<double, cos>,
+	ApplyScalar<double, tan>,
+	ApplyScalar<double, CotangentDouble>,
+	ApplyScalar<double, asin>,
+	ApplyScalar<double, acos>,
+	ApplyScalar<double, atan>,
+	ApplyScalar<double, ArccotangentDouble>,
+	ApplyScalar<double, sinh>,
+	ApplyScalar<double, cosh>,
+	ApplyScalar<double, tanh>,
+	ApplyScalar<double, CotangentHyperbolicDouble>,
+	ApplyScalar<double, asinh>,
+	ApplyScalar<double, acosh>,
+	ApplyScalar<double, atanh>,
+	ApplyScalar<double, ArccotangentHyperbolicDouble>,
+	ApplyScalar<double, log>,
+	ApplyScalar<double, log10>,
+	ApplyScalar<double, exp>
+};
+
+static float LogarithmSingle(float x, float base) { return logf(x) / logf(base); }
+static double LogarithmDouble(double x, double base) { return log(x) / log(base); }
+
+template<typename NumberType, NumberType(*operation)(NumberType, NumberType)>
+static void ApplyScalar3(NumberType *x, NumberType *y, NumberType *z, __int64 count)
+{
+	for (__int64 i = 0; i < count; i++)
+	{
+		z[i] = operation(x[i], y[i]);
+	}
+}
+
+template<typename NumberType, NumberType(*sine)(NumberType), NumberType(*cosine)(NumberType)>
+static void ApplyScalarSineCosine(NumberType *x, NumberType *y, NumberType *z, __int64 count)
+{
+	for (__int64 i = 0; i < count; i++)
+	{
+		// Arrays of results can be the same as the array of arguments.
+		NumberType angle = x[i];
+		y[i] = sine(angle);
+		z[i] = cosine(angle);
+	}
+}
+
+typedef void(*Scalar3OperationSingle)(float *x, float *y, float *z, __int64 count);
+typedef void(*Scalar3OperationDouble)(double *x, double *y, double *z, __int64 count);
+
+static const Scalar3OperationSingle scalar3OperationsSingle[Math3NumberOperationsCount] =
+{
+	ApplyScalar3<float, powf>,
+	ApplyScalar3<float, LogarithmSingle>,
+	ApplyScalarSineCosine<float, sinf, cosf>,
+	ApplyScalar3<float, atan2f>
+};
+
+static const Scalar3OperationDouble scalar3OperationsDouble[Math3NumberOperationsCount] =
+{
+	ApplyScalar3<double, pow>,
+	ApplyScalar3<double, LogarithmDouble>,
+	ApplyScalarSineCosine<double, sin, cos>,
+	ApplyScalar3<double, atan2>
+};
+
+#pragma endregion
+
+//! Runs the vectorized kernel over the array, and lets the scalar code process whatever the kernel
+//! couldn't.
+template<typename NumberType>
+static void RunBatch(NumberType *numbers, __int64 count,
+					 __int64(*kernel)(NumberType *, __int64), void(*scalar)(NumberType *, __int64),
+					 __int64 width)
+{
+	__int64 i = 0;
+	while (i < count)
+	{
+		i += kernel(numbers + i, count - i);
+
+		// Either the tail of the array or a pack that was not accepted by the kernel.
+		__int64 left = count - i < width ? count - i : width;
+		scalar(numbers + i, left);
+		i += left;
+	}
+}
+
+//! Runs the vectorized kernel over 3 arrays, and lets the scalar code process whatever the kernel
+//! couldn't.
+template<typename NumberType>
+static void RunBatch3(NumberType *x, NumberType *y, NumberType *z, __int64 count,
+					  __int64(*kernel)(NumberType *, NumberType *, NumberType *, __int64),
+					  void(*scalar)(NumberType *, NumberType *, NumberType *, __int64), __int64 width)
+{
+	__int64 i = 0;
+	while (i < count)
+	{
+		i += kernel(x + i, y + i, z + i, count - i);
+
+		__int64 left = count - i < width ? count - i : width;
+		scalar(x + i, y + i, z + i, left);
+		i += left;
+	}
+}
+
+#pragma region Batches
+
+// Batches are descriptions of the work that can be processed in chunks by any thread.
+
+//! Number of bytes of every array that are processed by one thread at once. Chunks are small enough to
+//! stay in L2 cache, and big enough to make the cost of picking them up negligible.
+static const __int64 ChunkBytes = 64 * 1024;
+
+//! Number of vectors that are transposed into separate arrays at once. Arrays of this length fit into
+//! L1 cache even when double-precision numbers are used.
+static const int TransposeBlockLength = 256;
+
+//! Represents a simple operation over an array of numbers.
+template<typename NumberType>
+struct SimpleBatch
+{
+	NumberType *Numbers;
+	__int64(*Kernel)(NumberType *, __int64);	//!< Null in precise mode.
+	void(*Scalar)(NumberType *, __int64);
+	__int64 Width;
+
+	static __int64 ChunkLength()
+	{
+		return ChunkBytes / sizeof(NumberType);
+	}
+	void Process(__int64 start, __int64 length) const
+	{
+		if (this->Kernel)
 		{
-			float doubleExp = expf(2 * numbers[i]);
-			numbers[i] = doubleExp + 1 / doubleExp - 1;
+			RunBatch(this->Numbers + start, length, this->Kernel, this->Scalar, this->Width);
 		}
-			break;
-		case ArcsineHyperbolic:
+		else
 		{
-			float value = numbers[i];
-			numbers[i] = logf(value + sqrtf(1 + value * value));
+			this->Scalar(this->Numbers + start, length);
 		}
-			break;
-		case ArccosineHyperbolic:
+	}
+};
+
+//! Represents an operation over 3 arrays of numbers.
+template<typename NumberType>
+struct Batch3
+{
+	NumberType *X;
+	NumberType *Y;
+	NumberType *Z;
+	__int64(*Kernel)(NumberType *, NumberType *, NumberType *, __int64);	//!< Null in precise mode.
+	void(*Scalar)(NumberType *, NumberType *, NumberType *, __int64);
+	__int64 Width;
+
+	static __int64 ChunkLength()
+	{
+		return ChunkBytes / sizeof(NumberType);
+	}
+	void Process(__int64 start, __int64 length) const
+	{
+		if (this->Kernel)
 		{
-			float value = numbers[i];
-			numbers[i] = logf(value + sqrtf(value + 1) * sqrtf(value - 1));
+			RunBatch3(this->X + start, this->Y + start, this->Z + start, length, this->Kernel, this->Scalar,
+					  this->Width);
 		}
-			break;
-		case ArctangentHyperbolic:
+		else
 		{
-			float value = numbers[i];
-			numbers[i] = (logf(1 + value) - logf(1 - value)) / 2.0f;
+			this->Scalar(this->X + start, this->Y + start, this->Z + start, length);
 		}
-			break;
-		case ArccotangentHyperbolic:
+	}
+};
+
+//! Represents an operation over an array of vectors. Blocks of vectors are transposed into 3 arrays,
+//! processed and written back.
+template<typename VectorType, typename NumberType>
+struct VectorBatch
+{
+	VectorType *Vectors;
+	Batch3<NumberType> Arrays;		//!< Array pointers are ignored.
+
+	static __int64 ChunkLength()
+	{
+		return ChunkBytes / sizeof(VectorType) / TransposeBlockLength * TransposeBlockLength;
+	}
+	void Process(__int64 start, __int64 length) const
+	{
+		NumberType x[TransposeBlockLength];
+		NumberType y[TransposeBlockLength];
+		NumberType z[TransposeBlockLength];
+
+		Batch3<NumberType> block = this->Arrays;
+		block.X = x;
+		block.Y = y;
+		block.Z = z;
+
+		for (__int64 i = start; i < start + length; i += TransposeBlockLength)
 		{
-			float in = 1 / numbers[i];
-			numbers[i] = (logf(1 + in) - logf(1 - in)) / 2.0f;
+			VectorType *vectors = this->Vectors + i;
+			__int64 left = start + length - i;
+			int blockLength = left < TransposeBlockLength ? int(left) : TransposeBlockLength;
+
+			for (int j = 0; j < blockLength; j++)
+			{
+				x[j] = vectors[j].x;
+				y[j] = vectors[j].y;
+				z[j] = vectors[j].z;
+			}
+
+			block.Process(0, blockLength);
+
+			// X-coordinates are never changed.
+			for (int j = 0; j < blockLength; j++)
+			{
+				vectors[j].y = y[j];
+				vectors[j].z = z[j];
+			}
 		}
-			break;
-		case LogarithmNatural:
-			numbers[i] = logf(numbers[i]);
-			break;
-		case LogarithmDecimal:
-			numbers[i] = log10f(numbers[i]);
-			break;
-		case Exponent:
-			numbers[i] = expf(numbers[i]);
-			break;
-		default:
-			break;
+	}
+};
+
+//! Number of numbers that every operation of the program is applied to, before the next operation is
+//! applied. Blocks stay in L1 cache for the whole program.
+static const int ProgramBlockLength = 2048;
+
+//! Represents a sequence of simple operations over an array of numbers. Operations are applied to
+//! blocks of numbers one after another, so the array is read from memory once.
+template<typename NumberType>
+struct ProgramBatch
+{
+	SimpleBatch<NumberType> Operations[BatchOps::MaxProgramLength];
+	int OperationCount;
+
+	static __int64 ChunkLength()
+	{
+		return ChunkBytes / sizeof(NumberType);
+	}
+	void Process(__int64 start, __int64 length) const
+	{
+		for (__int64 i = start; i < start + length; i += ProgramBlockLength)
+		{
+			__int64 left = start + length - i;
+			__int64 blockLength = left < ProgramBlockLength ? left : ProgramBlockLength;
+
+			for (int j = 0; j < this->OperationCount; j++)
+			{
+				this->Operations[j].Process(i, blockLength);
+			}
 		}
 	}
+};
+
+static SimpleBatch<float> CreateBatch(float *numbers, MathSimpleOperations op)
+{
+	const BatchKernelTable &kernels = BatchOps::GetKernels();
+	bool precise = BatchOps::GetAccuracy() == BatchOpsAccuracyPrecise;
+
+	SimpleBatch<float> batch =
+	{
+		numbers, precise ? nullptr : kernels.SimpleSingle[op], scalarOperationsSingle[op], kernels.SingleWidth
+	};
+	return batch;
+}
+
+static SimpleBatch<double> CreateBatch(double *numbers, MathSimpleOperations op)
+{
+	const BatchKernelTable &kernels = BatchOps::GetKernels();
+	bool precise = BatchOps::GetAccuracy() == BatchOpsAccuracyPrecise;
+
+	SimpleBatch<double> batch =
+	{
+		numbers, precise ? nullptr : kernels.SimpleDouble[op], scalarOperationsDouble[op], kernels.DoubleWidth
+	};
+	return batch;
+}
+
+static Batch3<float> CreateBatch(float *x, float *y, float *z, Math3NumberOperations op)
+{
+	const BatchKernelTable &kernels = BatchOps::GetKernels();
+	bool precise = BatchOps::GetAccuracy() == BatchOpsAccuracyPrecise;
+
+	Batch3<float> batch =
+	{
+		x, y, z, precise ? nullptr : kernels.ThreeNumberSingle[op], scalar3OperationsSingle[op],
+		kernels.SingleWidth
+	};
+	return batch;
+}
+
+static Batch3<double> CreateBatch(double *x, double *y, double *z, Math3NumberOperations op)
+{
+	const BatchKernelTable &kernels = BatchOps::GetKernels();
+	bool precise = BatchOps::GetAccuracy() == BatchOpsAccuracyPrecise;
+
+	Batch3<double> batch =
+	{
+		x, y, z, precise ? nullptr : kernels.ThreeNumberDouble[op], scalar3OperationsDouble[op],
+		kernels.DoubleWidth
+	};
+	return batch;
+}
+
+template<typename Batch>
+static void ProcessChunk(void *batch, __int64 start, __int64 length)
+{
+	static_cast<Batch *>(batch)->Process(start, length);
+}
+
+#pragma endregion
+
+template<typename Batch>
+void BatchOps::Execute(Batch &batch, __int64 count)
+{
+	if (count < parallelThreshold || !workers)
+	{
+		batch.Process(0, count);
+		return;
+	}
+
+	int threadCount = workerCount > 0 ? workerCount : BatchWorkerPool::GetProcessorCount();
+	workers->Run(ProcessChunk<Batch>, &batch, count, Batch::ChunkLength(), threadCount);
+}
+
+void BatchOps::MathSimpleOpSingle(float* numbers, __int64 count, MathSimpleOperations op)
+{
+	if (op < 0 || op >= MathSimpleOperationsCount)
+	{
+		return;
+	}
+
+	SimpleBatch<float> batch = CreateBatch(numbers, op);
+	Execute(batch, count);
 }
 
 void BatchOps::MathSimpleOpDouble(double* numbers, __int64 count, MathSimpleOperations op)
 {
-	for (__int64 i = 0; i < count; i++)
+	if (op < 0 || op >= MathSimpleOperationsCount)
 	{
-		switch (op)
-		{
-		case Sine:
-			numbers[i] = sin(numbers[i]);
-			break;
-		case Cosine:
-			numbers[i] = cos(numbers[i]);
-			break;
-		case Tangent:
-			numbers[i] = tan(numbers[i]);
-			break;
-		case Cotangent:
-			numbers[i] = 1 / tan(numbers[i]);
-			break;
-		case Arcsine:
-			numbers[i] = asin(numbers[i]);
-			break;
-		case Arccosine:
-			numbers[i] = acos(numbers[i]);
-			break;
-		case Arctangent:
-			numbers[i] = atan(numbers[i]);
-			break;
-		case Arccotangent:
-			numbers[i] = atan(1 / numbers[i]);
-			break;
-		case SineHyperbolic:
-			numbers[i] = sinh(numbers[i]);
-			break;
-		case CosineHyperbolic:
-			numbers[i] = cosh(numbers[i]);
-			break;
-		case TangentHyperbolic:
-			numbers[i] = tanh(numbers[i]);
-			break;
-		case CotangentHyperbolic:
-		{
-			double doubleExp = exp(2 * numbers[i]);
-			numbers[i] = doubleExp + 1 / doubleExp - 1;
-		}
-			break;
-		case ArcsineHyperbolic:
-		{
-			double value = numbers[i];
-			numbers[i] = log(value + sqrt(1 + value * value));
-		}
-			break;
-		case ArccosineHyperbolic:
-		{
-			double value = numbers[i];
-			numbers[i] = log(value + sqrt(value + 1) * sqrt(value - 1));
-		}
-			break;
-		case ArctangentHyperbolic:
-		{
-			double value = numbers[i];
-			numbers[i] = (log(1 + value) - log(1 - value)) / 2.0f;
-		}
-			break;
-		case ArccotangentHyperbolic:
+		return;
+	}
+
+	SimpleBatch<double> batch = CreateBatch(numbers, op);
+	Execute(batch, count);
+}
+
+template<typename NumberType>
+void BatchOps::ExecuteProgram(NumberType *numbers, __int64 count, MathSimpleOperations *ops, int opCount)
+{
+	if (opCount <= 0 || opCount > MaxProgramLength)
+	{
+		return;
+	}
+
+	ProgramBatch<NumberType> batch;
+	batch.OperationCount = opCount;
+	for (int i = 0; i < opCount; i++)
+	{
+		MathSimpleOperations op = ops[i];
+		if (op < 0 || op >= MathSimpleOperationsCount)
 		{
-			double in = 1 / numbers[i];
-			numbers[i] = (log(1 + in) - log(1 - in)) / 2.0f;
-		}
-			break;
-		case LogarithmNatural:
-			numbers[i] = log(numbers[i]);
-			break;
-		case LogarithmDecimal:
-			numbers[i] = log10(numbers[i]);
-			break;
-		case Exponent:
-			numbers[i] = exp(numbers[i]);
-			break;
-		default:
-			break;
+			return;
 		}
+		batch.Operations[i] = CreateBatch(numbers, op);
 	}
+
+	Execute(batch, count);
+}
+
+void BatchOps::MathSimpleProgramSingle(float *numbers, __int64 count, MathSimpleOperations *ops, int opCount)
+{
+	ExecuteProgram(numbers, count, ops, opCount);
+}
+
+void BatchOps::MathSimpleProgramDouble(double *numbers, __int64 count, MathSimpleOperations *ops, int opCount)
+{
+	ExecuteProgram(numbers, count, ops, opCount);
 }
 
 void BatchOps::Math3NumberOpSingle(Vec3* numbers, __int64 count, Math3NumberOperations op)
 {
-	for (__int64 i = 0; i < count; i++)
+	if (op < 0 || op >= Math3NumberOperationsCount)
 	{
-		Vec3 v = numbers[i];
-		switch (op)
-		{
-		case Power:
-			v.z = powf(v.x, v.y);
-			break;
-		case Logarithm:
-			v.z = logf(v.x) / logf(v.y);
-			break;
-		case SineCosine:
-			v.y = sinf(v.x);
-			v.z = sqrtf(v.y * v.y - 1);
-			break;
-		case Arctangent2:
-			v.z = atan2f(v.x, v.y);
-			break;
-		default:
-			break;
-		}
-		numbers[i] = v;
+		return;
 	}
+
+	float *none = nullptr;
+	VectorBatch<Vec3, float> batch = { numbers, CreateBatch(none, none, none, op) };
+	Execute(batch, count);
 }
 
 void BatchOps::Math3NumberOpDouble(Vec3d* numbers, __int64 count, Math3NumberOperations op)
 {
-	for (__int64 i = 0; i < count; i++)
+	if (op < 0 || op >= Math3NumberOperationsCount)
 	{
-		Vec3d v = numbers[i];
-		switch (op)
+		return;
+	}
+
+	double *none = nullptr;
+	VectorBatch<Vec3d, double> batch = { numbers, CreateBatch(none, none, none, op) };
+	Execute(batch, count);
+}
+
+void BatchOps::Math3NumberOpSingleArrays(float *x, float *y, float *z, __int64 count, Math3NumberOperations op)
+{
+	if (op < 0 || op >= Math3NumberOperationsCount)
+	{
+		return;
+	}
+
+	Batch3<float> batch = CreateBatch(x, y, z, op);
+	Execute(batch, count);
+}
+
+void BatchOps::Math3NumberOpDoubleArrays(double *x, double *y, double *z, __int64 count,
+										 Math3NumberOperations op)
+{
+	if (op < 0 || op >= Math3NumberOperationsCount)
+	{
+		return;
+	}
+
+	Batch3<double> batch = CreateBatch(x, y, z, op);
+	Execute(batch, count);
+}
+
+void BatchOps::Benchmark(IConsoleCmdArgs *args)
+{
+	__int64 count = 4 * 1024 * 1024;
+	if (args->GetArgCount() > 1)
+	{
+		count = atoi(args->GetArg(1));
+		if (count <= 0)
 		{
-		case Power:
-			v.z = pow(v.x, v.y);
-			break;
-		case Logarithm:
-			v.z = log(v.x) / log(v.y);
-			break;
-		case SineCosine:
-			v.y = sin(v.x);
-			v.z = sqrt(v.y * v.y - 1);
-			break;
-		case Arctangent2:
-			v.z = atan2(v.x, v.y);
-			break;
-		default:
-			break;
+			CryLogAlways("Number of elements must be positive.");
+			return;
 		}
-		numbers[i] = v;
 	}
-}
\ No newline at end of file
+
+	float *numbers = new float[count];
+	int processorCount = BatchWorkerPool::GetProcessorCount();
+	int threshold = parallelThreshold;
+	int threads = workerCount;
+	parallelThreshold = 0;
+
+	CryLogAlways("Calculating sines of %lld numbers with %s kernels:", count, GetKernels().InstructionSet);
+
+	float singleThreadTime = 0;
+	for (int threadCount = 1; threadCount <= processorCount; threadCount++)
+	{
+		for (__int64 i = 0; i < count; i++)
+		{
+			numbers[i] = float(i % 3600) * 0.1f;
+		}
+		workerCount = threadCount;
+
+		CTimeValue start = gEnv->pTimer->GetAsyncTime();
+		MathSimpleOpSingle(numbers, count, Sine);
+		float time = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+		if (threadCount == 1)
+		{
+			singleThreadTime = time;
+		}
+		CryLogAlways("%2d thread(s): %8.2f ms, speed-up %.2f", threadCount, time,
+					 time > 0 ? singleThreadTime / time : 0.0f);
+	}
+
+	parallelThreshold = threshold;
+	workerCount = threads;
+	delete[] numbers;
+}
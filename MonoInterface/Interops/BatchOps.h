@@ -1,47 +1,46 @@
 #pragma once
 
 #include "IMonoInterface.h"
+#include "BatchOps.Kernels.h"
 
-enum MathSimpleOperations
-{
-	Sine = 0,
-	Cosine,
-	Tangent,
-	Cotangent,
-	Arcsine,
-	Arccosine,
-	Arctangent,
-	Arccotangent,
-	SineHyperbolic,
-	CosineHyperbolic,
-	TangentHyperbolic,
-	CotangentHyperbolic,
-	ArcsineHyperbolic,
-	ArccosineHyperbolic,
-	ArctangentHyperbolic,
-	ArccotangentHyperbolic,
-	LogarithmNatural,
-	LogarithmDecimal,
-	Exponent
-};
-
-enum Math3NumberOperations
-{
-	Power = 0,
-	Logarithm,
-	SineCosine,
-	Arctangent2
-};
+struct BatchWorkerPool;
 
-struct BatchOps : public IMonoInterop<true>
+struct BatchOps : public IMonoInterop<false, true>
 {
 	virtual const char *GetInteropClassName() override { return "BatchOps"; }
 	virtual const char *GetInteropNameSpace() override { return "CryCil"; }
 
 	virtual void InitializeInterops() override;
 
+	virtual void Shutdown() override;
+
+	//! Maximal number of operations in one program.
+	static const int MaxProgramLength = 32;
+
+	//! Gets the set of vectorized kernels that is supported by the processor.
+	static const BatchKernelTable &GetKernels();
+
 	static void MathSimpleOpSingle(float* numbers, __int64 count, MathSimpleOperations op);
 	static void MathSimpleOpDouble(double* numbers, __int64 count, MathSimpleOperations op);
+	//! Applies a sequence of simple operations to every number in a single pass over the array.
+	static void MathSimpleProgramSingle(float *numbers, __int64 count, MathSimpleOperations *ops, int opCount);
+	static void MathSimpleProgramDouble(double *numbers, __int64 count, MathSimpleOperations *ops, int opCount);
 	static void Math3NumberOpSingle(Vec3* numbers, __int64 count, Math3NumberOperations op);
 	static void Math3NumberOpDouble(Vec3d* numbers, __int64 count, Math3NumberOperations op);
+	static void Math3NumberOpSingleArrays(float *x, float *y, float *z, __int64 count, Math3NumberOperations op);
+	static void Math3NumberOpDoubleArrays(double *x, double *y, double *z, __int64 count, Math3NumberOperations op);
+	static BatchOpsAccuracy GetAccuracy();
+	static void SetAccuracy(BatchOpsAccuracy value);
+private:
+	//! Processes the batch on the calling thread, or splits it between worker threads, if it's big enough.
+	template<typename Batch>
+	static void Execute(Batch &batch, __int64 count);
+	template<typename NumberType>
+	static void ExecuteProgram(NumberType *numbers, __int64 count, MathSimpleOperations *ops, int opCount);
+	static void Benchmark(IConsoleCmdArgs *args);
+
+	static BatchOpsAccuracy accuracy;
+	static int parallelThreshold;
+	static int workerCount;
+	static BatchWorkerPool *workers;
 };
\ No newline at end of file
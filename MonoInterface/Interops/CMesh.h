@@ -8,6 +8,7 @@ struct CMeshInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.StaticObjects"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void        *GetStreamPtr(CMesh *handle, int stream, int *pElementCount);
 	static void         ReallocateStream(CMesh *handle, int stream, int newCount);
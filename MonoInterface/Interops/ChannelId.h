@@ -8,6 +8,7 @@ struct ChannelIdInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Network"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static INetChannel *GetChannel(ushort id);
 };
\ No newline at end of file
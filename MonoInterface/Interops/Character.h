@@ -11,6 +11,7 @@ struct CharacterInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void AddRef(ICharacterInstance *handle);
 	static void Release(ICharacterInstance *handle);
@@ -11,6 +11,7 @@ struct CharacterAnimationInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void Serialize(CAnimation *handle, ISerialize *ser);
 	static SParametricSampler *GetParametricSampler(CAnimation *handle);
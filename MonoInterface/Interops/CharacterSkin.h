@@ -10,6 +10,7 @@ struct CharacterSkinInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IRenderMesh *GetIRenderMesh(ISkin *handle, uint nLOD);
 	static mono::string GetModelFilePath(ISkin *handle);
@@ -41,7 +41,7 @@ void ConsoleInterop::UnregisterCommandInternal(mono::string name)
 {
 	if (gEnv && gEnv->pConsole)
 	{
-		gEnv->pConsole->RemoveCommand(NtText(name));
+		gEnv->pConsole->RemoveCommand(ScratchText(name));
 	}
 }
 
@@ -53,7 +53,7 @@ void ConsoleInterop::ExecuteCommand(mono::string command, bool silent, bool defe
 		{
 			ArgumentNullException("Name of the command to execute cannot be null.").Throw();
 		}
-		gEnv->pConsole->ExecuteString(NtText(command), silent, deferExecution);
+		gEnv->pConsole->ExecuteString(ScratchText(command), silent, deferExecution);
 	}
 }
 
@@ -128,7 +128,7 @@ void ConsoleInterop::UnregisterVariable(mono::string name, bool _delete)
 		{
 			ArgumentNullException("Name of the console variable to unregister cannot be null.").Throw();
 		}
-		gEnv->pConsole->UnregisterVariable(NtText(name), _delete);
+		gEnv->pConsole->UnregisterVariable(ScratchText(name), _delete);
 	}
 }
 
@@ -140,7 +140,7 @@ ICVar *ConsoleInterop::GetVariable(mono::string name)
 		{
 			ArgumentNullException("Cannot get a console variable using a null name.").Throw();
 		}
-		return gEnv->pConsole->GetCVar(NtText(name));
+		return gEnv->pConsole->GetCVar(ScratchText(name));
 	}
 	return nullptr;
 }
@@ -10,6 +10,7 @@ struct ConsoleVariableInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void         Release        (ICVar **handle);
 	static void         ClearFlags     (ICVar **handle, int flags);
@@ -11,6 +11,7 @@ struct CryActionMapInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Input.ActionMapping"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IActionMapAction *GetAction(IActionMap *handle, mono::string name);
 	static IActionMapAction *CreateActionInternal(IActionMap *handle, mono::string name);
@@ -8,6 +8,7 @@ struct CryArchiveInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Files"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static uint get_Flags(mono::object obj);
 	static void set_Flags(mono::object obj, uint _value);
@@ -8,6 +8,7 @@ struct CryAudioProxyInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Audio"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void Init(IAudioProxy *handle, mono::string sObjectName, bool bInitAsync);
 	static void ReleaseInternal(IAudioProxy *handle);
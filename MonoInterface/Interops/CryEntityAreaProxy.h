@@ -8,6 +8,7 @@ struct CryEntityAreaProxyInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic.EntityProxies"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void SetFlags(IEntityAreaProxy *handle, int nAreaProxyFlags);
 	static int GetFlags(IEntityAreaProxy *handle);
@@ -8,6 +8,7 @@ struct CryEntityAudioProxyInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic.EntityProxies"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void SetFadeDistance(IEntityAudioProxy *handle, float fFadeDistance);
 	static float GetFadeDistance(IEntityAudioProxy *handle);
@@ -8,6 +8,7 @@ struct CryEntityCameraProxyInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic.EntityProxies"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void SetCamera(IEntityCameraProxy *handle, CCamera &cam);
 	static void GetCamera(IEntityCameraProxy *handle, CCamera &cam);
@@ -10,6 +10,7 @@ struct CryEntityPhysicalProxyInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic.EntityProxies"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void AssignPhysicalEntity(IEntityPhysicalProxy *handle, IPhysicalEntity *pPhysEntity, int nSlot);
 	static void GetWorldBounds(IEntityPhysicalProxy *handle, AABB &bounds);
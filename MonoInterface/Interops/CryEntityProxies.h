@@ -8,6 +8,7 @@ struct CryEntityProxiesInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic.EntityProxies"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IEntityAreaProxy *GetAreaProxy(IEntity *handle);
 	static IEntityAudioProxy *GetAudioProxy(IEntity *handle);
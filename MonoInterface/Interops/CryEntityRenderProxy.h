@@ -8,6 +8,7 @@ struct CryEntityRenderProxyInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic.EntityProxies"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void GetWorldBounds(IEntityRenderProxy *handle, AABB &bounds);
 	static void GetLocalBounds(IEntityRenderProxy *handle, AABB &bounds);
@@ -8,6 +8,7 @@ struct CryEntityRopeProxyInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic.EntityProxies"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IRopeRenderNode *GetRopeRenderNode(IEntityRopeProxy *handle);
 };
\ No newline at end of file
@@ -8,6 +8,7 @@ struct CryEntitySubstitutionProxyInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic.EntityProxies"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void SetSubstitute(IEntitySubstitutionProxy *handle, IRenderNode *pSubstitute);
 	static IRenderNode *GetSubstitute(IEntitySubstitutionProxy *handle);
@@ -8,6 +8,7 @@ struct CryEntityTriggerProxyInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic.EntityProxies"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void SetTriggerBounds(IEntityTriggerProxy *handle, const AABB &bbox);
 	static void GetTriggerBounds(IEntityTriggerProxy *handle, AABB &bbox);
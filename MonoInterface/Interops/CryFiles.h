@@ -8,6 +8,7 @@ struct CryFilesInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Files"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static bool Exists(mono::string path, ICryPak::EFileSearchLocation location);
 	static bool IsFolder(mono::string path);
@@ -8,6 +8,7 @@ struct CryFontInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return ""; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void Ctor(mono::object obj, mono::string name);
 	static void Release(mono::object obj);
@@ -11,6 +11,7 @@ struct CryInputActionInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Input.ActionMapping"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static bool AddInputInternal(IActionMapAction *handle, EKeyId input, ActionInputSpecification spec);
 	static bool RemoveInputInternal(IActionMapAction *handle, EKeyId input);
@@ -7,6 +7,7 @@ struct CryMarshalInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Memory"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 	// Allocate an array of bytes of given length. Returns a pointer to the first byte.
 	// Allocated memory should not be referenced from unmanaged code, unless you have access
 	// to instance of INativeMemoryWrapper type that works with this memory and
@@ -8,6 +8,7 @@ struct CryNetChannelInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Network"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static bool GetIsLocal(INetChannel *handle);
 };
\ No newline at end of file
@@ -8,6 +8,7 @@ struct CryPakInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Files"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static mono::string OpenPack       (mono::string name, ICryPak::EPathResolutionRules rules);
 	static mono::string OpenPackRooted (mono::string root, mono::string name, ICryPak::EPathResolutionRules rules);
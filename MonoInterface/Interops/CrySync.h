@@ -8,6 +8,7 @@ struct CrySyncInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Data"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void FlagPartialRead(ISerialize *handle);
 	static void StartGroup(ISerialize *handle, const char *name);
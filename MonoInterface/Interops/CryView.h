@@ -9,6 +9,7 @@ struct CryViewInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering.Views"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void UpdateInternal(IView *handle, float frameTime, bool isActive);
 	static void LinkToInternal(IView *handle, IEntity *follow, bool gameObject);
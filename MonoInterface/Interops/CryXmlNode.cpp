@@ -63,7 +63,7 @@ void CryXmlNodeInterop::InitializeInterops()
 
 IXmlNode *CryXmlNodeInterop::Ctor(mono::string name)
 {
-	IXmlNode *node = GetISystem()->CreateXmlNode(NtText(name));
+	IXmlNode *node = GetISystem()->CreateXmlNode(ScratchText(name));
 	node->AddRef();
 
 	return node;
@@ -81,7 +81,7 @@ void CryXmlNodeInterop::Release(IXmlNode *handle)
 
 mono::string CryXmlNodeInterop::GetTagName(IXmlNode *handle)
 {
-	return ToMonoString(handle->getTag());
+	return ToMonoStringCached(handle->getTag());
 }
 
 int CryXmlNodeInterop::GetAttributeCount(IXmlNode *handle)
@@ -106,7 +106,7 @@ mono::string CryXmlNodeInterop::GetContent(IXmlNode *handle)
 
 void CryXmlNodeInterop::SetContent(IXmlNode *handle, mono::string name)
 {
-	handle->setContent(NtText(name));
+	handle->setContent(ScratchText(name));
 }
 
 IXmlNode *CryXmlNodeInterop::GetClone(IXmlNode *handle)
@@ -190,7 +190,7 @@ bool CryXmlNodeInterop::SaveInternal(IXmlNode *handle, mono::string file)
 		return false;
 	}
 
-	return handle->saveToFile(NtText(file));
+	return handle->saveToFile(ScratchText(file));
 }
 
 bool CryXmlNodeInterop::GetAttributeInternal(IXmlNode *handle, int index, mono::string &name, mono::string &value)
@@ -201,7 +201,7 @@ bool CryXmlNodeInterop::GetAttributeInternal(IXmlNode *handle, int index, mono::
 
 	if (success)
 	{
-		name = ToMonoString(ntName);
+		name = ToMonoStringCached(ntName);
 		value = ToMonoString(ntValue);
 	}
 	else
@@ -217,7 +217,7 @@ bool CryXmlNodeInterop::GetAttributestring(IXmlNode *handle, mono::string name,
 {
 	const char *ntValue;
 
-	bool success = handle->getAttr(NtText(name), &ntValue);
+	bool success = handle->getAttr(ScratchText(name), &ntValue);
 
 	if (success)
 	{
@@ -238,7 +238,7 @@ bool CryXmlNodeInterop::GetAttributeint(IXmlNode *handle, mono::string name, int
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributeuint(IXmlNode *handle, mono::string name, uint &value)
@@ -248,7 +248,7 @@ bool CryXmlNodeInterop::GetAttributeuint(IXmlNode *handle, mono::string name, ui
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributeint64(IXmlNode *handle, mono::string name, int64 &value)
@@ -258,7 +258,7 @@ bool CryXmlNodeInterop::GetAttributeint64(IXmlNode *handle, mono::string name, i
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributeuint64(IXmlNode *handle, mono::string name, uint64 &value, bool useHex)
@@ -268,7 +268,7 @@ bool CryXmlNodeInterop::GetAttributeuint64(IXmlNode *handle, mono::string name,
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value, useHex);
+	return handle->getAttr(ScratchText(name), value, useHex);
 }
 
 bool CryXmlNodeInterop::GetAttributefloat(IXmlNode *handle, mono::string name, float &value)
@@ -278,7 +278,7 @@ bool CryXmlNodeInterop::GetAttributefloat(IXmlNode *handle, mono::string name, f
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributedouble(IXmlNode *handle, mono::string name, double &value)
@@ -288,7 +288,7 @@ bool CryXmlNodeInterop::GetAttributedouble(IXmlNode *handle, mono::string name,
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributeVec2(IXmlNode *handle, mono::string name, Vec2 &value)
@@ -298,7 +298,7 @@ bool CryXmlNodeInterop::GetAttributeVec2(IXmlNode *handle, mono::string name, Ve
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributeVec2d(IXmlNode *handle, mono::string name, Vec2d &value)
@@ -308,7 +308,7 @@ bool CryXmlNodeInterop::GetAttributeVec2d(IXmlNode *handle, mono::string name, V
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributeAng3(IXmlNode *handle, mono::string name, Ang3 &value)
@@ -318,7 +318,7 @@ bool CryXmlNodeInterop::GetAttributeAng3(IXmlNode *handle, mono::string name, An
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributeVec3(IXmlNode *handle, mono::string name, Vec3 &value)
@@ -328,7 +328,7 @@ bool CryXmlNodeInterop::GetAttributeVec3(IXmlNode *handle, mono::string name, Ve
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributeVec3d(IXmlNode *handle, mono::string name, Vec3d &value)
@@ -338,7 +338,7 @@ bool CryXmlNodeInterop::GetAttributeVec3d(IXmlNode *handle, mono::string name, V
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributeVec4(IXmlNode *handle, mono::string name, Vec4 &value)
@@ -348,7 +348,7 @@ bool CryXmlNodeInterop::GetAttributeVec4(IXmlNode *handle, mono::string name, Ve
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::GetAttributeQuat(IXmlNode *handle, mono::string name, Quat &value)
@@ -358,7 +358,7 @@ bool CryXmlNodeInterop::GetAttributeQuat(IXmlNode *handle, mono::string name, Qu
 		return false;
 	}
 
-	return handle->getAttr(NtText(name), value);
+	return handle->getAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributestring(IXmlNode *handle, mono::string name, mono::string value)
@@ -368,7 +368,7 @@ void CryXmlNodeInterop::SetAttributestring(IXmlNode *handle, mono::string name,
 		return;
 	}
 
-	handle->setAttr(NtText(name), NtText(value));
+	handle->setAttr(ScratchText(name), ScratchText(value));
 }
 
 void CryXmlNodeInterop::SetAttributeint(IXmlNode *handle, mono::string name, int value)
@@ -378,7 +378,7 @@ void CryXmlNodeInterop::SetAttributeint(IXmlNode *handle, mono::string name, int
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributeuint(IXmlNode *handle, mono::string name, uint value)
@@ -388,7 +388,7 @@ void CryXmlNodeInterop::SetAttributeuint(IXmlNode *handle, mono::string name, ui
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributeint64(IXmlNode *handle, mono::string name, int64 value)
@@ -398,7 +398,7 @@ void CryXmlNodeInterop::SetAttributeint64(IXmlNode *handle, mono::string name, i
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributeuint64(IXmlNode *handle, mono::string name, uint64 value, bool useHex)
@@ -408,7 +408,7 @@ void CryXmlNodeInterop::SetAttributeuint64(IXmlNode *handle, mono::string name,
 		return;
 	}
 
-	handle->setAttr(NtText(name), value, useHex);
+	handle->setAttr(ScratchText(name), value, useHex);
 }
 
 void CryXmlNodeInterop::SetAttributefloat(IXmlNode *handle, mono::string name, float value)
@@ -418,7 +418,7 @@ void CryXmlNodeInterop::SetAttributefloat(IXmlNode *handle, mono::string name, f
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributedouble(IXmlNode *handle, mono::string name, double value)
@@ -428,7 +428,7 @@ void CryXmlNodeInterop::SetAttributedouble(IXmlNode *handle, mono::string name,
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributeVec2(IXmlNode *handle, mono::string name, Vec2 value)
@@ -438,7 +438,7 @@ void CryXmlNodeInterop::SetAttributeVec2(IXmlNode *handle, mono::string name, Ve
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributeVec2d(IXmlNode *handle, mono::string name, Vec2d value)
@@ -448,7 +448,7 @@ void CryXmlNodeInterop::SetAttributeVec2d(IXmlNode *handle, mono::string name, V
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributeAng3(IXmlNode *handle, mono::string name, Ang3 value)
@@ -458,7 +458,7 @@ void CryXmlNodeInterop::SetAttributeAng3(IXmlNode *handle, mono::string name, An
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributeVec3(IXmlNode *handle, mono::string name, Vec3 value)
@@ -468,7 +468,7 @@ void CryXmlNodeInterop::SetAttributeVec3(IXmlNode *handle, mono::string name, Ve
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributeVec3d(IXmlNode *handle, mono::string name, Vec3d value)
@@ -478,7 +478,7 @@ void CryXmlNodeInterop::SetAttributeVec3d(IXmlNode *handle, mono::string name, V
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributeVec4(IXmlNode *handle, mono::string name, Vec4 value)
@@ -488,7 +488,7 @@ void CryXmlNodeInterop::SetAttributeVec4(IXmlNode *handle, mono::string name, Ve
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 void CryXmlNodeInterop::SetAttributeQuat(IXmlNode *handle, mono::string name, Quat value)
@@ -498,7 +498,7 @@ void CryXmlNodeInterop::SetAttributeQuat(IXmlNode *handle, mono::string name, Qu
 		return;
 	}
 
-	handle->setAttr(NtText(name), value);
+	handle->setAttr(ScratchText(name), value);
 }
 
 bool CryXmlNodeInterop::HasAttributeInternal(IXmlNode *handle, mono::string name)
@@ -508,7 +508,7 @@ bool CryXmlNodeInterop::HasAttributeInternal(IXmlNode *handle, mono::string name
 		return false;
 	}
 
-	return handle->haveAttr(NtText(name));
+	return handle->haveAttr(ScratchText(name));
 }
 
 void CryXmlNodeInterop::CopyAttributesInternal(IXmlNode *handle, IXmlNode *node)
@@ -530,7 +530,7 @@ void CryXmlNodeInterop::RemoveAttributeInternal(IXmlNode *handle, mono::string n
 		return;
 	}
 
-	handle->delAttr(NtText(name));
+	handle->delAttr(ScratchText(name));
 }
 
 void CryXmlNodeInterop::RemoveAttributesInternal(IXmlNode *handle)
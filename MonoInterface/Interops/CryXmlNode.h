@@ -9,6 +9,7 @@ struct CryXmlNodeInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Utilities"; }
 	
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IXmlNode *Ctor(mono::string name);
 	static void      AddRef(IXmlNode *handle);
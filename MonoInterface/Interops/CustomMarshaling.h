@@ -8,6 +8,7 @@ struct CustomMarshalingInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Utilities"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static mono::string GetUtf8String(const char *stringHandle);
 };
\ No newline at end of file
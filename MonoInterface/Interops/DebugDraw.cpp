@@ -109,7 +109,7 @@ void DebugDrawInterop::Add2DText(mono::string text, float size, ColorF color, fl
 		auto d = gEnv->pGame->GetIGameFramework()->GetIPersistantDebug();
 		if (d)
 		{
-			d->Add2DText(NtText(text), size, color, timeout);
+			d->Add2DText(ScratchText(text), size, color, timeout);
 		}
 	}
 }
@@ -121,7 +121,7 @@ void DebugDrawInterop::AddText(float x, float y, float size, ColorF color, float
 		auto d = gEnv->pGame->GetIGameFramework()->GetIPersistantDebug();
 		if (d)
 		{
-			d->AddText(x, y, size, color, timeout, NtText(fmt));
+			d->AddText(x, y, size, color, timeout, ScratchText(fmt));
 		}
 	}
 }
@@ -133,7 +133,7 @@ void DebugDrawInterop::AddText3D(const Vec3 &pos, float size, ColorF color, floa
 		auto d = gEnv->pGame->GetIGameFramework()->GetIPersistantDebug();
 		if (d)
 		{
-			d->AddText3D(pos, size, color, timeout, NtText(text));
+			d->AddText3D(pos, size, color, timeout, ScratchText(text));
 		}
 	}
 }
@@ -10,6 +10,7 @@ struct DebugDrawInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.DebugServices"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void Begin(const char *name, bool clear);
 	
@@ -10,6 +10,7 @@ struct DecalInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void CreateDecal(MonoDecalInfo &info);
 	static void DeleteDecalsInRange(AABB *pAreaBox, IRenderNode *pEntity);
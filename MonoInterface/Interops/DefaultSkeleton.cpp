@@ -44,7 +44,7 @@ uint DefaultSkeletonInterop::GetJointCRC32ByID(IDefaultSkeleton *handle, int id)
 
 mono::string DefaultSkeletonInterop::GetJointNameByID(IDefaultSkeleton *handle, int id)
 {
-	return ToMonoString(handle->GetJointNameByID(id));
+	return ToMonoStringCached(handle->GetJointNameByID(id));
 }
 
 int DefaultSkeletonInterop::GetJointIDByName(IDefaultSkeleton *handle, mono::string name)
@@ -10,6 +10,7 @@ struct DefaultSkeletonInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static uint GetJointCount(IDefaultSkeleton *handle);
 	static int GetJointParentIDByID(IDefaultSkeleton *handle, int id);
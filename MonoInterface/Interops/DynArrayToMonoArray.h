@@ -13,18 +13,14 @@ inline mono::Array ToMonoArray(DynArray<CCryName> &names)
 		MonoEnv->Objects->Arrays->Create(names.size(), MonoEnv->CoreLibrary->String);
 
 	MonoGCHandle arrayHandle = MonoEnv->GC->Pin(namesArray);
-	MonoGCHandle *stringHandles = new MonoGCHandle[names.size()];	// Just in case.
 
+	// The cache can be disabled or evict a name, so it's not relied upon: every string is referenced from
+	// the stack, which Mono scans conservatively, until it is stored, and the array holds the reference
+	// after that.
 	for (int i = 0; i < names.size(); i++)
 	{
-		mono::string name = ToMonoString(names[i].c_str());
-
-		stringHandles[i] = MonoEnv->GC->Pin(name);
-
-		namesArray[i] = name;
+		namesArray[i] = ToMonoStringCached(names[i].c_str());
 	}
-	// Unpin each name.
-	delete[] stringHandles;
 
 	return namesArray;
 }
@@ -147,7 +147,7 @@ void EntityPoolInterop::ResetPools(bool saveState)
 
 bool EntityPoolInterop::IsDefaultBookmarked(mono::string className)
 {
-	return poolManager->IsClassDefaultBookmarked(NtText(className));
+	return poolManager->IsClassDefaultBookmarked(ScratchText(className));
 }
 
 bool EntityPoolInterop::IsPreparingEntity(EntityId *entityId)
@@ -707,12 +707,12 @@ bool CryEntityInterop::GetIsGarbage(IEntity *handle)
 
 void CryEntityInterop::SetNameInternal(IEntity *handle, mono::string sName)
 {
-	handle->SetName(NtText(sName));
+	handle->SetName(ScratchText(sName));
 }
 
 mono::string CryEntityInterop::GetNameInternal(IEntity *handle)
 {
-	return ToMonoString(handle->GetName());
+	return ToMonoStringCached(handle->GetName());
 }
 
 bool CryEntityInterop::GetIsLoadedFromLevelFile(IEntity *handle)
@@ -736,7 +736,7 @@ void CryEntityInterop::AttachChildInternal(IEntity *handle, IEntity *child, int
 		}
 	}
 	// Actually attach.
-	handle->AttachChild(child, SChildAttachParams(flags, NtText(target)));
+	handle->AttachChild(child, SChildAttachParams(flags, ScratchText(target)));
 }
 
 void CryEntityInterop::DetachAllInternal(IEntity *handle, bool keepWorldTM)
@@ -952,7 +952,7 @@ IEntityLink *CryEntityInterop::GetEntityLinks(IEntity *handle)
 
 IEntityLink *CryEntityInterop::AddEntityLink(IEntity *handle, mono::string linkName, EntityId entityId, EntityGUID entityGuid)
 {
-	return handle->AddEntityLink(NtText(linkName), entityId, entityGuid);
+	return handle->AddEntityLink(ScratchText(linkName), entityId, entityGuid);
 }
 
 void CryEntityInterop::RemoveEntityLink(IEntity *handle, IEntityLink *pLink)
@@ -1168,17 +1168,17 @@ int EntitySlotsInterop::SetStatObj(IEntity *handle, IStatObj *pStatObj, int slot
 int EntitySlotsInterop::LoadGeometry(IEntity *handle, int slot, mono::string sFilename, mono::string sGeomName,
 									 int nLoadFlags)
 {
-	return handle->LoadGeometry(slot, NtText(sFilename), NtText(sGeomName), nLoadFlags);
+	return handle->LoadGeometry(slot, ScratchText(sFilename), ScratchText(sGeomName), nLoadFlags);
 }
 
 int EntitySlotsInterop::LoadCharacter(IEntity *handle, int slot, mono::string sFilename, int nLoadFlags)
 {
-	return handle->LoadCharacter(slot, NtText(sFilename), nLoadFlags);
+	return handle->LoadCharacter(slot, ScratchText(sFilename), nLoadFlags);
 }
 
 int EntitySlotsInterop::LoadGeomCache(IEntity *handle, int slot, mono::string sFilename)
 {
-	return handle->LoadGeomCache(slot, NtText(sFilename));
+	return handle->LoadGeomCache(slot, ScratchText(sFilename));
 }
 
 int EntitySlotsInterop::LoadParticleEmitterDefault(IEntity *handle, int slot, IParticleEffect *pEffect,
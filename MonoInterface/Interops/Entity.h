@@ -31,6 +31,7 @@ struct EntityPoolInterop : public IMonoInterop<false, true>, public IEntityPoolL
 	IMonoClass         *GetMonoClass();
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	virtual void OnPoolBookmarkCreated(EntityId entityId, const SEntitySpawnParams &params, XmlNodeRef entityNode) override;
 	virtual void OnEntityPreparedFromPool(EntityId entityId, IEntity *pEntity) override;
@@ -59,6 +60,7 @@ struct EntitySystemInterop : public IMonoInterop<false, true>
 	static IEntityProxyPtr CreateGameObjectForCryCilEntity(IEntity *pEntity, SEntitySpawnParams &params, void *pUserData);
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static bool RegisterEntityClass(mono::string name, mono::string category, mono::string editorHelper,
 	                                mono::string editorIcon, enum EEntityClassFlags flags, mono::object properties,
@@ -76,6 +78,7 @@ struct NetEntityInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void SetChannelId(EntityId entityId, ushort channelId);
 	static void InvokeRmi(EntityId sender, mono::string methodName, mono::object parameters, uint32 _where, int channel,
@@ -89,6 +92,7 @@ struct CryEntityInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static mono::object     GetMonoEntity(IEntity *handle);
 	static void             SetFlags(IEntity *handle, uint64 flags);
@@ -161,6 +165,7 @@ struct EntitySlotsInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static bool                  IsSlotValid(IEntity *entityHandle, int nIndex);
 	static void                  FreeSlot(IEntity *entityHandle, int nIndex);
@@ -202,6 +207,7 @@ struct MonoEntityInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void EnablePostUpdates(IEntity *entity, bool receive);
 	static void EnableUpdates(IEntity *entity, bool receive);
@@ -16,6 +16,7 @@ struct FaceInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IFacialModel *GetFacialModel(IFacialInstance *handle);
 	static IFaceState   *GetFaceState(IFacialInstance *handle);
@@ -10,6 +10,7 @@ struct FaceIdentifierInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void CreateIdentifier(mono::string name, CFaceIdentifierHandle *stringHandle);
 };
\ No newline at end of file
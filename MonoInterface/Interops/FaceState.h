@@ -10,6 +10,7 @@ struct FaceStateInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static float GetEffectorWeight(IFaceState *handle, int nIndex);
 	static void  SetEffectorWeight(IFaceState *handle, int nIndex, float fWeight);
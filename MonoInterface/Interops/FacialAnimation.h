@@ -11,6 +11,7 @@ struct FacialAnimationInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void                     ClearAllCachesInternal();
 	static IFacialEffectorsLibrary *CreateEffectorsLibraryInternal();
@@ -12,6 +12,7 @@ struct FacialAnimationChannelInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void                  SetIdentifier(IFacialAnimChannel *handle, CFaceIdentifierHandle ident);
 	static CFaceIdentifierHandle GetIdentifier(IFacialAnimChannel *handle);
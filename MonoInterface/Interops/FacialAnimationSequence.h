@@ -10,6 +10,7 @@ struct FacialAnimationSequenceInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void                 AddRef(IFacialAnimSequence *handle);
 	static void                 Release(IFacialAnimSequence *handle);
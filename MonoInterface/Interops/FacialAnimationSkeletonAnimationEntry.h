@@ -10,6 +10,7 @@ struct FacialAnimationSkeletonAnimationEntryInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void         SetName(IFacialAnimSkeletonAnimationEntry *handle, mono::string skeletonAnimationFile);
 	static mono::string GetName(IFacialAnimSkeletonAnimationEntry *handle);
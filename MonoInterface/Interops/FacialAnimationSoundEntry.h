@@ -11,6 +11,7 @@ struct FacialAnimationSoundEntryInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void             SetSoundFile(IFacialAnimSoundEntry *handle, mono::string sSoundFile);
 	static mono::string     GetSoundFile(IFacialAnimSoundEntry *handle);
@@ -14,6 +14,7 @@ struct FacialEffectorInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void             SetIdentifier(IFacialEffector *handle, CFaceIdentifierHandle ident);
 	static CFaceIdentifierHandle GetIdentifier(IFacialEffector *handle);
@@ -9,6 +9,7 @@ struct FacialEffectorControllerInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IFacialEffCtrl::ControlType  GetControlType(IFacialEffCtrl *handle);
 	static void                         SetControlType(IFacialEffCtrl *handle, IFacialEffCtrl::ControlType t);
@@ -13,6 +13,7 @@ struct FacialEffectorsLibraryInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void             AddRef(IFacialEffectorsLibrary *handle);
 	static void             Release(IFacialEffectorsLibrary *handle);
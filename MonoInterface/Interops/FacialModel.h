@@ -12,6 +12,7 @@ struct FacialModelInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static int                      GetEffectorCount(IFacialModel *handle);
 	static IFacialEffector         *GetEffector(IFacialModel *handle, int nIndex);
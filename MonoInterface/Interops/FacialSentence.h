@@ -9,6 +9,7 @@ struct FacialSentenceInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void             SetText(IFacialSentence *handle, mono::string text);
 	static mono::string     GetText(IFacialSentence *handle);
@@ -9,6 +9,17 @@ void FlowGraphInterop::InitializeInterops()
 	REGISTER_METHOD_NCN("CryCil.RunTime.Registration", "FlowNodeTypeRegistry", "RegisterType", RegisterType);
 	REGISTER_METHOD_NCN("CryCil.Engine.Logic", "OutputPort", "ActivateInternal", ActivatePort);
 	REGISTER_METHOD_NCN("CryCil.Engine.Logic", "FlowNode",   "Deactivate",       DeactivateNode);
+	REGISTER_METHOD_NCN("CryCil.Engine.Logic", "FlowNode",   "SetRegularlyUpdated", SetRegularlyUpdated);
+}
+
+void FlowGraphInterop::Update()
+{
+	MonoFlowNode::UpdateNodes();
+}
+
+void FlowGraphInterop::Shutdown()
+{
+	MonoFlowNode::ReleaseUpdatedNodes();
 }
 
 ushort FlowGraphInterop::RegisterType(mono::string name)
@@ -31,3 +42,10 @@ void FlowGraphInterop::DeactivateNode(IFlowGraph *graph, ushort nodeId)
 	auto node = static_cast<MonoFlowNode *>(generalNode);
 	node->Deactivate();
 }
+
+void FlowGraphInterop::SetRegularlyUpdated(IFlowGraph *graph, ushort nodeId, bool value)
+{
+	auto generalNode = graph->GetNodeData(nodeId)->GetNode();
+	auto node = static_cast<MonoFlowNode *>(generalNode);
+	node->SetRegularlyUpdated(value);
+}
@@ -9,10 +9,14 @@ struct FlowGraphInterop : public IMonoInterop<false, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
+	virtual void Update() override;
+	virtual void Shutdown() override;
 
 	static ushort RegisterType(mono::string name);
 
 	static void ActivatePort(IFlowGraph *graph, ushort nodeId, byte portId, struct MonoFlowData data);
 
 	static void DeactivateNode(IFlowGraph *graph, ushort nodeId);
+	static void SetRegularlyUpdated(IFlowGraph *graph, ushort nodeId, bool value);
 };
\ No newline at end of file
@@ -8,6 +8,7 @@ struct GameInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static bool get_IsEditor();
 	static bool get_IsEditing();
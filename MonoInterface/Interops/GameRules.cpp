@@ -28,8 +28,8 @@ void GameRulesInterop::RegisterGameRules(mono::string name, mono::string typeNam
 	NtText gameRulesName(name);
 	NtText gameRulesTypeName(typeName);
 
-	List<NtText> aliasesList(10);
-	List<NtText> pathsList(10);
+	InlineList<NtText, 10> aliasesList;
+	InlineList<NtText, 10> pathsList;
 	if (aliases)
 	{
 		IMonoArray<mono::string> aliasesArray(aliases);
@@ -84,7 +84,7 @@ mono::string GameRulesInterop::GetGameRulesLevelLocation(mono::string gamerules,
 mono::Array GameRulesInterop::GetGameRulesLevelLocations(mono::string gamerules)
 {
 	NtText gameRulesName(gamerules);
-	List<const char *> aliasesList(10);
+	InlineList<const char *, 10> aliasesList;
 	IGameRulesSystem *gameRulesSystem = MonoEnv->CryAction->GetIGameRulesSystem();
 	
 	int i = 0;
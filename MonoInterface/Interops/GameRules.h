@@ -8,6 +8,7 @@ struct GameRulesInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Logic"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void         RegisterGameRules(mono::string name, mono::string typeName, mono::Array aliases,
 										  mono::Array paths, bool _default);
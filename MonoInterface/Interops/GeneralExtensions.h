@@ -8,6 +8,7 @@ struct GeneralExtensionsInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void CopyToBuffer(mono::string str, wchar_t *chars, int start, int count);
 };
\ No newline at end of file
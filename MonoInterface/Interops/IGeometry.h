@@ -11,6 +11,7 @@ struct IGeometryInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Physics"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IGeometry *CreateMesh(Vec3 *vertices, uint16 *indices, byte *materialIds, int *foreignIds, int triangleCount,
 								 int flags, float approximationTolerance, int minTrianglesPerNode, int maxTrianglesPerNode,
@@ -9,6 +9,7 @@ struct IndexedMeshInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.StaticObjects"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void   ReleaseInternal(IIndexedMesh *handle);
 	static void   GetMeshDescription(IIndexedMesh *handle, IIndexedMesh::SMeshDescription &meshDesc);
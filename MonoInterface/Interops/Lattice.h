@@ -18,6 +18,7 @@ struct LatticeInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Physics"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static PhysParamsLattice GetParams(ITetrLattice *handle);
 	static void              SetParams(ITetrLattice *handle, PhysParamsLattice &parameters);
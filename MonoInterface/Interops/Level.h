@@ -49,6 +49,7 @@ struct LevelInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.CryAction"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static mono::string GetName(ILevelInfo *handle);
 	static bool         IsOfTypeInternal(ILevelInfo *handle, mono::string sType);
@@ -10,6 +10,7 @@ struct LevelsInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.CryAction"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static int         GetCount();
 	static ILevelInfo *GetItemInt(int index, bool &outOfRange);
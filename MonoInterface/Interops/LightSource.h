@@ -9,6 +9,7 @@ struct LightSourceInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering.Lighting"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void          SetLightProperties(ILightSource *handle, const LightProperties &properties);
 	static void          GetLightProperties(ILightSource *handle, LightProperties &properties);
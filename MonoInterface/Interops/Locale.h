@@ -9,6 +9,7 @@ struct LocaleInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Localization"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static mono::string Translate(mono::string text, bool forceEnglish);
 	static mono::string TranslateLabel(mono::string labelName, bool forceEnglish);
@@ -15,7 +15,7 @@ LogPostingInterop::LogPostingInterop()
 
 void LogPostingInterop::Post(IMiniLog::ELogType postType, mono::string text)
 {
-	NtText message(text);
+	ScratchText message(text);
 
 	//CryLogAlways("Posting a message: %s", message);
 
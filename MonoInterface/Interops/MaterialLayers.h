@@ -8,6 +8,7 @@ struct MaterialLayerCollectionInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void SetLayerCount(IMaterial *handle, uint nCount);
 	static uint GetLayerCount(IMaterial *handle);
@@ -23,6 +24,7 @@ struct MaterialLayerInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IMaterialLayer *Ctor(IMaterial *mat);
 	static void EnableInternal(IMaterialLayer *handle, bool bEnable);
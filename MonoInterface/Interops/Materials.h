@@ -15,6 +15,7 @@ struct MaterialInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IMaterial *GetDefault();
 	static IMaterial *GetDefaultTerrainLayer();
@@ -59,6 +60,7 @@ struct SubMaterialsInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IMaterial *GetItem(IMaterial *handle, int index);
 	static void       SetItem(IMaterial *handle, int index, IMaterial *mat);
@@ -8,6 +8,7 @@ struct MathHelpersInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static float RsqrtSingle(float value);
 	static double RsqrtDouble(double value);
@@ -8,6 +8,7 @@ struct MeshObjectInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static int AddRef(IMeshObj *handle);
 	static int Release(IMeshObj *handle);
@@ -1,50 +1,229 @@
 #include "stdafx.h"
 #include "MeshOps.h"
+#include "BatchOps.Parallel.h"
 
 void MeshOpsInterop::InitializeInterops()
 {
+	REGISTER_METHOD(DeleteListItems);
 	REGISTER_METHOD(CsgOpInternal);
+	// Indexed meshes are processed by the same code, but their internal calls are declared in another class.
+	REGISTER_METHOD_NCN("CryCil.Geometry", "IndexedMesh", "DeleteIndexedMesh", DeleteIndexedMesh);
+	REGISTER_METHOD_NCN("CryCil.Geometry", "IndexedMesh", "CsgOpIndexedInternal", CsgOpIndexedInternal);
+
+	workers = new BatchWorkerPool();
+
+	if (gEnv && gEnv->pConsole)
+	{
+		gEnv->pConsole->Register("cil_CsgParallelThreshold", &parallelThreshold, parallelThreshold, VF_NULL,
+								 "Minimal number of faces in a BSP tree that makes building and clipping of it "
+								 "split between multiple threads.");
+		gEnv->pConsole->Register("cil_CsgWorkers", &workerCount, workerCount, VF_NULL,
+								 "Number of threads (including the calling one) that perform CSG operations. "
+								 "0 - use one thread per logical processor, 1 - disable parallel processing.");
+		gEnv->pConsole->Register("cil_CsgSplitterSelection", &splitterSelection, splitterSelection, VF_NULL,
+								 "Defines how planes of BSP nodes are chosen by CSG operations. 0 - plane of "
+								 "the first face, 1 - best plane of a sample of faces.");
+		gEnv->pConsole->Register("cil_CsgStatistics", &logStatistics, logStatistics, VF_NULL,
+								 "When 1, every CSG operation logs the shape of BSP trees it has built.");
+		gEnv->pConsole->AddCommand("cil_CsgBenchmark", Benchmark, VF_NULL,
+								   "Measures time it takes to subtract one sphere from another with BSP trees "
+								   "that take memory from the heap, from the arena, and that are built by "
+								   "multiple threads. Usage: cil_CsgBenchmark [number of segments in a sphere] "
+								   "[number of iterations]");
+	}
 }
 
-void CombineInternal(const List<Face> &faces1, const List<Face> &faces2, List<Face> &faces)
+void MeshOpsInterop::Shutdown()
 {
-	BspNode node1(faces1);
-	BspNode node2(faces2);
-
-	node1.Unite(&node2);
+	if (gEnv && gEnv->pConsole)
+	{
+		gEnv->pConsole->UnregisterVariable("cil_CsgParallelThreshold", true);
+		gEnv->pConsole->UnregisterVariable("cil_CsgWorkers", true);
+		gEnv->pConsole->UnregisterVariable("cil_CsgSplitterSelection", true);
+		gEnv->pConsole->UnregisterVariable("cil_CsgStatistics", true);
+		gEnv->pConsole->RemoveCommand("cil_CsgBenchmark");
+	}
 
-	faces.AddRange(*node1.AllFaces());
+	// Worker threads must be joined before the module is unloaded.
+	delete workers;
+	workers = nullptr;
 }
 
-void IntersectInternal(const List<Face> &faces1, const List<Face> &faces2, List<Face> &faces)
+int MeshOpsInterop::parallelThreshold = 4096;
+int MeshOpsInterop::workerCount = 0;
+int MeshOpsInterop::splitterSelection = BspSplitterSampled;
+int MeshOpsInterop::logStatistics = 0;
+BatchWorkerPool *MeshOpsInterop::workers = nullptr;
+
+void CombineInternal(BspNode &node1, BspNode &node2, FaceList &faces, const BspParallelism &parallelism)
 {
-	BspNode node1(faces1);
-	BspNode node2(faces2);
+	node1.Unite(&node2, parallelism);
+
+	node1.AllFaces(faces);
+}
 
-	node1.Invert();				//
-	node2.CutTreeOut(node1);	// Cut geometry that is not common for the meshes.
-	node2.Invert();				//
-	node1.CutTreeOut(node2);	//
+void IntersectInternal(BspNode &node1, BspNode &node2, FaceList &faces, const BspParallelism &parallelism)
+{
+	node1.Invert();							//
+	node2.CutTreeOut(node1, parallelism);	// Cut geometry that is not common for the meshes.
+	node2.Invert();							//
+	node1.CutTreeOut(node2, parallelism);	//
 	// Clean up remains.
-	node2.CutTreeOut(node1);
+	node2.CutTreeOut(node1, parallelism);
 	// Combine geometry.
-	node1.AddFaces(*node2.AllFaces());
+	BspAllocator<IndexedFace> allocator(node1.GetArena());
+	FaceList remains(allocator);
+	node2.AllFaces(remains);
+	node1.AddFaces(remains, parallelism);
 	// Invert everything.
 	node1.Invert();
 
-	faces.AddRange(*node1.AllFaces());
+	node1.AllFaces(faces);
 }
 
-void SubtractInternal(const List<Face> &faces1, const List<Face> &faces2, List<Face> &faces)
+void SubtractInternal(BspNode &node1, BspNode &node2, FaceList &faces, const BspParallelism &parallelism)
 {
-	BspNode node1(faces1);
-	BspNode node2(faces2);
-
 	node1.Invert();
-	node1.Unite(&node2);
+	node1.Unite(&node2, parallelism);
 	node1.Invert();
 
-	faces.AddRange(*node1.AllFaces());
+	node1.AllFaces(faces);
+}
+
+//! Adds faces that have their own vertices to the list, putting the vertices into the pool.
+void AddFaces(BspVertexPool &vertices, const Face *facesPtr, int faceCount, FaceList &faces)
+{
+	faces.Reserve(faceCount);
+	for (int i = 0; i < faceCount; i++)
+	{
+		int first = vertices.AddRange(facesPtr[i].Vertices, 3);
+		faces.Add(IndexedFace(first, first + 1, first + 2, facesPtr[i].SubsetIndex));
+	}
+}
+
+//! Adds faces that refer to vertices in the array to the list, putting the vertices into the pool.
+void AddFaces(BspVertexPool &vertices, const Vertex *verticesPtr, int vertexCount, const IndexedFace *facesPtr,
+			  int faceCount, FaceList &faces)
+{
+	int first = vertices.AddRange(verticesPtr, vertexCount);
+
+	faces.Reserve(faceCount);
+	for (int i = 0; i < faceCount; i++)
+	{
+		const IndexedFace &face = facesPtr[i];
+		faces.Add(IndexedFace(first + face.Indices[0], first + face.Indices[1], first + face.Indices[2],
+							  face.SubsetIndex));
+	}
+}
+
+//! Determines whether all faces refer to vertices in the array.
+bool ValidateIndices(int vertexCount, const IndexedFace *facesPtr, int faceCount)
+{
+	for (int i = 0; i < faceCount; i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			int index = facesPtr[i].Indices[j];
+			if (index < 0 || index >= vertexCount)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+//! Initializes faces in the array with vertices from the pool.
+void ExpandFaces(const BspVertexPool &vertices, const FaceList &faces, Face *facesPtr)
+{
+	DefaultAllocator<Face> allocator;
+	for (int i = 0; i < faces.Length; i++)
+	{
+		const IndexedFace &face = faces[i];
+		allocator.Initialize(facesPtr + i, vertices[face.Indices[0]], vertices[face.Indices[1]],
+							 vertices[face.Indices[2]], face.SubsetIndex);
+	}
+}
+
+//! Calculates FNV-1a hash of the bytes of the vertex.
+unsigned int HashVertex(const Vertex &vertex)
+{
+	const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&vertex);
+	unsigned int hash = 2166136261u;
+	for (size_t i = 0; i < sizeof(Vertex); i++)
+	{
+		hash ^= bytes[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+//! Copies vertices that are used by the faces from the pool, merging identical ones, and makes faces refer
+//! to the copies.
+//!
+//! @param vertices       Pool of vertices the faces refer to.
+//! @param faces          Faces to weld.
+//! @param weldedVertices List to add unique vertices to.
+//! @param weldedFaces    List to add faces that refer to welded vertices to.
+void WeldVertices(const BspVertexPool &vertices, const FaceList &faces, List<Vertex> &weldedVertices,
+				  List<IndexedFace> &weldedFaces)
+{
+	// Every vertex in the pool is looked up once, after that its index is taken from this list.
+	int vertexCount = vertices.GetCount();
+	List<int> remap(vertexCount);
+	for (int i = 0; i < vertexCount; i++)
+	{
+		remap.Add(-1);
+	}
+	// Open-addressing table of indices of welded vertices that is never more then half-full.
+	__int64 maxVertexCount = faces.Length * 3 < vertexCount ? faces.Length * 3 : vertexCount;
+	int tableSize = 16;
+	while (tableSize < maxVertexCount * 2)
+	{
+		tableSize *= 2;
+	}
+	List<int> table(tableSize);
+	for (int i = 0; i < tableSize; i++)
+	{
+		table.Add(-1);
+	}
+
+	weldedFaces.Reserve(faces.Length);
+	for (int i = 0; i < faces.Length; i++)
+	{
+		const IndexedFace &face = faces[i];
+		IndexedFace weldedFace(0, 0, 0, face.SubsetIndex);
+		for (int j = 0; j < 3; j++)
+		{
+			int index = face.Indices[j];
+			int welded = remap[index];
+			if (welded < 0)
+			{
+				const Vertex &vertex = vertices[index];
+				int slot = int(HashVertex(vertex) & (tableSize - 1));
+				while (true)
+				{
+					int candidate = table[slot];
+					if (candidate < 0)
+					{
+						welded = int(weldedVertices.Length);
+						weldedVertices.Add(vertex);
+						table[slot] = welded;
+						break;
+					}
+					if (memcmp(&weldedVertices[candidate], &vertex, sizeof(Vertex)) == 0)
+					{
+						welded = candidate;
+						break;
+					}
+					slot = (slot + 1) & (tableSize - 1);
+				}
+				remap[index] = welded;
+			}
+			weldedFace.Indices[j] = welded;
+		}
+		weldedFaces.Add(weldedFace);
+	}
 }
 
 void MeshOpsInterop::DeleteListItems(Face* facesPtr)
@@ -60,24 +239,414 @@ void MeshOpsInterop::DeleteListItems(Face* facesPtr)
 Face *MeshOpsInterop::CsgOpInternal(Face* facesPtr1, int faceCount1, Face* facesPtr2, int faceCount2, int op,
 									uintptr_t &faceCount)
 {
-	List<Face> faces1(facesPtr1, facesPtr1 + faceCount1);
-	List<Face> faces2(facesPtr2, facesPtr2 + faceCount2);
+	faceCount = 0;
+
+	if (faceCount1 < 0 || faceCount2 < 0)
+	{
+		ArgumentOutOfRangeException("Numbers of faces cannot be negative.").Throw();
+	}
+	// Every face brings 3 vertices of its own.
+	if ((__int64(faceCount1) + faceCount2) * 3 > BspVertexPool::Capacity)
+	{
+		ReportError("CSG operation cannot be performed: meshes have more than %d vertices.",
+					BspVertexPool::Capacity);
+		return nullptr;
+	}
+
+	// All nodes, lists and temporary buffers are released in one step, when the arena goes out of scope.
+	BspArena arena;
+	BspAllocator<IndexedFace> allocator(&arena);
+	BspVertexPool vertices;
+
+	FaceList faces1(allocator);
+	FaceList faces2(allocator);
+	AddFaces(vertices, facesPtr1, faceCount1, faces1);
+	AddFaces(vertices, facesPtr2, faceCount2, faces2);
+
+	FaceList faces(allocator);
+	CsgOp(vertices, faces1, faces2, op, faces);
+
+	if (faces.Empty)
+	{
+		return nullptr;
+	}
+
+	faceCount = faces.Length;
+	Face *result = DefaultAllocator<Face>().Allocate(faces.Length);
+	ExpandFaces(vertices, faces, result);
+	return result;
+}
+
+void MeshOpsInterop::DeleteIndexedMesh(Vertex *verticesPtr, IndexedFace *facesPtr)
+{
+	if (verticesPtr)
+	{
+		DefaultAllocator<Vertex>().Deallocate(verticesPtr);
+	}
+	if (facesPtr)
+	{
+		DefaultAllocator<IndexedFace>().Deallocate(facesPtr);
+	}
+}
+
+Vertex *MeshOpsInterop::CsgOpIndexedInternal(Vertex *verticesPtr1, int vertexCount1, IndexedFace *facesPtr1,
+											 int faceCount1, Vertex *verticesPtr2, int vertexCount2,
+											 IndexedFace *facesPtr2, int faceCount2, int op,
+											 uintptr_t &vertexCount, IndexedFace *&facesPtr, uintptr_t &faceCount)
+{
+	vertexCount = 0;
+	facesPtr = nullptr;
+	faceCount = 0;
+
+	// Validate before anything is allocated, since the exception unwinds the stack without destroying
+	// objects on it.
+	if (vertexCount1 < 0 || vertexCount2 < 0 || faceCount1 < 0 || faceCount2 < 0)
+	{
+		ArgumentOutOfRangeException("Numbers of vertices and faces cannot be negative.").Throw();
+	}
+	if (!ValidateIndices(vertexCount1, facesPtr1, faceCount1) ||
+		!ValidateIndices(vertexCount2, facesPtr2, faceCount2))
+	{
+		ArgumentOutOfRangeException("Faces of the mesh refer to vertices that are not in the vertex "
+									"buffer.").Throw();
+	}
+	if (__int64(vertexCount1) + vertexCount2 > BspVertexPool::Capacity)
+	{
+		ReportError("CSG operation cannot be performed: meshes have more than %d vertices.",
+					BspVertexPool::Capacity);
+		return nullptr;
+	}
+
+	Vertex *result = nullptr;
+	{
+		BspArena arena;
+		BspAllocator<IndexedFace> allocator(&arena);
+		BspVertexPool vertices;
+
+		FaceList faces1(allocator);
+		FaceList faces2(allocator);
+		AddFaces(vertices, verticesPtr1, vertexCount1, facesPtr1, faceCount1, faces1);
+		AddFaces(vertices, verticesPtr2, vertexCount2, facesPtr2, faceCount2, faces2);
+
+		FaceList faces(allocator);
+		CsgOp(vertices, faces1, faces2, op, faces);
+		if (faces.Empty)
+		{
+			return nullptr;
+		}
+
+		List<Vertex> weldedVertices;
+		List<IndexedFace> weldedFaces;
+		WeldVertices(vertices, faces, weldedVertices, weldedFaces);
+		facesPtr = weldedFaces.Duplicate(faceCount, DefaultAllocator<IndexedFace>());
+		result = weldedVertices.Duplicate(vertexCount, DefaultAllocator<Vertex>());
+	}
+	return result;
+}
+
+void MeshOpsInterop::CsgOp(BspVertexPool &vertices, const FaceList &faces1, const FaceList &faces2, int op,
+						   FaceList &faces)
+{
+	BspStatistics statistics;
+	CsgOp(vertices, faces1, faces2, op, GetParallelism(), BspSplitterSelection(splitterSelection), faces,
+		  logStatistics ? &statistics : nullptr);
+
+	if (logStatistics)
+	{
+		CryLogAlways("CSG operation %d on %d and %d faces: %d faces, %d vertices, %d BSP nodes, depth %d, "
+					 "%d split(s).", op, int(faces1.Length), int(faces2.Length), int(faces.Length),
+					 vertices.GetCount(), statistics.NodeCount, statistics.Depth, statistics.SplitCount);
+	}
+}
+
+void MeshOpsInterop::CsgOp(BspVertexPool &vertices, const FaceList &faces1, const FaceList &faces2, int op,
+						   const BspParallelism &parallelism, BspSplitterSelection splitterSelection,
+						   FaceList &faces, BspStatistics *statistics)
+{
+	BspArena *arena = faces1.Allocator().GetArena();
+	BspNode node1(&vertices, arena, splitterSelection);
+	BspNode node2(&vertices, arena, splitterSelection);
+	// Both trees are built at the same time.
+	BspNode::AddFaces(node1, faces1, node2, faces2, parallelism);
 
-	List<Face> faces;
 	switch (op)
 	{
 	case CsgOpCode::Combine:
-		CombineInternal(faces1, faces2, faces);
+		CombineInternal(node1, node2, faces, parallelism);
 		break;
 	case CsgOpCode::Intersect:
-		IntersectInternal(faces1, faces2, faces);
+		IntersectInternal(node1, node2, faces, parallelism);
 		break;
 	case CsgOpCode::Subtract:
-		SubtractInternal(faces1, faces2, faces);
+		SubtractInternal(node1, node2, faces, parallelism);
 		break;
 	default:
 		break;
 	}
 
-	return faces.Duplicate(faceCount, DefaultAllocator<Face>());
+	if (statistics)
+	{
+		node1.GatherStatistics(*statistics);
+		node2.GatherStatistics(*statistics);
+	}
+
+	// Faces that were split after the pool had been filled refer to wrong vertices.
+	if (vertices.IsOverflowed())
+	{
+		ReportError("CSG operation on %d and %d faces has created more than %d vertices and was aborted.",
+					int(faces1.Length), int(faces2.Length), BspVertexPool::Capacity);
+		faces.Clear();
+	}
+}
+
+BspParallelism MeshOpsInterop::GetParallelism()
+{
+	int threadCount = workerCount > 0 ? workerCount : BatchWorkerPool::GetProcessorCount();
+	return BspParallelism(workers, threadCount, parallelThreshold);
+}
+
+//! Creates a UV sphere.
+//!
+//! @param bumpiness Relative height of bumps on the surface. Spheres without bumps are convex, so their BSP
+//!                  trees are always degenerate.
+void CreateSphere(const Vec3 &center, float radius, float bumpiness, int segments, List<Vertex> &vertices,
+				  List<IndexedFace> &faces)
+{
+	int rings = segments / 2;
+	for (int ring = 0; ring <= rings; ring++)
+	{
+		float theta = gf_PI * ring / rings;
+		for (int segment = 0; segment <= segments; segment++)
+		{
+			float phi = gf_PI2 * segment / segments;
+
+			Vertex vertex;
+			vertex.Normal = Vec3(sinf(theta) * cosf(phi), sinf(theta) * sinf(phi), cosf(theta));
+			float bump = sinf(7 * vertex.Normal.x) * sinf(7 * vertex.Normal.y) * sinf(5 * vertex.Normal.z);
+			vertex.Position = center + vertex.Normal * (radius * (1 + bumpiness * bump));
+			vertex.UvPosition = Vec2(float(segment) / segments, float(ring) / rings);
+			vertex.PrimaryColor = ColorB(255, 255, 255, 255);
+			vertex.SecondaryColor = ColorB(255, 255, 255, 255);
+			vertices.Add(vertex);
+		}
+	}
+
+	int stride = segments + 1;
+	for (int ring = 0; ring < rings; ring++)
+	{
+		for (int segment = 0; segment < segments; segment++)
+		{
+			int topLeft = ring * stride + segment;
+			int bottomLeft = topLeft + stride;
+			// Quads at the poles are degenerate, so they are represented with a single triangle.
+			if (ring != 0)
+			{
+				faces.Add(IndexedFace(topLeft, bottomLeft, topLeft + 1, 0));
+			}
+			if (ring != rings - 1)
+			{
+				faces.Add(IndexedFace(topLeft + 1, bottomLeft, bottomLeft + 1, 0));
+			}
+		}
+	}
+}
+
+//! Creates faces that have their own vertices from the indexed mesh.
+void ExpandSphere(const List<Vertex> &vertices, const List<IndexedFace> &indexedFaces, List<Face> &faces)
+{
+	for (int i = 0; i < indexedFaces.Length; i++)
+	{
+		const IndexedFace &face = indexedFaces[i];
+		faces.Add(Face(vertices[face.Indices[0]], vertices[face.Indices[1]], vertices[face.Indices[2]],
+					   face.SubsetIndex));
+	}
+}
+
+void MeshOpsInterop::Benchmark(IConsoleCmdArgs *args)
+{
+	int segments = 32;
+	int iterations = 10;
+	if (args->GetArgCount() > 1)
+	{
+		segments = atoi(args->GetArg(1));
+	}
+	if (args->GetArgCount() > 2)
+	{
+		iterations = atoi(args->GetArg(2));
+	}
+	if (segments < 4 || iterations <= 0)
+	{
+		CryLogAlways("Number of segments must be at least 4, and number of iterations must be positive.");
+		return;
+	}
+
+	List<Vertex> sphereVertices1;
+	List<Vertex> sphereVertices2;
+	List<IndexedFace> sphereIndices1;
+	List<IndexedFace> sphereIndices2;
+	CreateSphere(Vec3(0, 0, 0), 1.0f, 0, segments, sphereVertices1, sphereIndices1);
+	CreateSphere(Vec3(0.5f, 0.25f, 0.125f), 1.0f, 0, segments, sphereVertices2, sphereIndices2);
+	List<Face> sphere1;
+	List<Face> sphere2;
+	ExpandSphere(sphereVertices1, sphereIndices1, sphere1);
+	ExpandSphere(sphereVertices2, sphereIndices2, sphere2);
+
+	const Face *faces1 = sphere1.First();
+	const Face *faces2 = sphere2.First();
+	int faceCount = int(sphere1.Length);
+
+	CryLogAlways("Subtracting spheres with %d faces each %d time(s):", faceCount, iterations);
+
+	BspSplitterSelection selection = BspSplitterSelection(splitterSelection);
+
+	float heapTime = 0;
+	uintptr_t heapFaceCount = 0;
+	for (int i = 0; i < iterations; i++)
+	{
+		CTimeValue start = gEnv->pTimer->GetAsyncTime();
+		BspVertexPool vertices;
+		FaceList operand1;
+		FaceList operand2;
+		FaceList faces;
+		AddFaces(vertices, faces1, faceCount, operand1);
+		AddFaces(vertices, faces2, faceCount, operand2);
+		CsgOp(vertices, operand1, operand2, CsgOpCode::Subtract, BspParallelism(), selection, faces);
+		heapFaceCount = faces.Length;
+		heapTime += (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+	}
+
+	float arenaTime = 0;
+	uintptr_t arenaFaceCount = 0;
+	size_t reservedBytes = 0;
+	size_t allocationCount = 0;
+	List<Vertex> serialVertices;
+	List<IndexedFace> serialFaces;
+	for (int i = 0; i < iterations; i++)
+	{
+		CTimeValue start = gEnv->pTimer->GetAsyncTime();
+		{
+			BspArena arena;
+			BspAllocator<IndexedFace> allocator(&arena);
+			BspVertexPool vertices;
+			FaceList operand1(allocator);
+			FaceList operand2(allocator);
+			FaceList faces(allocator);
+			AddFaces(vertices, faces1, faceCount, operand1);
+			AddFaces(vertices, faces2, faceCount, operand2);
+			CsgOp(vertices, operand1, operand2, CsgOpCode::Subtract, BspParallelism(), selection, faces);
+			arenaFaceCount = faces.Length;
+			reservedBytes = arena.GetReservedBytes();
+			allocationCount = arena.GetAllocationCount();
+			if (i == 0)
+			{
+				WeldVertices(vertices, faces, serialVertices, serialFaces);
+			}
+		}
+		arenaTime += (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+	}
+
+	BspParallelism parallelism = GetParallelism();
+	// Make sure that work is split between threads, so the benchmark shows the difference.
+	parallelism.Threshold = 0;
+	float parallelTime = 0;
+	bool sameResults = true;
+	for (int i = 0; i < iterations; i++)
+	{
+		CTimeValue start = gEnv->pTimer->GetAsyncTime();
+		{
+			BspArena arena;
+			BspAllocator<IndexedFace> allocator(&arena);
+			BspVertexPool vertices;
+			FaceList operand1(allocator);
+			FaceList operand2(allocator);
+			FaceList faces(allocator);
+			AddFaces(vertices, faces1, faceCount, operand1);
+			AddFaces(vertices, faces2, faceCount, operand2);
+			CsgOp(vertices, operand1, operand2, CsgOpCode::Subtract, parallelism, selection, faces);
+			if (i == 0)
+			{
+				// Indices of vertices depend on the order threads add them in, so welded meshes are compared.
+				List<Vertex> weldedVertices;
+				List<IndexedFace> weldedFaces;
+				WeldVertices(vertices, faces, weldedVertices, weldedFaces);
+				size_t vertexBytes = weldedVertices.Length * sizeof(Vertex);
+				size_t faceBytes = weldedFaces.Length * sizeof(IndexedFace);
+				sameResults =
+					weldedVertices.Length == serialVertices.Length && weldedFaces.Length == serialFaces.Length &&
+					memcmp(weldedVertices.First(), serialVertices.First(), vertexBytes) == 0 &&
+					memcmp(weldedFaces.First(), serialFaces.First(), faceBytes) == 0;
+			}
+		}
+		parallelTime += (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+	}
+
+	// Indexed meshes are passed in and welded on output, like CsgOpIndexedInternal does it.
+	float indexedTime = 0;
+	for (int i = 0; i < iterations; i++)
+	{
+		CTimeValue start = gEnv->pTimer->GetAsyncTime();
+		{
+			BspArena arena;
+			BspAllocator<IndexedFace> allocator(&arena);
+			BspVertexPool vertices;
+			FaceList operand1(allocator);
+			FaceList operand2(allocator);
+			FaceList faces(allocator);
+			AddFaces(vertices, sphereVertices1.First(), int(sphereVertices1.Length), sphereIndices1.First(),
+					 int(sphereIndices1.Length), operand1);
+			AddFaces(vertices, sphereVertices2.First(), int(sphereVertices2.Length), sphereIndices2.First(),
+					 int(sphereIndices2.Length), operand2);
+			CsgOp(vertices, operand1, operand2, CsgOpCode::Subtract, BspParallelism(), selection, faces);
+			List<Vertex> weldedVertices;
+			List<IndexedFace> weldedFaces;
+			WeldVertices(vertices, faces, weldedVertices, weldedFaces);
+		}
+		indexedTime += (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+	}
+
+	CryLogAlways("Heap:  %8.2f ms per operation, %d faces.", heapTime / iterations, int(heapFaceCount));
+	CryLogAlways("Arena: %8.2f ms per operation, %d faces, %d allocations served from %d KB.",
+				 arenaTime / iterations, int(arenaFaceCount), int(allocationCount), int(reservedBytes / 1024));
+	CryLogAlways("Arena, %d thread(s): %8.2f ms per operation, results are %s.", parallelism.ThreadCount,
+				 parallelTime / iterations, sameResults ? "the same" : "different");
+	CryLogAlways("Indexed input, welded output: %8.2f ms per operation, %d faces share %d vertices.",
+				 indexedTime / iterations, int(serialFaces.Length), int(serialVertices.Length));
+	CryLogAlways("Speed-up: arena %.2f, arena and threads %.2f", arenaTime > 0 ? heapTime / arenaTime : 0.0f,
+				 parallelTime > 0 ? heapTime / parallelTime : 0.0f);
+
+	// Planes of convex meshes never split anything, so bumpy spheres are used to compare the ways planes are
+	// chosen.
+	List<Vertex> bumpyVertices1;
+	List<Vertex> bumpyVertices2;
+	List<IndexedFace> bumpyIndices1;
+	List<IndexedFace> bumpyIndices2;
+	CreateSphere(Vec3(0, 0, 0), 1.0f, 0.25f, segments, bumpyVertices1, bumpyIndices1);
+	CreateSphere(Vec3(0.5f, 0.25f, 0.125f), 1.0f, 0.25f, segments, bumpyVertices2, bumpyIndices2);
+
+	CryLogAlways("Subtracting bumpy spheres:");
+	const char *selectionNames[] = { "first face", "sampled" };
+	for (int i = BspSplitterFirstFace; i <= BspSplitterSampled; i++)
+	{
+		CTimeValue start = gEnv->pTimer->GetAsyncTime();
+		BspStatistics statistics;
+		int resultFaceCount;
+		{
+			BspArena arena;
+			BspAllocator<IndexedFace> allocator(&arena);
+			BspVertexPool vertices;
+			FaceList operand1(allocator);
+			FaceList operand2(allocator);
+			FaceList faces(allocator);
+			AddFaces(vertices, bumpyVertices1.First(), int(bumpyVertices1.Length), bumpyIndices1.First(),
+					 int(bumpyIndices1.Length), operand1);
+			AddFaces(vertices, bumpyVertices2.First(), int(bumpyVertices2.Length), bumpyIndices2.First(),
+					 int(bumpyIndices2.Length), operand2);
+			CsgOp(vertices, operand1, operand2, CsgOpCode::Subtract, BspParallelism(), BspSplitterSelection(i),
+				  faces, &statistics);
+			resultFaceCount = int(faces.Length);
+		}
+		float time = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+		CryLogAlways("Splitter %-10s: %8.2f ms, %d faces, %d BSP nodes, depth %d, %d split(s).", selectionNames[i],
+					 time, resultFaceCount, statistics.NodeCount, statistics.Depth, statistics.SplitCount);
+	}
 }
@@ -14,14 +14,46 @@ struct CsgOpCode
 	};
 };
 
-struct MeshOpsInterop : public IMonoInterop<true, true>
+struct MeshOpsInterop : public IMonoInterop<false, true>
 {
 	virtual const char *GetInteropClassName() override { return "FaceMesh"; }
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Geometry"; }
 
 	virtual void InitializeInterops() override;
 
+	virtual void Shutdown() override;
+
 	static void DeleteListItems(Face* facesPtr);
 	static Face *CsgOpInternal(Face* facesPtr1, int faceCount1, Face* facesPtr2, int faceCount2, int op,
 							   uintptr_t &faceCount);
+	static void DeleteIndexedMesh(Vertex *verticesPtr, IndexedFace *facesPtr);
+	static Vertex *CsgOpIndexedInternal(Vertex *verticesPtr1, int vertexCount1, IndexedFace *facesPtr1,
+										int faceCount1, Vertex *verticesPtr2, int vertexCount2,
+										IndexedFace *facesPtr2, int faceCount2, int op,
+										uintptr_t &vertexCount, IndexedFace *&facesPtr, uintptr_t &faceCount);
+private:
+	//! Performs CSG operation the way console variables define it.
+	static void CsgOp(BspVertexPool &vertices, const FaceList &faces1, const FaceList &faces2, int op,
+					  FaceList &faces);
+	//! Performs CSG operation and adds resultant faces to the list.
+	//!
+	//! BSP trees take memory from the arena of the lists of faces.
+	//!
+	//! @param vertices          Pool that contains vertices of both meshes, vertices that are created
+	//!                          by the operation are added to it.
+	//! @param parallelism       Defines how the work is split between threads.
+	//! @param splitterSelection Defines how planes of BSP nodes are chosen.
+	//! @param statistics        If not null, numbers that describe BSP trees are added to this object.
+	static void CsgOp(BspVertexPool &vertices, const FaceList &faces1, const FaceList &faces2, int op,
+					  const BspParallelism &parallelism, BspSplitterSelection splitterSelection,
+					  FaceList &faces, BspStatistics *statistics = nullptr);
+	//! Gets the object that defines how CSG operations are split between threads.
+	static BspParallelism GetParallelism();
+	static void Benchmark(IConsoleCmdArgs *args);
+
+	static int parallelThreshold;
+	static int workerCount;
+	static int splitterSelection;
+	static int logStatistics;
+	static BatchWorkerPool *workers;
 };
\ No newline at end of file
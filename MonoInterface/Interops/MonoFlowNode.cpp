@@ -4,7 +4,8 @@
 
 IMonoClass *GetFlowNodeClass()
 {
-	return MonoEnv->Cryambly->GetClass("CryCil.Engine.Logic", "FlowNode");
+	static IMonoClass *klass = MonoEnv->Cryambly->GetClass("CryCil.Engine.Logic", "FlowNode");
+	return klass;
 }
 
 RAW_THUNK typedef mono::object(*CreateThunk)(IFlowGraph *, ushort, ushort);
@@ -13,6 +14,9 @@ MonoFlowNode::MonoFlowNode(TFlowNodeTypeId typeId, SActivationInfo *info, bool &
 	: refCount(0)
 	, objHandle(-1)
 	, targetsEntity(false)
+	, updateIndex(-1)
+	, regularlyUpdated(false)
+	, suspended(false)
 {
 	static CreateThunk thunk = CreateThunk(GetFlowNodeClass()->GetFunction("Create")->RawThunk);
 
@@ -32,6 +36,9 @@ MonoFlowNode::~MonoFlowNode()
 {
 	static NodeReleaseThunk thunk = NodeReleaseThunk(GetFlowNodeClass()->GetFunction("Release")->RawThunk);
 	
+	this->regularlyUpdated = false;
+	this->RefreshUpdateRegistration();
+
 	if (this->objHandle.IsValid)
 	{
 		thunk(this->objHandle.Object);
@@ -198,7 +205,7 @@ void MonoFlowNode::PostSerialize(SActivationInfo *)
 }
 
 typedef void(*UpdateNodeThunk)(mono::object);
-typedef void(*ActivatePortsThunk)(mono::object, mono::Array, mono::Array);
+typedef void(*ActivatePortsThunk)(mono::object, MonoFlowPortActivation *, int);
 typedef void(*PrecacheResourcesThunk)(mono::object);
 typedef void(*InitializeNodeThunk)(mono::object);
 typedef void(*PostInitializeNodeThunk)(mono::object);
@@ -243,8 +250,8 @@ void MonoFlowNode::ProcessEvent(EFlowEvent event, SActivationInfo *actInfo)
 		break;
 	case eFE_Activate:
 	{
-		List<byte> listIds(64);
-		
+		this->activations.Clear();
+
 		auto data = actInfo->pGraph->GetNodeData(actInfo->myID);
 		int portCount = data->GetNumInputPorts();
 		if (this->targetsEntity)
@@ -257,27 +264,19 @@ void MonoFlowNode::ProcessEvent(EFlowEvent event, SActivationInfo *actInfo)
 		{
 			if (actInfo->pInputPorts[i].IsUserFlagSet())		// Was it activated?
 			{
-				listIds.Add(i);
+				MonoFlowPortActivation activation;
+				activation.Value = MonoFlowData(actInfo->pInputPorts[i]);
+				activation.PortId = i;
+				this->activations.Add(activation);
 			}
 		}
-		
-		IMonoArray<byte> ids =
-			MonoEnv->Objects->Arrays->Create(listIds.Length, MonoEnv->CoreLibrary->Byte);
-		IMonoArray<MonoFlowData> values =
-			MonoEnv->Objects->Arrays->Create(listIds.Length,
-			MonoEnv->Cryambly->GetClass("CryCil.Engine.Logic", "FlowData"));
-		
-		MonoGCHandle arrayHandle0 = MonoEnv->GC->Pin(ids);
-		MonoGCHandle arrayHandle1 = MonoEnv->GC->Pin(values);
-
-		for (byte i = 0; i < listIds.Length; i++)
+
+		if (this->activations.Empty)
 		{
-			byte id = listIds[i];
-			ids[i] = id;
-			values[i] = actInfo->pInputPorts[id];
+			break;
 		}
 
-		activate(this->objHandle.Object, ids, values);
+		activate(this->objHandle.Object, &this->activations[0], int(this->activations.Length));
 
 		break;
 	}
@@ -296,9 +295,13 @@ void MonoFlowNode::ProcessEvent(EFlowEvent event, SActivationInfo *actInfo)
 		setEnt(this->objHandle.Object, actInfo->pEntity->GetId());
 		break;
 	case eFE_Suspend:
+		this->suspended = true;
+		this->RefreshUpdateRegistration();
 		suspend(this->objHandle.Object);
 		break;
 	case eFE_Resume:
+		this->suspended = false;
+		this->RefreshUpdateRegistration();
 		resume(this->objHandle.Object);
 		break;
 	case eFE_ConnectInputPort:
@@ -320,6 +323,95 @@ void MonoFlowNode::ProcessEvent(EFlowEvent event, SActivationInfo *actInfo)
 	}
 }
 
+List<MonoFlowNode *> MonoFlowNode::updatedNodes;
+unsigned int MonoFlowNode::updatedObjectsHandle = -1;
+int MonoFlowNode::updatedObjectsCapacity = 0;
+int MonoFlowNode::updatedObjectsCount = 0;
+
+void MonoFlowNode::RefreshUpdateRegistration()
+{
+	bool updated = this->regularlyUpdated && !this->suspended && this->objHandle.IsValid;
+	if (updated == (this->updateIndex != -1))
+	{
+		return;
+	}
+
+	if (updated)
+	{
+		this->updateIndex = int(updatedNodes.Length);
+		updatedNodes.Add(this);
+		return;
+	}
+
+	// Move the last node into the place of this one to keep the list dense.
+	MonoFlowNode *lastNode = updatedNodes[int(updatedNodes.Length) - 1];
+	updatedNodes[this->updateIndex] = lastNode;
+	lastNode->updateIndex = this->updateIndex;
+	updatedNodes.Cut();
+	this->updateIndex = -1;
+}
+
+RAW_THUNK typedef void(*UpdateNodesThunk)(mono::Array, int);
+
+void MonoFlowNode::UpdateNodes()
+{
+	static UpdateNodesThunk thunk = UpdateNodesThunk(GetFlowNodeClass()->GetFunction("UpdateNodes", 2)->RawThunk);
+
+	int count = int(updatedNodes.Length);
+	if (count == 0 && updatedObjectsCount == 0)
+	{
+		return;
+	}
+
+	mono::Array objects;
+	if (count <= updatedObjectsCapacity)
+	{
+		objects = mono::Array(MonoEnv->GC->GetGCHandleTarget(updatedObjectsHandle));
+	}
+	else
+	{
+		// The handle is only valid after the array has been created for the first time.
+		if (updatedObjectsCapacity != 0)
+		{
+			MonoEnv->GC->ReleaseGCHandle(updatedObjectsHandle);
+		}
+
+		updatedObjectsCapacity = count * 2 > 64 ? count * 2 : 64;
+		objects = MonoEnv->Objects->Arrays->Create(updatedObjectsCapacity, GetFlowNodeClass());
+		updatedObjectsHandle = MonoEnv->GC->Keep(objects);
+		updatedObjectsCount = 0;
+	}
+
+	// References are stored through write barriers, since the array can be in the old generation.
+	MonoArray *array = reinterpret_cast<MonoArray *>(objects);
+	for (int i = 0; i < count; i++)
+	{
+		mono_array_setref(array, i, reinterpret_cast<MonoObject *>(updatedNodes[i]->objHandle.Object));
+	}
+	// Forget the nodes that are not updated anymore, so they can be collected.
+	for (int i = count; i < updatedObjectsCount; i++)
+	{
+		mono_array_setref(array, i, nullptr);
+	}
+	updatedObjectsCount = count;
+
+	if (count != 0)
+	{
+		thunk(objects, count);
+	}
+}
+
+void MonoFlowNode::ReleaseUpdatedNodes()
+{
+	if (updatedObjectsCapacity != 0)
+	{
+		MonoEnv->GC->ReleaseGCHandle(updatedObjectsHandle);
+	}
+	updatedObjectsHandle = -1;
+	updatedObjectsCapacity = 0;
+	updatedObjectsCount = 0;
+}
+
 void MonoFlowNode::GetMemoryUsage(ICrySizer *) const
 {
 	
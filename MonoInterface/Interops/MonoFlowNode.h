@@ -4,6 +4,9 @@
 
 #include "CryFlowGraph/IFlowSystem.h"
 
+// The layout must match CryCil.Engine.Logic.FlowData on every platform: the value takes 12 bytes and is
+// followed by the type, so the text pointer cannot be allowed to align the structure to 8 bytes.
+#pragma pack(push, 4)
 struct MonoFlowData
 {
 	union
@@ -92,6 +95,21 @@ struct MonoFlowData
 	}
 };
 
+#pragma pack(pop)
+
+static_assert(offsetof(MonoFlowData, DataType) == 12, "MonoFlowData must match the layout of FlowData.");
+
+//! Represents an input port that was activated along with the value that was passed to it.
+struct MonoFlowPortActivation
+{
+	MonoFlowData Value;
+	byte PortId;
+};
+
+// Managed code reads activations from the buffer with the stride of FlowPortActivation.
+static_assert(sizeof(MonoFlowPortActivation) == 20,
+			  "MonoFlowPortActivation must match the layout of FlowPortActivation.");
+
 //! Represents an abstraction layer between Flow System and CryCIL.
 struct MonoFlowNode : public IFlowNode
 {
@@ -100,6 +118,19 @@ private:
 	MonoGCHandle objHandle;
 	bool targetsEntity;
 	SFlowNodeConfig nodeConfig;
+	//! Activated ports are collected here, so the buffer can be reused without allocating memory on every
+	//! activation.
+	List<MonoFlowPortActivation> activations;
+	int updateIndex;			//!< Index of this node in the list of updated nodes, or -1.
+	bool regularlyUpdated;
+	bool suspended;
+
+	//! Nodes that are updated every frame. Managed objects of these nodes are passed to managed code in
+	//! one array, so all nodes are updated with a single call.
+	static List<MonoFlowNode *> updatedNodes;
+	static unsigned int updatedObjectsHandle;	//!< Handle of the array of managed objects of updated nodes.
+	static int updatedObjectsCapacity;
+	static int updatedObjectsCount;				//!< Number of elements that were set during last update.
 public:
 	MonoFlowNode(TFlowNodeTypeId typeId, SActivationInfo *info, bool &cancel);
 	//! Signals managed object to release the resources it held.
@@ -127,5 +158,23 @@ public:
 	//! Deactivates the node, so it doesn't work anymore.
 	//!
 	//! This exists just in case Mono run-time gets shut down before flow graph system.
-	void Deactivate() { this->objHandle.Separate(); }
+	void Deactivate()
+	{
+		this->objHandle.Separate();
+		this->RefreshUpdateRegistration();
+	}
+	//! Sets the value that indicates whether this node is updated every frame.
+	void SetRegularlyUpdated(bool value)
+	{
+		this->regularlyUpdated = value;
+		this->RefreshUpdateRegistration();
+	}
+
+	//! Updates all nodes that are updated every frame with a single call to managed code.
+	static void UpdateNodes();
+	//! Releases the array that is used to pass updated nodes to managed code.
+	static void ReleaseUpdatedNodes();
+private:
+	//! Adds this node to the list of updated nodes or removes it from there.
+	void RefreshUpdateRegistration();
 };
\ No newline at end of file
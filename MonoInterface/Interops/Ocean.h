@@ -17,6 +17,7 @@ struct OceanInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Environment"; }
 	
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static byte           get_RenderOptions();
 	static void           set_RenderOptions(byte flags);
@@ -10,6 +10,7 @@ struct ParametricSamplerInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static uint8 GetCurrentSegmentIndexBSpace(SParametricSampler *handle);
 };
\ No newline at end of file
@@ -11,6 +11,7 @@ struct ParticleEffectInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IParticleEmitter     *SpawnEmitter(IParticleEffect *handle, const QuatTS &loc,
 											  const MonoParticleSpawnParameters &parameters);
@@ -9,6 +9,7 @@ struct ParticleEffectIteratorInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static IParticleEffectIterator *Create();
 	static void Delete(IParticleEffectIterator *handle);
@@ -13,6 +13,7 @@ struct ParticleParametersInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static mono::string get_Comment(ParticleParametersObject *obj);
 	static void set_Comment(ParticleParametersObject *obj, mono::string value);
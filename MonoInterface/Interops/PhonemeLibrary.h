@@ -11,6 +11,7 @@ struct PhonemeLibraryInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters.Faces"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static int  GetPhonemeCount();
 	static bool GetPhonemeInfo(int nIndex, SPhonemeInfo &phoneme);
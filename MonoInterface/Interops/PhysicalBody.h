@@ -8,6 +8,7 @@ struct PhysicalBodyInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Physics"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static phys_geometry *RegisterGeometry(IGeometry *shape, int surfaceIdx, IMaterial *material);
 	static int            AddRefGeometry(phys_geometry *handle);
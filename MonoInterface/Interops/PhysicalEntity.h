@@ -9,6 +9,7 @@ struct PhysicalEntityInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Physics"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static pe_type GetPhysicalType(IPhysicalEntity *handle);
 	static int  SetParams(IPhysicalEntity *handle, PhysicsParameters *parameters, bool threadSafe);
@@ -8,6 +8,7 @@ struct PostProcessingInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void SetPostEffectParam(mono::string pParam, float fValue, bool bForceValue);
 	static void SetPostEffectParamVec4(mono::string pParam, const Vec4 &pValue, bool bForceValue);
@@ -8,6 +8,7 @@ struct ProfilingInterop : public IMonoInterop<false, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.DebugServices"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	virtual void Shutdown() override;
 
@@ -6,6 +6,7 @@ struct RayInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Geometry"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static int CastRay(Vec3 &origin, Vec3 &direction, int query, uint32 castFlags, ray_hit* hits, int nMaxHits,
 					   IPhysicalEntity **entitiesToSkip, int skipEntityCount, SCollisionClass collisionClass);
@@ -8,6 +8,7 @@ struct RenderMeshInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.StaticObjects"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void AddRef(IRenderMesh *handle);
 	static int Release(IRenderMesh *handle);
@@ -8,6 +8,7 @@ struct RendererInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void DrawTextInternal(Vec3 position, int options, ColorF color, Vec2 scale, mono::string text);
 
@@ -8,6 +8,7 @@ struct RenderShaderResourcesInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static float         GetTransparency     (IRenderShaderResources *rsr);
 	static void          SetTransparency     (IRenderShaderResources *rsr, float value);
@@ -26,6 +27,7 @@ struct ShaderParametersInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static int           GetCount     (DynArrayRef<SShaderParam> *handle);
 	static SShaderParam *GetItemInt   (DynArrayRef<SShaderParam> *handle, int index);
@@ -38,6 +40,7 @@ struct ShaderInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static DynArrayRef<SShaderParam> *GetParameters(IShader *shader);
 };
\ No newline at end of file
@@ -13,6 +13,7 @@ struct SkeletonAnimationInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void SetDebugging(ISkeletonAnim *handle, bool flags);
 	static void SetAnimationDrivenMotion(ISkeletonAnim *handle, bool ts);
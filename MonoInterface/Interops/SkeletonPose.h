@@ -10,6 +10,7 @@ struct SkeletonPoseInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.Characters"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void             BuildPhysicalEntityInternal(ISkeletonPose *handle, IPhysicalEntity *pent, float mass,
 														const Matrix34 &mtxloc, int surfaceIdx, float stiffnessScale,
@@ -8,6 +8,7 @@ struct SplineInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Geometry.Splines"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static int GetNumDimensionsInternal(ISplineInterpolator *handle);
 
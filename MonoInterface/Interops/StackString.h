@@ -8,6 +8,7 @@ struct StackStringInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Utilities"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void AssignString(stack_string *ptr, mono::string str);
 	static mono::string GetString(stack_string *ptr);
@@ -10,6 +10,7 @@ struct StaticObjectInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.StaticObjects"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static int AddRef(IStatObj *handle);
 	static int Release(IStatObj *handle);
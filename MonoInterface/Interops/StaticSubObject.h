@@ -8,6 +8,7 @@ struct StaticSubObjectInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Models.StaticObjects"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static mono::string GetName(IStatObj::SSubObject *obj);
 	static void         SetName(IStatObj::SSubObject *obj, mono::string name);
@@ -8,6 +8,7 @@ struct SurfaceTypeInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Physics"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static ISurfaceType                     *Get(mono::string name);
 	static ISurfaceType                     *GetInt(int id);
@@ -32,6 +33,7 @@ struct SurfaceTypeEnumeratorInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Physics"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static ISurfaceTypeEnumerator *Init();
 	static ISurfaceType *GetFirst(ISurfaceTypeEnumerator *handle);
@@ -8,6 +8,7 @@ struct TerrainInterop : public IMonoInterop < true, true >
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Environment"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static int   get_UnitSize();
 	static int   get_Size();
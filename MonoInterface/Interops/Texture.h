@@ -8,6 +8,7 @@ struct TextureInterop : public IMonoInterop<true,true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static void set_Clamp(mono::object obj, bool value);
 	static void set_Filter(mono::object obj, int value);
@@ -12,6 +12,7 @@ struct TimeOfDayInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Environment"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static ITimeOfDay::SAdvancedInfo get_Cycle();
 	static void set_Cycle(ITimeOfDay::SAdvancedInfo value);
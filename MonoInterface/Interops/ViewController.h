@@ -25,6 +25,7 @@ struct ViewControllerInterop : IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Engine.Rendering.Views"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static MonoViewController *Create(mono::object view);
 	static void DeleteThis(MonoViewController *handle);
@@ -8,6 +8,7 @@ struct WriteLockCondInterop : public IMonoInterop<true, true>
 	virtual const char *GetInteropNameSpace() override { return "CryCil.Utilities"; }
 
 	virtual void InitializeInterops() override;
+	virtual bool IsPureRegistration() override { return true; }
 
 	static WriteLockCond *CreateLock();
 	static void ReleaseLock(WriteLockCond *handle);
@@ -1,15 +1,15 @@
 ﻿#pragma once
 
-template<typename ElementType, typename AllocatorType> class List;
+template<typename ElementType, typename AllocatorType, typename ReferenceCountType> class List;
 
 //! Represents a header of the list. All shallow copies of the same list point at the same header object.
-template<typename ElementType, typename AllocatorType>
+template<typename ElementType, typename AllocatorType, typename ReferenceCountType>
 class ListObject : public CollectionBase
 {
 	// Whoever invented name hiding can go die in hell.
 	using CollectionBase::InvalidateIterators;
 
-	friend List<ElementType, AllocatorType>;
+	friend List<ElementType, AllocatorType, ReferenceCountType>;
 	friend ListIteratorConst<ListObject>;
 public:
 	typedef ElementType value_type;
@@ -52,7 +52,7 @@ private:
 
 	CompressedPair<allocator_type, ListDimensions> AllocDimensionsPair;
 
-	size_type ReferenceCount;	//!< Number of live references to this list.
+	ReferenceCountType ReferenceCount;	//!< Number of live references to this list.
 
 	//
 	// Properties.
@@ -130,13 +130,15 @@ public:
 	//! Informs this object about removal of reference to this object.
 	size_type UnregisterReference()
 	{
-		if (--this->ReferenceCount == 0)
+		// The count must be read only once: other references can be released concurrently.
+		size_type referenceCount = --this->ReferenceCount;
+		if (referenceCount == 0)
 		{
 			this->InvalidateIterators();
 			this->FreeStorage();
 		}
 
-		return this->ReferenceCount;
+		return referenceCount;
 	}
 
 	//
@@ -258,40 +260,67 @@ private:
 		if (newCapacity == 0)
 		{
 			this->FreeStorage();
+			return;
 		}
 
-		pointer oldMemory = this->First();
-		pointer oldLast = this->Last();
+		// If new capacity is not enough to fit all live objects, then deinitialize the remainder.
+		if (size_type(this->Last() - this->First()) > newCapacity)
+		{
+			this->Allocator().DeinitializeRange(this->First() + newCapacity, this->Last());
+			this->Last() = this->First() + newCapacity;
+		}
 
-		// Allocate new memory.
-		pointer newMemory = this->Allocator().Allocate(newCapacity);
-		pointer newEnd = newMemory + newCapacity;
-		pointer currentNew = newMemory;
+		this->ReallocateStorage(newCapacity,
+								std::integral_constant<bool, CanReallocate<allocator_type>::value &&
+								IsTriviallyRelocatable<value_type>::value>());
+	}
+	// Lets the allocator resize the memory block.
+	void ReallocateStorage(size_type newCapacity, std::true_type)
+	{
+		size_type length = this->Last() - this->First();
 
-		// Copy all old data to the new memory while invoking move constructors to inform objects about their
-		// new locations.
-		{
-			pointer currentOld = oldMemory;
-			for (; currentOld < oldLast && currentNew < newEnd; currentNew++, currentOld++)
-			{
-				this->Allocator().Initialize(currentNew, std::move(*currentOld));
-				this->Allocator().Deinitialize(currentOld);
-			}
+		pointer newMemory = this->Allocator().Reallocate(this->First(), newCapacity);
 
-			// If new capacity is not enough to fit all live objects, then deinitialize the remainder.
-			if (currentOld < oldLast)
-			{
-				this->Allocator().DeinitializeRange(currentOld, oldLast);
-			}
-		}
+		this->First() = newMemory;
+		this->Last() = newMemory + length;
+		this->End() = newMemory + newCapacity;
+	}
+	// Moves the objects to the new memory block.
+	void ReallocateStorage(size_type newCapacity, std::false_type)
+	{
+		pointer oldMemory = this->First();
+		size_type length = this->Last() - oldMemory;
 
-		// Deallocate old memory.
+		pointer newMemory = this->Allocator().Allocate(newCapacity);
+		this->RelocateRange(newMemory, oldMemory, this->Last());
 		this->Allocator().Deallocate(oldMemory);
 
-		// Update pointers.
 		this->First() = newMemory;
-		this->Last() = currentNew;
-		this->End() = newEnd;
+		this->Last() = newMemory + length;
+		this->End() = newMemory + newCapacity;
+	}
+	//! Moves a range of live objects into the uninitialized memory that doesn't overlap with the range. Objects
+	//! in the source range are deinitialized afterwards.
+	void RelocateRange(pointer destination, pointer first, pointer last)
+	{
+		this->RelocateRange(destination, first, last,
+							std::integral_constant<bool, IsTriviallyRelocatable<value_type>::value>());
+	}
+	void RelocateRange(pointer destination, pointer first, pointer last, std::true_type)
+	{
+		if (first != last)
+		{
+			memcpy(destination, first, (last - first) * sizeof(value_type));
+		}
+	}
+	void RelocateRange(pointer destination, pointer first, pointer last, std::false_type)
+	{
+		// Invoke move constructors to inform objects about their new locations.
+		for (; first != last; first++, destination++)
+		{
+			this->Allocator().Initialize(destination, std::move(*first));
+			this->Allocator().Deinitialize(first);
+		}
 	}
 	//! Releases memory that is taken up by this list.
 	void FreeStorage()
@@ -1,9 +1,11 @@
 ﻿#pragma once
 
 #include <functional>
+#include <cstring>
 #include "ExtraTypeTraits.h"
 #include "Tuples.h"
 #include "Allocation.hpp"
+#include "AtomicReferenceCount.h"
 #include "Collection.hpp"
 #include "List.Iteration.hpp"
 #include "List.Object.hpp"
@@ -26,11 +28,18 @@ struct DefaultComparison
 //!
 //! This type resembles a fusion of std::vector from STL and System.Collections.Generic.List`1 from .Net.
 //!
-//! @tparam ElementType   Type of objects that are going to be contained within this array.
-//! @tparam AllocatorType Type of object to use to allocate and deallocate memory, initialize and destroy
-//!                       objects. Implementation of such is best done by specializing the DefaultAllocator`1
-//!                       template.
-template<typename ElementType, typename AllocatorType = DefaultAllocator<ElementType>>
+//! Shallow copies of the list share the same list object. By default the number of copies is tracked with a
+//! plain integer, so shallow copies of the same list must not be made or destroyed by different threads at the
+//! same time; SharedList`1 uses an atomic counter for the lists that are handed over to other threads. Note
+//! that only the reference count is atomic: modification of the list itself still has to be synchronized.
+//!
+//! @tparam ElementType        Type of objects that are going to be contained within this array.
+//! @tparam AllocatorType      Type of object to use to allocate and deallocate memory, initialize and destroy
+//!                            objects. Implementation of such is best done by specializing the
+//!                            DefaultAllocator`1 template.
+//! @tparam ReferenceCountType Type of object that counts shallow copies of the list.
+template<typename ElementType, typename AllocatorType = DefaultAllocator<ElementType>,
+		 typename ReferenceCountType = size_t>
 class List
 {
 	friend ListIteratorConst<List>;
@@ -45,12 +54,15 @@ public:
 	typedef ptrdiff_t difference_type;
 
 	typedef AllocatorType allocator_type;
-	typedef ListObject<value_type, allocator_type> list_object_type;
+	typedef ListObject<value_type, allocator_type, ReferenceCountType> list_object_type;
 	typedef ListIterator<list_object_type> iterator_type;
 	typedef ListIteratorConst<list_object_type> const_iterator_type;
 
 	typedef std::function<int(const_reference, const_reference)> Comparison;
 
+	//! Smallest capacity the list gets when it has to expand.
+	static constexpr size_type MinimalExpandedCapacity = 4;
+
 private:
 	//! A compressed pair of 2 objects: an allocator object that is used to work with memory and a pointer to
 	//! the list header object.
@@ -361,7 +373,7 @@ public:
 	{
 		if (this->First() == nullptr)
 		{
-			this->list->AllocateStorage(capacity);
+			this->list->AllocateStorage(this->CalculateExpandedCapacity(capacity));
 			return;
 		}
 		
@@ -382,6 +394,24 @@ public:
 	{
 		this->EnsureCapacity(count + this->Last() - this->First());
 	}
+	//! Ensures that this list can have _count_ items added to it without allocating any extra memory.
+	//!
+	//! Use this method instead of Reserve when the final number of elements is known.
+	//!
+	//! @param count The number of objects that must be allowed to be added to this list without it having
+	//!              to expand after this method is done.
+	void ReserveExact(size_type count)
+	{
+		size_type capacity = count + this->Length;
+		if (this->First() == nullptr)
+		{
+			this->list->AllocateStorage(capacity);
+		}
+		else if (this->Capacity < capacity)
+		{
+			this->list->ReallocateStorage(capacity);
+		}
+	}
 
 	//
 	// Putting elements into the list.
@@ -415,6 +445,27 @@ public:
 		this->Allocator().Initialize(last, std::forward<value_type>(item));
 		this->Last() = last + 1;
 	}
+	//! Adds a number of elements to the end of this list without initializing them.
+	//!
+	//! This method allows the producers of data to write it into the list directly. The list is expanded the
+	//! same way Reserve() does it, so call ReserveExact() first, if the final number of elements is known.
+	//!
+	//! @param count Number of elements to add.
+	//!
+	//! @returns A pointer to the first added element.
+	pointer AppendUninitialized(size_type count)
+	{
+		static_assert(std::is_trivial<value_type>::value, "Only elements of trivial types can be left uninitialized.");
+
+		this->Reserve(count);
+
+		pointer first = this->Last();
+
+		this->list->InvalidateIterators(first);
+
+		this->Last() = first + count;
+		return first;
+	}
 	//! Adds an item to the end of this list.
 	//!
 	//! @param item Reference to the object to copy into this list.
@@ -483,6 +534,12 @@ public:
 			this->Allocator().Initialize(this->Last()++, *left);	// Make a copy.
 		}
 	}
+	void AddRange(const_pointer left, const_pointer right, ForwardIteratorTag)
+	{
+		this->Reserve(right - left);
+
+		this->Last() = this->CopyRange(this->Last(), left, right);
+	}
 	//! Inserts another list into this one.
 	//!
 	//! @param other Reference to the list to add to this one.
@@ -609,70 +666,30 @@ private:
 		if (this->UnusedCapacity < rangeLength)
 		{
 			// Allocate new memory for the list.
-			size_type oldCapacity = this->Capacity;
-			pointer oldMemory = this->First();
-
-			auto oldLength = this->Length;
-			size_type index = position - oldMemory;
-
-			size_type newCapacity = this->CalculateExpandedCapacity(oldCapacity + rangeLength);
+			size_type newCapacity = this->CalculateExpandedCapacity(this->Length + rangeLength);
 			pointer newMemory = this->Allocator().Allocate(newCapacity);
-			pointer newMemoryLast = newMemory + oldLength + rangeLength;
-			pointer newMemoryEnd = newMemory + newCapacity;
-
-			// Move elements before the insertion point.
-			pointer currentSource = oldMemory;
-			pointer currentDest = newMemory;
-			pointer insertionPoint = newMemory + index;
-
-			for (; currentDest != insertionPoint; currentSource++, currentDest++)
-			{
-				this->Allocator().Initialize(currentDest, std::move(*currentSource));
-			}
+			pointer insertionPoint = newMemory + (position - this->First());
 
-			// Copy the elements that need insertion.
-			for (; first != last; ++first, currentDest++)
+			// Copy the elements that need insertion before moving the others, since the range can be a part of
+			// this list.
+			for (pointer current = insertionPoint; first != last; current++, ++first)
 			{
-				this->Allocator().Initialize(currentDest, *first);
+				this->Allocator().Initialize(current, *first);
 			}
 
-			// Move the rest.
-			for (; currentDest != newMemoryLast; currentSource++, currentDest++)
-			{
-				this->Allocator().Initialize(currentDest, std::move(*currentSource));
-			}
-
-			// Deinitialize and deallocate old memory.
-			this->list->FreeStorage();
-
-			this->First() = newMemory;
-			this->Last() = newMemoryLast;
-			this->End() = newMemoryEnd;
+			this->MoveAroundGap(newMemory, newCapacity, position, rangeLength);
 		}
 		else
 		{
-			pointer insertionRangeStart = position;
-			pointer insertionRangeEnd = insertionRangeStart + rangeLength;
-			pointer insertionRangeLast =			// This value is used to prevent deinitialization of
-				insertionRangeEnd > this->Last()	// objects beyond usable bounds of the list.
-				? this->Last()
-				: insertionRangeEnd;
-
 			// Orphan iterators that are at the insertion point or beyond it.
-			this->list->InvalidateIterators(insertionRangeStart, this->Last());
-
-			// Move the range of last elements to make space for other elements.
-			this->ShiftRange(insertionRangeStart, this->Last(), insertionRangeEnd);
-			this->Last() += rangeLength;
+			this->list->InvalidateIterators(position, this->Last());
 
-			// Deinitialize the elements in the hole.
-			this->Allocator().DeinitializeRange(insertionRangeStart, insertionRangeLast);
+			this->OpenGap(position, rangeLength);
 
 			// Copy elements into the insertion hole.
-			pointer currentInsertionPoint = insertionRangeStart;
-			for (; currentInsertionPoint != insertionRangeEnd; currentInsertionPoint++, ++first)
+			for (pointer current = position; first != last; current++, ++first)
 			{
-				this->Allocator().Initialize(currentInsertionPoint, *first);
+				this->Allocator().Initialize(current, *first);
 			}
 		}
 	}
@@ -824,53 +841,21 @@ private:
 		if (this->UnusedCapacity < 1)
 		{
 			// Allocate new memory for the list.
-			size_type oldCapacity = this->Capacity;
-			pointer oldMemory = this->First();
-			auto oldLength = this->Length;
-			size_type index = position - oldMemory;
-
-			size_type newCapacity = this->CalculateExpandedCapacity(oldCapacity + 1);
+			size_type newCapacity = this->CalculateExpandedCapacity(this->Length + 1);
 			pointer newMemory = this->Allocator().Allocate(newCapacity);
-			pointer newMemoryLast = newMemory + oldLength + 1;
-			pointer newMemoryEnd = newMemory + newCapacity;
-
-			// Move elements before the insertion point.
-			pointer currentSource = oldMemory;
-			pointer currentDest = newMemory;
-			pointer insertionPoint = newMemory + index;
-
-			for (; currentDest != insertionPoint; currentSource++, currentDest++)
-			{
-				this->Allocator().Initialize(currentDest, std::move(*currentSource));
-			}
-
-			// Initialize the element.
-			this->Allocator().Initialize(currentDest++, std::forward<ArgumentTypes>(arguments)...);
-
-			// Move the rest.
-			for (; currentDest != newMemoryLast; currentSource++, currentDest++)
-			{
-				this->Allocator().Initialize(currentDest, std::move(*currentSource));
-			}
 
-			// Deinitialize and deallocate old memory.
-			this->list->FreeStorage();
+			// Initialize the element before moving the others, since arguments can refer to them.
+			this->Allocator().Initialize(newMemory + (position - this->First()),
+										 std::forward<ArgumentTypes>(arguments)...);
 
-			this->First() = newMemory;
-			this->Last() = newMemoryLast;
-			this->End() = newMemoryEnd;
+			this->MoveAroundGap(newMemory, newCapacity, position, 1);
 		}
 		else
 		{
 			// Orphan iterators that are at the insertion point or beyond it.
 			this->list->InvalidateIterators(position, this->Last());
 
-			// Move the range of last elements to make space for other elements.
-			this->ShiftRange(position, this->Last(), position + 1);
-			this->Last()++;
-
-			// Deinitialize the elements in the hole.
-			this->Allocator().Deinitialize(position);
+			this->OpenGap(position, 1);
 
 			// Initialize the element in the insertion hole.
 			this->Allocator().Initialize(position, std::forward<ArgumentTypes>(arguments)...);
@@ -1024,9 +1009,7 @@ private:
 	{
 		this->list->InvalidateIterators(left, right - 1);
 
-		this->ShiftRange(right, this->Last(), left);
-
-		this->Cut(right - left);
+		this->CloseGap(left, right, std::integral_constant<bool, IsTriviallyRelocatable<value_type>::value>());
 	}
 
 public:
@@ -1412,6 +1395,7 @@ private:
 		// Delete the object, since there are no live references to it.
 		typename allocator_type::template rebind<list_object_type>::other objectAllocator(this->Allocator());
 
+		objectAllocator.Deinitialize(this->list);
 		objectAllocator.Deallocate(this->list);
 		this->list = nullptr;
 	}
@@ -1436,6 +1420,21 @@ private:
 	}
 	//! Copies a range of elements by using a copy constructor.
 	pointer CopyRange(pointer leftDestination, const_pointer leftSource, const_pointer rightSource)
+	{
+		return this->CopyRange(leftDestination, leftSource, rightSource,
+							   std::integral_constant<bool, std::is_trivially_copyable<value_type>::value>());
+	}
+	pointer CopyRange(pointer leftDestination, const_pointer leftSource, const_pointer rightSource,
+					  std::true_type)
+	{
+		if (leftSource != rightSource)
+		{
+			memcpy(leftDestination, leftSource, (rightSource - leftSource) * sizeof(value_type));
+		}
+		return leftDestination + (rightSource - leftSource);
+	}
+	pointer CopyRange(pointer leftDestination, const_pointer leftSource, const_pointer rightSource,
+					  std::false_type)
 	{
 		pointer currentDestination = leftDestination;
 		const_pointer currentSource = leftSource;
@@ -1443,7 +1442,7 @@ private:
 		while (currentSource != rightSource)
 		{
 			// Use the constant reference to make sure that it's the copy constructor that gets invoked.
-			const_reference currentObjectToCopy = currentSource;
+			const_reference currentObjectToCopy = *currentSource;
 			this->Allocator().Initialize(currentDestination, currentObjectToCopy);
 
 			currentDestination++;
@@ -1502,6 +1501,71 @@ private:
 			}
 		}
 	}
+	//! Moves the elements into a new memory block around a range of elements that were already initialized
+	//! in it, and releases the old memory.
+	//!
+	//! @param newMemory   A pointer to the new memory block.
+	//! @param newCapacity Number of elements that fit into the new memory block.
+	//! @param position    A pointer to the element in the old memory that goes right after the range.
+	//! @param count       Number of elements in the range.
+	void MoveAroundGap(pointer newMemory, size_type newCapacity, pointer position, size_type count)
+	{
+		pointer oldMemory = this->First();
+		pointer oldLast = this->Last();
+
+		this->list->RelocateRange(newMemory, oldMemory, position);
+		this->list->RelocateRange(newMemory + (position - oldMemory) + count, position, oldLast);
+		this->Allocator().Deallocate(oldMemory);
+
+		this->First() = newMemory;
+		this->Last() = newMemory + (oldLast - oldMemory) + count;
+		this->End() = newMemory + newCapacity;
+	}
+	//! Moves the elements that are located at and after the position to the right leaving a gap of
+	//! uninitialized elements. The list must have enough capacity for that.
+	void OpenGap(pointer position, size_type count)
+	{
+		this->OpenGap(position, count, std::integral_constant<bool, IsTriviallyRelocatable<value_type>::value>());
+	}
+	void OpenGap(pointer position, size_type count, std::true_type)
+	{
+		memmove(position + count, position, (this->Last() - position) * sizeof(value_type));
+		this->Last() += count;
+	}
+	void OpenGap(pointer position, size_type count, std::false_type)
+	{
+		pointer gapEnd = position + count;
+		pointer gapLast =				// This value is used to prevent deinitialization of
+			gapEnd > this->Last()		// objects beyond usable bounds of the list.
+			? this->Last()
+			: gapEnd;
+
+		// Move the range of last elements to make space for other elements.
+		this->ShiftRange(position, this->Last(), gapEnd);
+		this->Last() += count;
+
+		// Deinitialize the elements in the hole.
+		this->Allocator().DeinitializeRange(position, gapLast);
+	}
+	//! Removes a range of elements and moves the elements that follow it to the left.
+	void CloseGap(pointer left, pointer right, std::true_type)
+	{
+		size_type count = right - left;
+
+		this->Allocator().DeinitializeRange(left, right);
+		memmove(left, right, (this->Last() - right) * sizeof(value_type));
+
+		this->list->InvalidateIterators(this->Last() - count, this->Last() - 1);
+		this->Last() -= count;
+	}
+	void CloseGap(pointer left, pointer right, std::false_type)
+	{
+		this->ShiftRange(right, this->Last(), left);
+
+		this->Cut(right - left);
+	}
+	//! Calculates the capacity the list must have to fit specified number of elements. The capacity grows by
+	//! 50% at a time, so the memory that is released by previous expansions can be reused by the next ones.
 	size_type CalculateExpandedCapacity(size_type minimalDesiredCapacity) const
 	{
 		size_type result = this->Capacity;
@@ -1515,6 +1579,12 @@ private:
 			result += result / 2;
 		}
 
+		// Don't waste time on tiny expansions of short lists.
+		if (result < MinimalExpandedCapacity)
+		{
+			result = MinimalExpandedCapacity;
+		}
+
 		return result < minimalDesiredCapacity
 			? minimalDesiredCapacity
 			: result;
@@ -1549,8 +1619,19 @@ private:
 	}
 };
 
-template<typename ElementType, typename AllocatorType>
-inline void DeleteAll(List<ElementType, AllocatorType> &list)
+//! Represents a list which shallow copies can be made and destroyed by different threads.
+template<typename ElementType, typename AllocatorType = DefaultAllocator<ElementType>>
+using SharedList = List<ElementType, AllocatorType, AtomicReferenceCount<size_t>>;
+
+//! Lists only hold a pointer to the list object, so they can be moved around with memmove.
+template<typename ElementType, typename AllocatorType, typename ReferenceCountType>
+struct IsTriviallyRelocatable<List<ElementType, AllocatorType, ReferenceCountType>>
+{
+	static constexpr bool value = true;
+};
+
+template<typename ElementType, typename AllocatorType, typename ReferenceCountType>
+inline void DeleteAll(List<ElementType, AllocatorType, ReferenceCountType> &list)
 {
 	for (auto &current : list)
 	{
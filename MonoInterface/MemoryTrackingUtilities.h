@@ -1,25 +1,86 @@
 ﻿#pragma once
 
+#include <atomic>
+#include <mutex>
 #include "ArrayHeader.h"
 
 //! Provides utilities for tracking amount of allocated memory that is used by the type.
 //!
+//! Every thread counts the memory in its own counter, so allocations that are made by different threads don't
+//! fight over the same cache line. The counters are summed up when the total amount is requested. Memory can be
+//! allocated by one thread and released by another, so the value of any single counter can be negative.
+//!
 //! @tparam TrackedType Type to track memory for.
 template<typename TrackedType>
 struct MemoryTracker
 {
 	friend TrackedType;
 private:
-	static size_t &MemoryCounter()
+	//! Represents a counter of memory that was allocated and released by one thread.
+	struct ThreadCounter
+	{
+		std::atomic<ptrdiff_t> Value;	//!< Only the owning thread writes the value, others can read it.
+		ThreadCounter *Next;			//!< Next counter in the list of counters of live threads.
+
+		ThreadCounter()
+			: Value(0)
+		{
+			std::lock_guard<std::mutex> lock(Lock());
+			this->Next = FirstCounter();
+			FirstCounter() = this;
+		}
+		~ThreadCounter()
+		{
+			std::lock_guard<std::mutex> lock(Lock());
+			// Keep the balance of the thread that is about to finish.
+			RetiredMemory() += this->Value.load(std::memory_order_relaxed);
+
+			ThreadCounter **link = &FirstCounter();
+			while (*link != this)
+			{
+				link = &(*link)->Next;
+			}
+			*link = this->Next;
+		}
+	};
+
+	//! Gets the lock that guards the list of counters.
+	static std::mutex &Lock()
+	{
+		// Never deleted, since threads can finish after destruction of static objects.
+		static std::mutex *lock = new std::mutex();
+		return *lock;
+	}
+	//! Gets the first counter in the list of counters of live threads.
+	static ThreadCounter *&FirstCounter()
+	{
+		static ThreadCounter *first = nullptr;
+		return first;
+	}
+	//! Gets the amount of memory that was counted by threads that have finished.
+	static ptrdiff_t &RetiredMemory()
 	{
-		static size_t counter = 0;
-		return counter;
+		static ptrdiff_t memory = 0;
+		return memory;
+	}
+	//! Gets the counter of the calling thread.
+	static std::atomic<ptrdiff_t> &MemoryCounter()
+	{
+		static thread_local ThreadCounter counter;
+		return counter.Value;
 	}
 public:
 	//! Gets number of bytes that were allocated by the TrackedType.
 	static size_t AllocatedMemory()
 	{
-		return MemoryCounter();
+		std::lock_guard<std::mutex> lock(Lock());
+
+		ptrdiff_t total = RetiredMemory();
+		for (ThreadCounter *current = FirstCounter(); current; current = current->Next)
+		{
+			total += current->Value.load(std::memory_order_relaxed);
+		}
+		return size_t(total);
 	}
 private:
 	//! Informs this tracker of allocation of specified number of bytes.
@@ -27,14 +88,17 @@ private:
 	//! @param amount Number of bytes that were allocated.
 	static void AddMemory(size_t amount)
 	{
-		MemoryCounter() += amount;
+		// No other thread writes to this counter, so read-modify-write operation is not necessary.
+		std::atomic<ptrdiff_t> &counter = MemoryCounter();
+		counter.store(counter.load(std::memory_order_relaxed) + ptrdiff_t(amount), std::memory_order_relaxed);
 	}
 	//! Informs this tracker of deallocation of specified number of bytes.
 	//!
 	//! @param amount Number of bytes that were deallocated.
 	static void RemoveMemory(size_t amount)
 	{
-		MemoryCounter() -= amount;
+		std::atomic<ptrdiff_t> &counter = MemoryCounter();
+		counter.store(counter.load(std::memory_order_relaxed) - ptrdiff_t(amount), std::memory_order_relaxed);
 	}
 
 	//! Informs this tracker of allocation of specified number of objects.
@@ -176,17 +176,17 @@ public:
 			totalLength += _strlen(*current);
 		}
 
-		SymbolType *chars         = new SymbolType[totalLength];
+		// One more symbol for the null terminator.
+		SymbolType *chars         = new SymbolType[totalLength + 1];
 		int         currentLength = 0;
 
 		for (auto current = parts.begin(); current < parts.end(); current++)
 		{
 			const SymbolType *currentPart = *current;
 			int               partLength  = _strlen(currentPart);
-			for (int i = 0; i < partLength; i++)
-			{
-				chars[currentLength++] = currentPart[i];
-			}
+
+			memcpy(chars + currentLength, currentPart, partLength * sizeof(SymbolType));
+			currentLength += partLength;
 		}
 
 		chars[currentLength] = '\0';
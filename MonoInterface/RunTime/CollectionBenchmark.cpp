@@ -0,0 +1,322 @@
+#include "stdafx.h"
+
+#include "CollectionBenchmark.h"
+#include "HashMap.h"
+
+// Random insertion into the sorted list shifts half of it on average, so it takes minutes with 10^6 keys.
+#define MAX_RANDOM_SORTED_INSERTIONS 10000
+// Same goes for insertion into and erasure from the middle of the list.
+#define MAX_LIST_SHIFTS 10000
+// Number of elements that are added by each call to AddRange.
+#define LIST_RANGE_LENGTH 16
+
+void CollectionBenchmark::Initialize()
+{
+	gEnv->pConsole->AddCommand("cil_HashMapBenchmark", HashMaps, VF_NULL,
+							   "Compares the time it takes to add and look up integer keys in SortedList and "
+							   "HashMap with 10^2-10^6 keys. Usage: cil_HashMapBenchmark [largest number of keys]");
+	gEnv->pConsole->AddCommand("cil_ListBenchmark", Lists, VF_NULL,
+							   "Compares the time it takes to add, insert, erase and look up elements in List and "
+							   "std::vector. Usage: cil_ListBenchmark [number of elements]");
+}
+
+void CollectionBenchmark::Shutdown()
+{
+	gEnv->pConsole->RemoveCommand("cil_HashMapBenchmark");
+	gEnv->pConsole->RemoveCommand("cil_ListBenchmark");
+}
+
+void CollectionBenchmark::HashMaps(IConsoleCmdArgs *args)
+{
+	int maxCount = 1000000;
+	if (args->GetArgCount() > 1)
+	{
+		maxCount = atoi(args->GetArg(1));
+		if (maxCount <= 0)
+		{
+			CryLogAlways("Number of keys must be positive.");
+			return;
+		}
+	}
+
+	CryLogAlways("Times per operation in nanoseconds:");
+	CryLogAlways("%8s | %12s %12s %12s | %12s %12s %12s", "Keys",
+				 "Sorted add", "Sorted hit", "Sorted miss", "Hash add", "Hash hit", "Hash miss");
+
+	// Results are summed up, so the lookups cannot be optimized away.
+	__int64 sum = 0;
+	for (int count = 100; count <= maxCount; count *= 10)
+	{
+		// Keys are even numbers, so odd ones can be used to look up missing keys.
+		List<int> keys(count);
+		for (int i = 0; i < count; i++)
+		{
+			keys.Add(i * 2);
+		}
+		unsigned int random = 12345;
+		for (int i = count - 1; i > 0; i--)
+		{
+			random = random * 1664525 + 1013904223;
+			int j = int(random % static_cast<unsigned int>(i + 1));
+			int key = keys[i];
+			keys[i] = keys[j];
+			keys[j] = key;
+		}
+
+		double nanosecondsPerKey = 1000000.0 / count;
+
+		SortedList<int, int> sortedList;
+		bool randomOrder = count <= MAX_RANDOM_SORTED_INSERTIONS;
+		CTimeValue start = gEnv->pTimer->GetAsyncTime();
+		for (int i = 0; i < count; i++)
+		{
+			sortedList.Add(randomOrder ? keys[i] : i * 2, i);
+		}
+		float sortedAddTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+		start = gEnv->pTimer->GetAsyncTime();
+		for (int i = 0; i < count; i++)
+		{
+			int value;
+			if (sortedList.TryGet(keys[i], value))
+			{
+				sum += value;
+			}
+		}
+		float sortedHitTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+		start = gEnv->pTimer->GetAsyncTime();
+		for (int i = 0; i < count; i++)
+		{
+			sum += sortedList.Contains(keys[i] + 1);
+		}
+		float sortedMissTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+		HashMap<int, int> hashMap;
+		start = gEnv->pTimer->GetAsyncTime();
+		for (int i = 0; i < count; i++)
+		{
+			hashMap.Add(keys[i], i);
+		}
+		float hashAddTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+		start = gEnv->pTimer->GetAsyncTime();
+		for (int i = 0; i < count; i++)
+		{
+			int *value = hashMap.Find(keys[i]);
+			if (value)
+			{
+				sum += *value;
+			}
+		}
+		float hashHitTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+		start = gEnv->pTimer->GetAsyncTime();
+		for (int i = 0; i < count; i++)
+		{
+			sum += hashMap.Contains(keys[i] + 1);
+		}
+		float hashMissTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+		CryLogAlways("%8d | %12.1f %12.1f %12.1f | %12.1f %12.1f %12.1f", count,
+					 sortedAddTime * nanosecondsPerKey, sortedHitTime * nanosecondsPerKey,
+					 sortedMissTime * nanosecondsPerKey, hashAddTime * nanosecondsPerKey,
+					 hashHitTime * nanosecondsPerKey, hashMissTime * nanosecondsPerKey);
+
+		if (count > maxCount / 10)
+		{
+			break;
+		}
+	}
+
+	CryLogAlways("Keys were added to sorted lists with more than %d keys in ascending order. Checksum: %lld",
+				 MAX_RANDOM_SORTED_INSERTIONS, sum);
+}
+
+void CollectionBenchmark::Lists(IConsoleCmdArgs *args)
+{
+	int count = 1000000;
+	if (args->GetArgCount() > 1)
+	{
+		count = atoi(args->GetArg(1));
+		if (count <= 0)
+		{
+			CryLogAlways("Number of elements must be positive.");
+			return;
+		}
+	}
+	int shiftCount = count < MAX_LIST_SHIFTS ? count : MAX_LIST_SHIFTS;
+
+	// Positions are pseudo-random, but the same for both containers: i-th position is within [0; i].
+	List<int> positions(shiftCount);
+	unsigned int random = 12345;
+	for (int i = 0; i < shiftCount; i++)
+	{
+		random = random * 1664525 + 1013904223;
+		positions.Add(int(random % static_cast<unsigned int>(i + 1)));
+	}
+	int range[LIST_RANGE_LENGTH];
+	for (int i = 0; i < LIST_RANGE_LENGTH; i++)
+	{
+		range[i] = i;
+	}
+	Text text("Text that is shared by all elements.");
+
+	double nanosecondsPerElement = 1000000.0 / count;
+	double nanosecondsPerShift = 1000000.0 / shiftCount;
+
+	// Results are summed up, so the lookups cannot be optimized away.
+	__int64 sum = 0;
+
+	// Add.
+	CTimeValue start = gEnv->pTimer->GetAsyncTime();
+	{
+		List<int> list;
+		for (int i = 0; i < count; i++)
+		{
+			list.Add(i);
+		}
+		sum += list.Length;
+	}
+	float listAddTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	{
+		std::vector<int> vector;
+		for (int i = 0; i < count; i++)
+		{
+			vector.push_back(i);
+		}
+		sum += vector.size();
+	}
+	float vectorAddTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	{
+		List<int, ReallocatingAllocator<int>> list;
+		for (int i = 0; i < count; i++)
+		{
+			list.Add(i);
+		}
+		sum += list.Length;
+	}
+	float reallocatingListAddTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	// Add elements that are not trivially copyable.
+	start = gEnv->pTimer->GetAsyncTime();
+	{
+		List<Text> list;
+		for (int i = 0; i < count; i++)
+		{
+			list.Add(text);
+		}
+		sum += list.Length;
+	}
+	float listAddTextTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	{
+		std::vector<Text> vector;
+		for (int i = 0; i < count; i++)
+		{
+			vector.push_back(text);
+		}
+		sum += vector.size();
+	}
+	float vectorAddTextTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	// Insert and Erase.
+	List<int> shiftedList;
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = 0; i < shiftCount; i++)
+	{
+		shiftedList.Insert(positions[i], i);
+	}
+	float listInsertTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = shiftCount - 1; i >= 0; i--)
+	{
+		shiftedList.Erase(positions[i]);
+	}
+	float listEraseTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	std::vector<int> shiftedVector;
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = 0; i < shiftCount; i++)
+	{
+		shiftedVector.insert(shiftedVector.begin() + positions[i], i);
+	}
+	float vectorInsertTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = shiftCount - 1; i >= 0; i--)
+	{
+		shiftedVector.erase(shiftedVector.begin() + positions[i]);
+	}
+	float vectorEraseTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	// AddRange.
+	start = gEnv->pTimer->GetAsyncTime();
+	{
+		List<int> list;
+		for (int i = 0; i < count; i += LIST_RANGE_LENGTH)
+		{
+			list.AddRange(static_cast<const int *>(range), range + LIST_RANGE_LENGTH);
+		}
+		sum += list.Length;
+	}
+	float listAddRangeTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	{
+		std::vector<int> vector;
+		for (int i = 0; i < count; i += LIST_RANGE_LENGTH)
+		{
+			vector.insert(vector.end(), range, range + LIST_RANGE_LENGTH);
+		}
+		sum += vector.size();
+	}
+	float vectorAddRangeTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	// BinarySearch. Elements are even numbers, so every other search misses.
+	List<int> sortedList;
+	sortedList.ReserveExact(count);
+	int *sortedElements = sortedList.AppendUninitialized(count);
+	for (int i = 0; i < count; i++)
+	{
+		sortedElements[i] = i * 2;
+	}
+	std::vector<int> sortedVector(sortedElements, sortedElements + count);
+
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = 0; i < count; i++)
+	{
+		sum += sortedList.BinarySearch(i);
+	}
+	float listSearchTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	start = gEnv->pTimer->GetAsyncTime();
+	for (int i = 0; i < count; i++)
+	{
+		sum += std::lower_bound(sortedVector.begin(), sortedVector.end(), i) - sortedVector.begin();
+	}
+	float vectorSearchTime = (gEnv->pTimer->GetAsyncTime() - start).GetMilliSeconds();
+
+	CryLogAlways("Times per element in nanoseconds with %d elements (%d for Insert and Erase):", count, shiftCount);
+	CryLogAlways("%-16s | %12s %12s", "Operation", "List", "std::vector");
+	CryLogAlways("%-16s | %12.1f %12.1f", "Add", listAddTime * nanosecondsPerElement,
+				 vectorAddTime * nanosecondsPerElement);
+	CryLogAlways("%-16s | %12.1f %12s", "Add (realloc)", reallocatingListAddTime * nanosecondsPerElement, "-");
+	CryLogAlways("%-16s | %12.1f %12.1f", "Add (Text)", listAddTextTime * nanosecondsPerElement,
+				 vectorAddTextTime * nanosecondsPerElement);
+	CryLogAlways("%-16s | %12.1f %12.1f", "Insert", listInsertTime * nanosecondsPerShift,
+				 vectorInsertTime * nanosecondsPerShift);
+	CryLogAlways("%-16s | %12.1f %12.1f", "Erase", listEraseTime * nanosecondsPerShift,
+				 vectorEraseTime * nanosecondsPerShift);
+	CryLogAlways("%-16s | %12.1f %12.1f", "AddRange", listAddRangeTime * nanosecondsPerElement,
+				 vectorAddRangeTime * nanosecondsPerElement);
+	CryLogAlways("%-16s | %12.1f %12.1f", "BinarySearch", listSearchTime * nanosecondsPerElement,
+				 vectorSearchTime * nanosecondsPerElement);
+	CryLogAlways("Checksum: %lld", sum);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "IMonoInterface.h"
+
+//! Provides console commands that measure performance of collections.
+struct CollectionBenchmark
+{
+	//! Registers console commands.
+	static void Initialize();
+	//! Unregisters console commands.
+	static void Shutdown();
+	//! Compares the time it takes to fill SortedList`4 and HashMap`4 and to look up keys in them.
+	static void HashMaps(IConsoleCmdArgs *args);
+	//! Compares the time it takes to perform common operations on List`3 and std::vector.
+	static void Lists(IConsoleCmdArgs *args);
+};
@@ -1,5 +1,6 @@
 #include "stdafx.h"
 #include "EventBroadcaster.h"
+#include "StartupProfiler.h"
 
 #if 0
   #define EventMessage CryLogAlways
@@ -33,37 +34,48 @@ void EventBroadcaster::SetInterface(IMonoInterface *inter)
 //! Broadcasts PreInitialization event.
 void EventBroadcaster::OnPreInitialization()
 {
-	this->SendSimpleEvent(&IMonoSystemListener::OnPreInitialization);
+	this->SendSimpleEvent(&IMonoSystemListener::OnPreInitialization, "PreInitialization");
 }
 //! Broadcasts RunTimeInitializing event.
 void EventBroadcaster::OnRunTimeInitializing()
 {
-	this->SendSimpleEvent(&IMonoSystemListener::OnRunTimeInitializing);
+	this->SendSimpleEvent(&IMonoSystemListener::OnRunTimeInitializing, "RunTimeInitializing");
 }
 //! Broadcasts RunTimeInitialized event.
 void EventBroadcaster::OnRunTimeInitialized()
 {
-	this->SendSimpleEvent(&IMonoSystemListener::OnRunTimeInitialized);
+	this->interopScheduler.Start();
+
+	this->SendSimpleEvent(&IMonoSystemListener::OnRunTimeInitialized, "RunTimeInitialized");
+
+	// Internal calls must be registered before any managed code that might use them is invoked.
+	StartupProfiler::Begin("Events", "Waiting for interops");
+	this->interopScheduler.Complete();
+	StartupProfiler::End();
 }
 //! Broadcasts CryamblyInitilizing event.
 void EventBroadcaster::OnCryamblyInitilizing()
 {
-	this->SendSimpleEvent(&IMonoSystemListener::OnCryamblyInitilizing);
+	this->SendSimpleEvent(&IMonoSystemListener::OnCryamblyInitilizing, "CryamblyInitilizing");
 }
 //! Broadcasts CompilationStarting event.
 void EventBroadcaster::OnCompilationStarting()
 {
-	this->SendSimpleEvent(&IMonoSystemListener::OnCompilationStarting);
+	this->SendSimpleEvent(&IMonoSystemListener::OnCompilationStarting, "CompilationStarting");
 }
 //! Broadcasts CompilationComplete event.
 void EventBroadcaster::OnCompilationComplete(bool success)
 {
+	StartupProfiler::Begin("Events", "CompilationComplete");
+
 	for (auto currentListener : this->listeners)
 	{
 		currentListener->OnCompilationComplete(success);
 	}
 
 	this->ClearRemovedListeners();
+
+	StartupProfiler::End();
 }
 //! Gathers initialization stages data for sending it to managed code.
 int *EventBroadcaster::GetSubscribedStagesInfo(int &stageCount)
@@ -107,6 +119,10 @@ void EventBroadcaster::OnInitializationStage(int stageIndex)
 {
 	CryLogAlways("Commencing initialization stage #%d", stageIndex);
 
+	char phaseName[32];
+	sprintf_s(phaseName, "InitializationStage #%d", stageIndex);
+	StartupProfiler::Begin("Events", phaseName);
+
 	List<IMonoSystemListener *> stageList;
 	if (this->stageMap.TryGet(stageIndex, stageList))
 	{
@@ -117,16 +133,18 @@ void EventBroadcaster::OnInitializationStage(int stageIndex)
 	}
 
 	this->ClearRemovedListeners();
+
+	StartupProfiler::End();
 }
 //! Broadcasts CryamblyInitilized event.
 void EventBroadcaster::OnCryamblyInitilized()
 {
-	this->SendSimpleEvent(&IMonoSystemListener::OnCryamblyInitilized);
+	this->SendSimpleEvent(&IMonoSystemListener::OnCryamblyInitilized, "CryamblyInitilized");
 }
 //! Broadcasts PostInitialization event.
 void EventBroadcaster::OnPostInitialization()
 {
-	this->SendSimpleEvent(&IMonoSystemListener::OnPostInitialization);
+	this->SendSimpleEvent(&IMonoSystemListener::OnPostInitialization, "PostInitialization");
 }
 //! Broadcasts Update event.
 void EventBroadcaster::Update()
@@ -141,17 +159,19 @@ void EventBroadcaster::PostUpdate()
 //! Broadcasts Shutdown event.
 void EventBroadcaster::Shutdown()
 {
-	this->SendSimpleEvent(&IMonoSystemListener::Shutdown);
+	this->SendSimpleEvent(&IMonoSystemListener::Shutdown, "Shutdown");
 }
 
 #if 1
 #define DebugSimpleEvents
 #endif
 
-void EventBroadcaster::SendSimpleEvent(SimpleEventHandler handler)
+void EventBroadcaster::SendSimpleEvent(SimpleEventHandler handler, const char *eventName)
 {
 	EventMessage("Broadcasting the event.");
 
+	StartupProfiler::Begin("Events", eventName);
+
 	const int printEvery = 1;
 	size_t current = 0;
 
@@ -177,6 +197,8 @@ void EventBroadcaster::SendSimpleEvent(SimpleEventHandler handler)
 	}
 
 	this->ClearRemovedListeners();
+
+	StartupProfiler::End();
 }
 
 void EventBroadcaster::SendUpdateEvent(SimpleEventHandler handler)
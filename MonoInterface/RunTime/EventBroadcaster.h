@@ -2,6 +2,7 @@
 
 #include "IMonoInterface.h"
 #include "SortedList.h"
+#include "InteropScheduler.h"
 
 //! Represents a signature of most member functions in IMonoSystemListener struct.
 typedef void (IMonoSystemListener::*SimpleEventHandler)();
@@ -12,6 +13,7 @@ struct EventBroadcaster
 	List<IMonoSystemListener *>                   listeners;
 	SortedList<int, List<IMonoSystemListener *> > stageMap;
 	List<IMonoSystemListener *>                   listenersToRemove;
+	InteropScheduler                              interopScheduler;
 
 	//! Initializes event broadcaster.
 	EventBroadcaster();
@@ -51,7 +53,7 @@ struct EventBroadcaster
 	private:
 
 	// Used for propagating events that don't have any extra data.
-	void SendSimpleEvent(SimpleEventHandler handler);
+	void SendSimpleEvent(SimpleEventHandler handler, const char *eventName);
 	// Used for propagating events Update and PostUpdate. This function is the same as SendSimpleEvent
 	// but it doesn't have as much debug code.
 	void SendUpdateEvent(SimpleEventHandler handler);
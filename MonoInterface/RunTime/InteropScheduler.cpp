@@ -0,0 +1,158 @@
+#include "stdafx.h"
+
+#include "InteropScheduler.h"
+#include "StartupProfiler.h"
+
+// Registration of internal calls is serialized by Mono, so more threads than that only wait on each other.
+#define MAX_INTEROP_WORKERS 4
+
+InteropScheduler::InteropScheduler()
+	: jobs(150)
+	, nextJob(0)
+	, closed(true)
+{}
+
+InteropScheduler::~InteropScheduler()
+{
+	this->Complete();
+}
+
+void InteropScheduler::Start()
+{
+	if (!this->threads.empty())
+	{
+		return;
+	}
+
+	unsigned int processorCount = std::thread::hardware_concurrency();
+	int threadCount = processorCount > 1 ? int(processorCount) - 1 : 1;
+	if (threadCount > MAX_INTEROP_WORKERS)
+	{
+		threadCount = MAX_INTEROP_WORKERS;
+	}
+
+	this->closed  = false;
+	this->nextJob = 0;
+	this->jobs.Clear();
+
+	MonoDomain *domain = mono_domain_get();
+	for (int i = 0; i < threadCount; i++)
+	{
+		this->threads.push_back(std::thread(&InteropScheduler::WorkerLoop, this, domain));
+	}
+}
+
+void InteropScheduler::Queue(IMonoInteropBase *interop)
+{
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+		if (!this->closed)
+		{
+			Job job;
+			job.Interop  = interop;
+			job.Start    = 0;
+			job.End      = 0;
+			job.ThreadId = 0;
+			this->jobs.Add(job);
+
+			this->wake.notify_one();
+			return;
+		}
+	}
+
+	interop->InitializeInterops();
+}
+
+void InteropScheduler::Complete()
+{
+	if (this->threads.empty())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+		this->closed = true;
+	}
+	this->wake.notify_all();
+
+	for (size_t i = 0; i < this->threads.size(); i++)
+	{
+		this->threads[i].join();
+	}
+
+	for (int i = 0; i < this->jobs.Length; i++)
+	{
+		const Job &job = this->jobs[i];
+		const char *nameSpace = job.Interop->GetInteropNameSpace();
+		const char *className = job.Interop->GetInteropClassName();
+
+		bool noNameSpace = nameSpace == nullptr || nameSpace[0] == '\0';
+		bool noClass     = className == nullptr || className[0] == '\0';
+
+		StartupProfiler::Record(noNameSpace ? "Interops" : nameSpace, noClass ? "Multiple types" : className,
+								job.Start, job.End, job.ThreadId);
+
+		if (noNameSpace && noClass)
+		{
+			CryLogAlways("Interops for multiple types in multiple name-spaces were initialized on a worker thread.");
+		}
+		else if (noClass)
+		{
+			CryLogAlways("Interops for multiple types in %s name-space were initialized on a worker thread.",
+						 nameSpace);
+		}
+		else if (noNameSpace)
+		{
+			CryLogAlways("Interops for type %s were initialized on a worker thread.", className);
+		}
+		else
+		{
+			CryLogAlways("Interops for type %s.%s were initialized on a worker thread.", nameSpace, className);
+		}
+	}
+
+	CryLogAlways("%d interops were initialized on %d worker threads.", this->jobs.Length,
+				 int(this->threads.size()));
+
+	this->threads.clear();
+	this->jobs.Clear();
+}
+
+void InteropScheduler::WorkerLoop(MonoDomain *domain)
+{
+	// Attached threads can use any part of Mono API, so interops don't have to care where they are initialized.
+	MonoThread *thread = mono_thread_attach(domain);
+
+	while (true)
+	{
+		int index;
+		IMonoInteropBase *interop;
+		{
+			std::unique_lock<std::mutex> guard(this->lock);
+			while (!this->closed && this->nextJob == this->jobs.Length)
+			{
+				this->wake.wait(guard);
+			}
+			if (this->nextJob == this->jobs.Length)
+			{
+				break;
+			}
+			index   = this->nextJob++;
+			interop = this->jobs[index].Interop;
+		}
+
+		unsigned __int64 start = StartupProfiler::GetTime();
+		interop->InitializeInterops();
+		unsigned __int64 end = StartupProfiler::GetTime();
+
+		// The list could have been reallocated by the main thread, so the job is found by index.
+		std::lock_guard<std::mutex> guard(this->lock);
+		Job &job = this->jobs[index];
+		job.Start    = start;
+		job.End      = end;
+		job.ThreadId = GetCurrentThreadId();
+	}
+
+	mono_thread_detach(thread);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "IMonoInterface.h"
+
+#include "MonoHeaders.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+//! Initializes interops that only register internal calls on worker threads.
+//!
+//! Such interops are queued while RunTimeInitialized event is broadcast, so worker threads go through them
+//! while the main thread initializes interops that must acquire thunks or subscribe to events in order.
+//! Results are reported by the main thread in the order the interops were queued in, so the log looks the
+//! same regardless of how the work was split between threads.
+struct InteropScheduler
+{
+private:
+	struct Job
+	{
+		IMonoInteropBase *Interop;
+		unsigned __int64  Start;		//!< Value of the performance counter when initialization has started.
+		unsigned __int64  End;			//!< Value of the performance counter when initialization has ended.
+		unsigned long     ThreadId;
+	};
+
+	std::vector<std::thread> threads;
+
+	std::mutex lock;					//!< Guards the fields below.
+	std::condition_variable wake;
+	List<Job> jobs;
+	int nextJob;
+	bool closed;
+public:
+	InteropScheduler();
+	~InteropScheduler();
+
+	//! Starts worker threads.
+	void Start();
+	//! Queues initialization of the interop, or initializes it right away, if worker threads are not running.
+	void Queue(IMonoInteropBase *interop);
+	//! Waits for all queued interops to be initialized, stops worker threads and reports the results.
+	void Complete();
+private:
+	void WorkerLoop(MonoDomain *domain);
+};
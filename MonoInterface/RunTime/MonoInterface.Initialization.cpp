@@ -3,6 +3,8 @@
 #include "Implementation/Cryambly.h"
 #include "Implementation/MonoCoreLibrary.h"
 #include "Implementation/MonoAssemblies.h"
+#include "Implementation/MonoAotCache.h"
+#include "RunTime/CollectionBenchmark.h"
 
 #if 1
   #define InitializationMessage CryLogAlways
@@ -32,6 +34,8 @@ MonoInterface::MonoInterface(IGameFramework *framework, List<IMonoSystemListener
 {
 	_this = this;
 
+	StartupProfiler::Begin("Start-up", "CryCIL");
+
 	this->running = false;
 
 	this->cryambly   = nullptr;
@@ -71,11 +75,15 @@ MonoInterface::MonoInterface(IGameFramework *framework, List<IMonoSystemListener
 	InitializationMessage("Setting mono directories.");
 
 	// Tell Mono, where to look for the libraries and configuration files.
+	StartupProfiler::Begin("Mono", "mono_set_dirs");
 	const char *assembly_dir = DirectoryStructure::GetMonoLibraryFolder();
 	const char *config_dir   = DirectoryStructure::GetMonoConfigurationFolder();
 	mono_set_dirs(assembly_dir, config_dir);
+	StartupProfiler::End();
 
+	StartupProfiler::Begin("Mono", "Debugging");
 	InitializeDebugEnvironment();
+	StartupProfiler::End();
 
 	InitializationMessage("Registering HandeSignalAbort.");
 
@@ -84,10 +92,14 @@ MonoInterface::MonoInterface(IGameFramework *framework, List<IMonoSystemListener
 
 	this->RegisterHooks(logLevel);
 
+	MonoAotCache::Initialize();
+
 	InitializationMessage("Initializing the domain.");
 
 	// Initialize the AppDomain.
+	StartupProfiler::Begin("Mono", "mono_jit_init_version");
 	this->appDomain = mono_jit_init_version("CryCIL", "v4.0.30319");
+	StartupProfiler::End();
 	if (!this->appDomain)
 	{
 		CryFatalError("Unable to initialize Mono AppDomain.");
@@ -106,6 +118,16 @@ MonoInterface::MonoInterface(IGameFramework *framework, List<IMonoSystemListener
 	this->gc   = new MonoGC();
 	this->objs = new MonoObjects();
 
+	gEnv->pConsole->AddCommand("cil_ClassMemoryReport", MonoClassCache::ReportMemoryUsage, VF_NULL,
+							   "Prints number of cached members and memory usage of every wrapped Mono class.");
+	gEnv->pConsole->AddCommand("cil_AssemblyLoadReport", MonoAssemblies::ReportLoading, VF_NULL,
+							   "Prints the number of bytes that were mapped and copied and the time it took to load "
+							   "every assembly that was found by the search hook.");
+	gEnv->pConsole->AddCommand("cil_InvocationBenchmark", MonoFunctions::Benchmark, VF_NULL,
+							   "Compares the time it takes to invoke managed methods through Invoke, unmanaged thunks "
+							   "and Call functions. Accepts the number of invocations, 1000000 by default.");
+	CollectionBenchmark::Initialize();
+
 	InitializationMessage("Loading Cryambly.");
 
 	// Load Cryambly.
@@ -113,15 +135,21 @@ MonoInterface::MonoInterface(IGameFramework *framework, List<IMonoSystemListener
 
 	InitializationMessage("Creating a Cryambly object.");
 
+	StartupProfiler::Begin("Assemblies", "Cryambly");
 	this->cryambly = new CryamblyWrapper(cryamblyFile);
+	StartupProfiler::End();
 
 	InitializationMessage("Creating a CoreLibrary object.");
 
+	StartupProfiler::Begin("Assemblies", "MonoCoreLibrary");
 	this->corlib = new MonoCoreLibrary();
+	StartupProfiler::End();
 
 	InitializationMessage("Initializing main thunks.");
 
+	StartupProfiler::Begin("Thunks", "Main thunks");
 	this->InitializeThunks();
+	StartupProfiler::End();
 
 	InitializationMessage("Main thunks initialized.");
 
@@ -137,24 +165,30 @@ MonoInterface::MonoInterface(IGameFramework *framework, List<IMonoSystemListener
 	LogPostingInterop();
 
 	// Initiate testing.
+	StartupProfiler::Begin("Managed", "TestLauncher.StartTesting");
 	this->funcs->AddInternalCall(ns, "TestLauncher", "Test", TestFramework);
 	const IMonoClass    *testLauncher = this->cryambly->GetClass(ns, "TestLauncher");
 	const IMonoFunction *testFunc     = testLauncher->GetFunction("StartTesting");
 	void                *testThunk    = testFunc->RawThunk;
 	static_cast<void (*)()>(testThunk)();
+	StartupProfiler::End();
 
 	this->broadcaster->OnRunTimeInitialized();
 
 	// Initialize the folder paths.
+	StartupProfiler::Begin("Managed", "DirectoryStructure.InitializeFolderPaths");
 	void *thunk = this->Cryambly->GetClass(ns, "DirectoryStructure")->GetFunction("InitializeFolderPaths", -1)->RawThunk;
 	mono::string ef = ToMonoString(this->executablePath);
 	mono::string pf = ToMonoString(this->projectPath);
 	mono::string cf = ToMonoString(gEnv->pCryPak->GetGameFolder());
 	static_cast<void(*)(mono::string, mono::string, mono::string)>(thunk)(ef, pf, cf);
+	StartupProfiler::End();
 
 	// Initialize an instance of type MonoInterface.
+	StartupProfiler::Begin("Managed", "MonoInterface.Initialize");
 	mono::exception ex;
 	MonoInterfaceThunks::Initialize(&ex);
+	StartupProfiler::End();
 	if (ex)
 	{
 		mono::exception eX;
@@ -167,6 +201,12 @@ MonoInterface::MonoInterface(IGameFramework *framework, List<IMonoSystemListener
 
 	this->broadcaster->OnPostInitialization();
 
+	// Assemblies that were loaded without compiled images are compiled for the next start-up.
+	MonoAotCache::CompilePendingImages();
+
+	StartupProfiler::End();
+	StartupProfiler::Finish();
+
 	// Uncomment next 2 lines, if there is a need to crash the game when debugging initialization.
 
 	//  int *crash = nullptr;
@@ -1,6 +1,8 @@
 #include "stdafx.h"
 #include "MonoInterface.h"
 #include "RunTime/AllInterops.h"
+#include "Implementation/MonoAotCache.h"
+#include "RunTime/CollectionBenchmark.h"
 
 #if 1
 #define InterfaceMessage CryLogAlways
@@ -65,10 +67,18 @@ void MonoInterface::Shutdown()
 	this->framework->UnregisterListener(this);
 	gEnv->pSystem->GetISystemEventDispatcher()->RemoveListener(this);
 	
+	MonoAotCache::Shutdown();
+	
+	StartupProfiler::Write(DirectoryStructure::GetStartupTraceFile());
+	
 	delete this->assemblies;
 	delete this->gc;
 	delete this->objs;
 	delete this->funcs;
+	CollectionBenchmark::Shutdown();
+	gEnv->pConsole->RemoveCommand("cil_InvocationBenchmark");
+	gEnv->pConsole->RemoveCommand("cil_AssemblyLoadReport");
+	gEnv->pConsole->RemoveCommand("cil_ClassMemoryReport");
 	MonoClassCache::Dispose();
 	
 	CryLogAlways("Shutting down jit.");
@@ -114,6 +124,32 @@ void MonoInterface::RemoveListener(IMonoSystemListener *listener)
 	}
 }
 #pragma endregion
+#pragma region Start-up Profiling
+//! Opens a new phase of CryCIL start-up.
+void MonoInterface::BeginStartupPhase(const char *category, const char *name)
+{
+	StartupProfiler::Begin(category, name);
+}
+//! Closes the last phase of CryCIL start-up that was opened.
+void MonoInterface::EndStartupPhase()
+{
+	StartupProfiler::End();
+}
+#pragma endregion
+#pragma region Interops
+//! Queues initialization of the interop that only registers internal calls.
+void MonoInterface::QueueInteropInitialization(IMonoInteropBase *interop)
+{
+	if (this->broadcaster)
+	{
+		this->broadcaster->interopScheduler.Queue(interop);
+	}
+	else
+	{
+		interop->InitializeInterops();
+	}
+}
+#pragma endregion
 #pragma region IGameFrameworkListener Implementation.
 //! Triggers Update event in MonoInterface object in Cryambly.
 void MonoInterface::OnPostUpdate(float)
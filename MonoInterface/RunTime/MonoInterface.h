@@ -14,6 +14,7 @@
 
 #include "RunTime/DebugEventReporter.h"
 #include "RunTime/EventBroadcaster.h"
+#include "RunTime/StartupProfiler.h"
 
 #include "List.hpp"
 
@@ -73,6 +74,16 @@ public:
 	//! Unregisters an object that receives notifications about CryCIL events.
 	void RemoveListener(IMonoSystemListener *listener) override;
 	#pragma endregion
+	#pragma region Start-up Profiling
+	//! Opens a new phase of CryCIL start-up.
+	void BeginStartupPhase(const char *category, const char *name) override;
+	//! Closes the last phase of CryCIL start-up that was opened.
+	void EndStartupPhase() override;
+	#pragma endregion
+	#pragma region Interops
+	//! Queues initialization of the interop that only registers internal calls.
+	void QueueInteropInitialization(IMonoInteropBase *interop) override;
+	#pragma endregion
 	#pragma region IGameFrameworkListener Implementation.
 	//! Triggers Update event in MonoInterface object in Cryambly.
 	void OnPostUpdate(float fDeltaTime) override;
@@ -0,0 +1,152 @@
+#include "stdafx.h"
+
+#include "StartupProfiler.h"
+
+#include <fstream>
+
+bool StartupProfiler::recording = true;
+List<StartupProfiler::Phase> StartupProfiler::phases(100);
+List<int> StartupProfiler::openPhases(10);
+
+void StartupProfiler::Begin(const char *category, const char *name)
+{
+	if (!recording)
+	{
+		return;
+	}
+
+	Phase phase;
+	phase.Category = category ? category : "";
+	phase.Name     = name ? name : "";
+	phase.Start    = GetTime();
+	phase.End      = phase.Start;
+	phase.ThreadId = GetCurrentThreadId();
+
+	openPhases.Add(phases.Length);
+	phases.Add(phase);
+}
+
+void StartupProfiler::End()
+{
+	if (!recording || openPhases.Empty)
+	{
+		return;
+	}
+
+	phases[openPhases[openPhases.Length - 1]].End = GetTime();
+	openPhases.Cut();
+}
+
+void StartupProfiler::Record(const char *category, const char *name, unsigned __int64 start, unsigned __int64 end,
+							 unsigned long threadId)
+{
+	if (!recording)
+	{
+		return;
+	}
+
+	Phase phase;
+	phase.Category = category ? category : "";
+	phase.Name     = name ? name : "";
+	phase.Start    = start;
+	phase.End      = end;
+	phase.ThreadId = threadId;
+
+	phases.Add(phase);
+}
+
+void StartupProfiler::Finish()
+{
+	if (!recording)
+	{
+		return;
+	}
+
+	// Close the phases that were left open, so they are not lost.
+	while (!openPhases.Empty)
+	{
+		End();
+	}
+	recording = false;
+
+	if (phases.Empty)
+	{
+		return;
+	}
+
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+
+	// The first phase encloses the others, unless the phases were recorded without one.
+	unsigned __int64 end = phases[0].End;
+	for (int i = 1; i < phases.Length; i++)
+	{
+		if (phases[i].End > end)
+		{
+			end = phases[i].End;
+		}
+	}
+
+	CryLogAlways("CryCIL start-up took %.1f ms, %d phases were recorded.",
+				 double(end - phases[0].Start) * 1000.0 / double(frequency.QuadPart), phases.Length);
+}
+
+void StartupProfiler::Write(const char *file)
+{
+	if (phases.Empty)
+	{
+		return;
+	}
+
+	std::ofstream stream(file);
+	if (!stream)
+	{
+		CryLogAlways("Unable to write start-up trace to %s.", file);
+		return;
+	}
+
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	double microsecondsPerTick = 1000000.0 / double(frequency.QuadPart);
+	unsigned __int64 origin = phases[0].Start;
+
+	stream.setf(std::ios::fixed);
+	stream.precision(3);
+
+	// Complete events ("ph":"X") are used, since they carry the duration, and viewers nest them by time.
+	stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	for (int i = 0; i < phases.Length; i++)
+	{
+		const Phase &phase = phases[i];
+
+		stream << (i == 0 ? "\n" : ",\n") << "{\"name\":\"";
+		WriteEscaped(stream, phase.Name);
+		stream << "\",\"cat\":\"";
+		WriteEscaped(stream, phase.Category);
+		stream << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << phase.ThreadId
+			   << ",\"ts\":" << double(phase.Start - origin) * microsecondsPerTick
+			   << ",\"dur\":" << double(phase.End - phase.Start) * microsecondsPerTick << "}";
+	}
+	stream << "\n]}\n";
+
+	CryLogAlways("Start-up trace was written to %s.", file);
+}
+
+unsigned __int64 StartupProfiler::GetTime()
+{
+	LARGE_INTEGER time;
+	QueryPerformanceCounter(&time);
+	return static_cast<unsigned __int64>(time.QuadPart);
+}
+
+void StartupProfiler::WriteEscaped(std::ostream &stream, const char *text)
+{
+	for (; *text; text++)
+	{
+		if (*text == '"' || *text == '\\')
+		{
+			stream << '\\';
+		}
+		stream << *text;
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "IMonoInterface.h"
+
+#include <iosfwd>
+
+//! Records the time it takes to go through every phase of CryCIL start-up.
+//!
+//! Phases are opened and closed in pairs and can be nested. Recording stops when initialization is
+//! complete, and the recorded phases can be written into a file in Chrome trace format, which can be
+//! opened on chrome://tracing page or in any other trace viewer that supports it.
+//!
+//! All functions must be called from the main thread. Work that is done on other threads is timed there
+//! and recorded by the main thread afterwards.
+struct StartupProfiler
+{
+private:
+	struct Phase
+	{
+		Text             Category;
+		Text             Name;
+		unsigned __int64 Start;		//!< Value of the performance counter when the phase was opened.
+		unsigned __int64 End;		//!< Value of the performance counter when the phase was closed.
+		unsigned long    ThreadId;
+	};
+
+	static bool recording;
+	static List<Phase> phases;
+	static List<int> openPhases;	//!< Indexes of phases that were opened but not closed yet.
+public:
+	//! Opens a new phase that is nested within the last one that is still open.
+	//!
+	//! @param category Name of the group the phase belongs to.
+	//! @param name     Name of the phase.
+	static void Begin(const char *category, const char *name);
+	//! Closes the last phase that was opened.
+	static void End();
+	//! Records the phase that was timed on another thread.
+	//!
+	//! @param category Name of the group the phase belongs to.
+	//! @param name     Name of the phase.
+	//! @param start    Value of the performance counter when the phase has started.
+	//! @param end      Value of the performance counter when the phase has ended.
+	//! @param threadId Identifier of the thread the phase was on.
+	static void Record(const char *category, const char *name, unsigned __int64 start, unsigned __int64 end,
+					   unsigned long threadId);
+	//! Stops recording and prints the total duration of start-up into the log.
+	static void Finish();
+	//! Writes all recorded phases into the file in Chrome trace format.
+	static void Write(const char *file);
+	//! Gets current value of the performance counter.
+	static unsigned __int64 GetTime();
+private:
+	static void WriteEscaped(std::ostream &stream, const char *text);
+};
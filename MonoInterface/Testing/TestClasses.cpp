@@ -711,6 +711,7 @@ void TestInstanceMethodInvocation();
 void TestVirtualMethodInvocation();
 void TestStaticThunkInvocation();
 void TestInstanceThunkInvocation();
+void TestTypedInvocation();
 
 inline void PrintDigitsArray(mono::Array digits)
 {
@@ -745,6 +746,8 @@ inline void TestInvokingMethods()
 	TestStaticThunkInvocation();
 
 	TestInstanceThunkInvocation();
+
+	TestTypedInvocation();
 }
 
 inline void TestStaticMethodInvocation()
@@ -969,6 +972,58 @@ inline void TestInstanceThunkInvocation()
 	}
 	CryLogAlways("TEST:");
 }
+
+inline void TestTypedInvocation()
+{
+	CryLogAlways("TEST:");
+	CryLogAlways("TEST: Invoking methods through Call functions.");
+	CryLogAlways("TEST:");
+	CryLogAlways("TEST: Getting the method wrapper of System.Math.Max(System.Int32,System.Int32).");
+	CryLogAlways("TEST:");
+
+	const IMonoStaticMethod *maxMethod = MonoEnv->CoreLibrary->GetClass("System", "Math")
+		->GetFunction("Max", "System.Int32,System.Int32")->ToStatic();
+
+	CryLogAlways("TEST: Invoking the static method.");
+	CryLogAlways("TEST:");
+
+	mono::exception ex;
+	int max = maxMethod->Call<int>(&ex, 3, 7);
+
+	if (!ex && max == 7)
+	{
+		CryLogAlways("TEST SUCCESS: Result of invocation = %d", max);
+	}
+	else
+	{
+		ReportError("TEST FAILURE: Result of invocation = %d, expected 7.", max);
+	}
+
+	CryLogAlways("TEST:");
+	CryLogAlways("TEST: Getting the method wrapper of System.Object.GetHashCode().");
+	CryLogAlways("TEST:");
+
+	const IMonoMethod *getHashCodeMethod = MonoEnv->CoreLibrary->Object->GetFunction("GetHashCode", 0)->ToInstance();
+
+	mono::string text = ToMonoString("Some text for testing.");
+	MonoGCHandle handle = MonoEnv->GC->Pin(text);
+
+	CryLogAlways("TEST: Invoking the virtual method on a string.");
+	CryLogAlways("TEST:");
+
+	int expectedHash = Unbox<int>(getHashCodeMethod->Invoke(text, nullptr, true));
+	int hash = getHashCodeMethod->CallVirtual<int>(text, &ex);
+
+	if (!ex && hash == expectedHash)
+	{
+		CryLogAlways("TEST SUCCESS: Hash code of the string = %d", hash);
+	}
+	else
+	{
+		ReportError("TEST FAILURE: Hash code of the string = %d, expected %d.", hash, expectedHash);
+	}
+	CryLogAlways("TEST:");
+}
 #pragma endregion
 
 #pragma region Field Tests
@@ -0,0 +1,136 @@
+#include "stdafx.h"
+#include "TestStart.h"
+
+#include <thread>
+
+#define CONCURRENCY_TEST_THREAD_COUNT 8
+#define CONCURRENCY_TEST_ITERATIONS 100000
+
+void TestSharedTextCopies();
+void TestSharedListCopies();
+
+void TestConcurrency()
+{
+	CryLogAlways("TEST:");
+	CryLogAlways("TEST: Testing thread-safe reference counting.");
+	CryLogAlways("TEST:");
+
+	TestSharedTextCopies();
+
+	TestSharedListCopies();
+}
+
+void CopySharedText(const SharedText *text)
+{
+	for (int i = 0; i < CONCURRENCY_TEST_ITERATIONS; i++)
+	{
+		SharedText copy(*text);
+		if (i % 64 == 0)
+		{
+			// Modification makes the copy unique, so memory gets allocated and released by this thread.
+			copy.Append("!");
+		}
+	}
+}
+
+inline void TestSharedTextCopies()
+{
+	CryLogAlways("TEST: Copying the same text on %d threads.", CONCURRENCY_TEST_THREAD_COUNT);
+	CryLogAlways("TEST:");
+
+	size_t memoryBefore = MemoryTracker<SharedText>::AllocatedMemory();
+	{
+		SharedText text("Text that is shared between the threads.");
+
+		std::thread threads[CONCURRENCY_TEST_THREAD_COUNT];
+		for (int i = 0; i < CONCURRENCY_TEST_THREAD_COUNT; i++)
+		{
+			threads[i] = std::thread(CopySharedText, &text);
+		}
+		for (int i = 0; i < CONCURRENCY_TEST_THREAD_COUNT; i++)
+		{
+			threads[i].join();
+		}
+	}
+	size_t memoryAfter = MemoryTracker<SharedText>::AllocatedMemory();
+
+	if (memoryBefore == memoryAfter)
+	{
+		CryLogAlways("TEST SUCCESS: All text data was released.");
+	}
+	else
+	{
+		ReportError("TEST FAILURE: %d bytes of text data were leaked.", int(memoryAfter - memoryBefore));
+	}
+	CryLogAlways("TEST:");
+}
+
+//! An object that counts its live instances.
+struct CountedObject
+{
+	static std::atomic<int> LiveObjects;
+
+	CountedObject()
+	{
+		LiveObjects++;
+	}
+	CountedObject(const CountedObject &)
+	{
+		LiveObjects++;
+	}
+	~CountedObject()
+	{
+		LiveObjects--;
+	}
+};
+
+std::atomic<int> CountedObject::LiveObjects(0);
+
+void CopySharedList(const SharedList<CountedObject> *list)
+{
+	for (int i = 0; i < CONCURRENCY_TEST_ITERATIONS; i++)
+	{
+		SharedList<CountedObject> copy(*list);
+	}
+}
+
+inline void TestSharedListCopies()
+{
+	CryLogAlways("TEST: Copying the same list on %d threads.", CONCURRENCY_TEST_THREAD_COUNT);
+	CryLogAlways("TEST:");
+
+	bool destroyedEarly;
+	{
+		SharedList<CountedObject> list(10);
+		for (int i = 0; i < 10; i++)
+		{
+			list.Add(CountedObject());
+		}
+
+		std::thread threads[CONCURRENCY_TEST_THREAD_COUNT];
+		for (int i = 0; i < CONCURRENCY_TEST_THREAD_COUNT; i++)
+		{
+			threads[i] = std::thread(CopySharedList, &list);
+		}
+		for (int i = 0; i < CONCURRENCY_TEST_THREAD_COUNT; i++)
+		{
+			threads[i].join();
+		}
+
+		destroyedEarly = CountedObject::LiveObjects != 10;
+	}
+
+	if (destroyedEarly)
+	{
+		ReportError("TEST FAILURE: The elements were destroyed while the list was still alive.");
+	}
+	else if (CountedObject::LiveObjects != 0)
+	{
+		ReportError("TEST FAILURE: %d elements were leaked.", int(CountedObject::LiveObjects));
+	}
+	else
+	{
+		CryLogAlways("TEST SUCCESS: All elements were released once.");
+	}
+	CryLogAlways("TEST:");
+}
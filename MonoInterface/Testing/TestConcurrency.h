@@ -0,0 +1,3 @@
+#pragma once
+
+extern void TestConcurrency();
\ No newline at end of file
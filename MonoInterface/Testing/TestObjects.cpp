@@ -603,6 +603,46 @@ inline void TestStrings()
 	CryLogAlways("TEST:");
 	CryLogAlways("TEST: The interned string is: %s.", NtText(text.NativeUTF8).c_str());
 	CryLogAlways("TEST:");
+	CryLogAlways("TEST: Testing conversion of strings into scratch memory.");
+	CryLogAlways("TEST:");
+
+	{
+		ScratchText first(ToMonoString(L"Scratch text \x00e9\x4e2d\xd83d\xde00 with non-ASCII symbols."));
+		ScratchText second(ToMonoString("Another scratch text that is long enough to be copied in blocks."));
+
+		if (strcmp(first, "Scratch text \xc3\xa9\xe4\xb8\xad\xf0\x9f\x98\x80 with non-ASCII symbols.") == 0 &&
+			strcmp(second, "Another scratch text that is long enough to be copied in blocks.") == 0)
+		{
+			CryLogAlways("TEST SUCCESS: Strings were properly converted into scratch memory.");
+		}
+		else
+		{
+			ReportError("TEST FAILURE: Strings were not properly converted into scratch memory.");
+		}
+	}
+
+	CryLogAlways("TEST:");
+	CryLogAlways("TEST: Testing the cache of managed strings.");
+	CryLogAlways("TEST:");
+
+	{
+		char name[] = "CachedName";
+		mono::string first = ToMonoStringCached(name);
+		mono::string second = ToMonoStringCached("CachedName");
+		name[0] = 'U';
+		mono::string third = ToMonoStringCached(name);
+
+		if (first == second && first != third && strcmp(ScratchText(third), "UachedName") == 0)
+		{
+			CryLogAlways("TEST SUCCESS: Managed strings were properly reused by the cache.");
+		}
+		else
+		{
+			ReportError("TEST FAILURE: Managed strings were not properly reused by the cache.");
+		}
+	}
+
+	CryLogAlways("TEST:");
 }
 
 inline const char *ToOrdinal(int number)
@@ -6,6 +6,7 @@ const IMonoAssembly *mainTestingAssembly;
 #include "TestAssemblies.h"
 #include "TestClasses.h"
 #include "TestObjects.h"
+#include "TestConcurrency.h"
 
 void BeginTheTest()
 {
@@ -16,4 +17,6 @@ void BeginTheTest()
 	TestClasses();
 
 	TestObjects();
+
+	TestConcurrency();
 }
\ No newline at end of file
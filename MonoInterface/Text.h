@@ -72,11 +72,19 @@ typedef void *mono_string;
 //! When a new object of this type is created, it allocates enough memory to hold: header object with
 //! information about the text data, like reference count and length, and null-terminated string of characters
 //! itself.
-template<typename symbol>
+//!
+//! Copies of the same text share the data until one of them is modified. Text counts the copies with a plain
+//! integer, so copies of the same text must not be made or destroyed by different threads at the same time;
+//! SharedText uses an atomic counter and can be handed over to other threads without making deep copies.
+//!
+//! @tparam symbol             Type of characters.
+//! @tparam ReferenceCountType Type of object that counts the copies that share the text data.
+template<typename symbol, typename ReferenceCountType>
 struct TextTemplate
 {
+	template<typename> friend class TextBuilderTemplate;
 protected:
-	typedef NullTerminatedArrayHeader<symbol> TextHeader;
+	typedef RefCountedImmutableArrayHeaderTemplate<symbol, ReferenceCountType, size_t, true> TextHeader;
 	typedef MemoryTracker<TextTemplate> TextMemoryTracker;
 	#pragma region Fields
 	symbol *str;
@@ -674,8 +682,8 @@ private:
 	#pragma endregion
 };
 
-template<typename symbol>
-inline mono_string TextTemplate<symbol>::_mono_str(const symbol *str)
+template<typename symbol, typename ReferenceCountType>
+inline mono_string TextTemplate<symbol, ReferenceCountType>::_mono_str(const symbol *str)
 {
 #ifdef MONO_API
 	return mono_string_new(mono_domain_get(), str);
@@ -686,8 +694,8 @@ inline mono_string TextTemplate<symbol>::_mono_str(const symbol *str)
 #endif // MONO_API
 }
 
-template<typename symbol>
-inline symbol *TextTemplate<symbol>::mono_string_native(mono_string str, void *error)
+template<typename symbol, typename ReferenceCountType>
+inline symbol *TextTemplate<symbol, ReferenceCountType>::mono_string_native(mono_string str, void *error)
 {
 	if (!str)
 	{
@@ -702,20 +710,20 @@ inline symbol *TextTemplate<symbol>::mono_string_native(mono_string str, void *e
 #endif // MONO_API
 }
 
-template<typename symbol>
-inline int TextTemplate<symbol>::_compare(const symbol *str1, const symbol *str2)
+template<typename symbol, typename ReferenceCountType>
+inline int TextTemplate<symbol, ReferenceCountType>::_compare(const symbol *str1, const symbol *str2)
 {
 	return strcmp(str1, str2);
 }
 
-template<typename symbol>
-inline size_t TextTemplate<symbol>::_strlen(const symbol *str)
+template<typename symbol, typename ReferenceCountType>
+inline size_t TextTemplate<symbol, ReferenceCountType>::_strlen(const symbol *str)
 {
 	return strlen(str);
 }
 
-template<typename symbol>
-inline bool TextTemplate<symbol>::_contains_substring(const symbol *str0, const symbol *str1, bool ignoreCase)
+template<typename symbol, typename ReferenceCountType>
+inline bool TextTemplate<symbol, ReferenceCountType>::_contains_substring(const symbol *str0, const symbol *str1, bool ignoreCase)
 {
 	if (!ignoreCase)
 	{
@@ -734,7 +742,7 @@ inline bool TextTemplate<symbol>::_contains_substring(const symbol *str0, const
 }
 
 template<>
-inline mono_string TextTemplate<wchar_t>::_mono_str(const wchar_t *str)
+inline mono_string TextTemplate<wchar_t, int>::_mono_str(const wchar_t *str)
 {
 #ifdef MONO_API
 	return mono_string_from_utf16(reinterpret_cast<mono_unichar2 *>(const_cast<wchar_t *>(str)));
@@ -746,7 +754,7 @@ inline mono_string TextTemplate<wchar_t>::_mono_str(const wchar_t *str)
 }
 
 template<>
-inline wchar_t *TextTemplate<wchar_t>::mono_string_native(mono_string str, void *error)
+inline wchar_t *TextTemplate<wchar_t, int>::mono_string_native(mono_string str, void *error)
 {
 #ifdef MONO_API
 	// Initialize the error object with no error message in it.
@@ -760,19 +768,19 @@ inline wchar_t *TextTemplate<wchar_t>::mono_string_native(mono_string str, void
 }
 
 template<>
-inline int TextTemplate<wchar_t>::_compare(const wchar_t *str1, const wchar_t *str2)
+inline int TextTemplate<wchar_t, int>::_compare(const wchar_t *str1, const wchar_t *str2)
 {
 	return wcscmp(str1, str2);
 }
 
 template<>
-inline size_t TextTemplate<wchar_t>::_strlen(const wchar_t *str)
+inline size_t TextTemplate<wchar_t, int>::_strlen(const wchar_t *str)
 {
 	return wcslen(str);
 }
 
 template<>
-inline bool TextTemplate<wchar_t>::_contains_substring(const wchar_t *str0, const wchar_t *str1, bool ignoreCase)
+inline bool TextTemplate<wchar_t, int>::_contains_substring(const wchar_t *str0, const wchar_t *str1, bool ignoreCase)
 {
 	if (!ignoreCase)
 	{
@@ -790,15 +798,24 @@ inline bool TextTemplate<wchar_t>::_contains_substring(const wchar_t *str0, cons
 	return false;
 }
 
-typedef TextTemplate<char> Text;
-typedef TextTemplate<wchar_t> Text16;
+typedef TextTemplate<char, int> Text;
+typedef TextTemplate<wchar_t, int> Text16;
+typedef TextTemplate<char, AtomicReferenceCount<int>> SharedText;
 
 //! Allows Text to be used in SortedList as key type.
-template<typename SymbolType>
-struct DefaultComparison<TextTemplate<SymbolType>, TextTemplate<SymbolType> >
+template<typename SymbolType, typename ReferenceCountType>
+struct DefaultComparison<TextTemplate<SymbolType, ReferenceCountType>, TextTemplate<SymbolType, ReferenceCountType> >
 {
-	int operator()(const TextTemplate<SymbolType> &value1, const TextTemplate<SymbolType> &value2) const
+	int operator()(const TextTemplate<SymbolType, ReferenceCountType> &value1,
+				   const TextTemplate<SymbolType, ReferenceCountType> &value2) const
 	{
 		return value1.CompareTo(value2);
 	}
+};
+
+//! Text objects only hold a pointer to the text data, so lists can move them around with memmove.
+template<typename SymbolType, typename ReferenceCountType>
+struct IsTriviallyRelocatable<TextTemplate<SymbolType, ReferenceCountType>>
+{
+	static constexpr bool value = true;
 };
\ No newline at end of file
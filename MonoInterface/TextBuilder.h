@@ -0,0 +1,474 @@
+#pragma once
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include "Text.h"
+
+//! Represents an object that builds a text out of many pieces.
+//!
+//! Appending pieces to a text reallocates it every time its capacity is exceeded. The builder copies the pieces
+//! into a chain of memory chunks that are never moved instead, and allocates the text only once, with the
+//! exact size, when ToText() is called. Numbers and vectors are written straight into the chunks.
+//!
+//! Example:
+//!
+//! @code{.cpp}
+//!
+//! TextBuilder builder;
+//! builder << "Entity #" << id << " is at " << position << '.';
+//! Text message = builder.ToText();
+//!
+//! @endcode
+//!
+//! @tparam symbol Type of characters.
+template<typename symbol>
+class TextBuilderTemplate
+{
+	//! Represents a block of memory that contains a part of the text.
+	struct Chunk
+	{
+		Chunk  *Next;		//!< Next chunk in the chain.
+		symbol *Symbols;	//!< Pointer to the first character in this chunk.
+		size_t  Length;		//!< Number of characters in this chunk.
+		size_t  Capacity;	//!< Number of characters that can fit into this chunk.
+	};
+
+	//! Number of characters that can be appended before the first chunk is allocated on the heap.
+	static const size_t InlineCapacity = 128;
+	//! Largest number of digits after the decimal point.
+	static const int MaxDecimals = 9;
+
+	Chunk  firstChunk;
+	Chunk *lastChunk;
+	size_t length;
+	symbol inlineSymbols[InlineCapacity];
+public:
+	//! Gets the number of characters that were appended to this builder.
+	__declspec(property(get = GetLength)) size_t Length;
+	size_t GetLength() const
+	{
+		return this->length;
+	}
+	//! Indicates whether nothing was appended to this builder.
+	__declspec(property(get = IsEmpty)) bool Empty;
+	bool IsEmpty() const
+	{
+		return this->length == 0;
+	}
+
+	//! Creates an empty builder.
+	TextBuilderTemplate()
+	{
+		this->InitEmpty();
+	}
+	TextBuilderTemplate(const TextBuilderTemplate &) = delete;
+	TextBuilderTemplate &operator=(const TextBuilderTemplate &) = delete;
+	~TextBuilderTemplate()
+	{
+		this->ReleaseChunks(this->firstChunk.Next);
+	}
+
+	//! Creates a text out of all pieces that were appended to this builder.
+	//!
+	//! @tparam TextType Type of text to create, e.g. Text or SharedText.
+	template<typename TextType = TextTemplate<symbol, int>>
+	TextType ToText() const
+	{
+		TextType text;
+		if (this->length != 0)
+		{
+			text.AllocateMemory(this->length);
+
+			symbol *destination = text.str;
+			for (const Chunk *chunk = &this->firstChunk; chunk; chunk = chunk->Next)
+			{
+				memcpy(destination, chunk->Symbols, chunk->Length * sizeof(symbol));
+				destination += chunk->Length;
+			}
+		}
+		return text;
+	}
+	//! Removes everything from this builder.
+	void Clear()
+	{
+		this->ReleaseChunks(this->firstChunk.Next);
+		this->InitEmpty();
+	}
+	//! Removes specified number of characters from the end.
+	//!
+	//! @param count Number of characters to remove.
+	void Cut(size_t count = 1)
+	{
+		if (count >= this->length)
+		{
+			this->Clear();
+			return;
+		}
+
+		// Find the chunk that will contain the last character.
+		size_t newLength = this->length - count;
+		size_t offset = 0;
+		Chunk *chunk = &this->firstChunk;
+		while (offset + chunk->Length < newLength)
+		{
+			offset += chunk->Length;
+			chunk = chunk->Next;
+		}
+
+		chunk->Length = newLength - offset;
+		this->ReleaseChunks(chunk->Next);
+		chunk->Next = nullptr;
+		this->lastChunk = chunk;
+		this->length = newLength;
+	}
+
+	//
+	// Text.
+	//
+
+	//! Appends a null-terminated string.
+	TextBuilderTemplate &Append(const symbol *chars)
+	{
+		if (chars)
+		{
+			size_t count = 0;
+			while (chars[count])
+			{
+				count++;
+			}
+			this->Append(chars, count);
+		}
+		return *this;
+	}
+	//! Appends specified number of characters.
+	TextBuilderTemplate &Append(const symbol *chars, size_t count)
+	{
+		// Text doesn't have to be contiguous, so the rest of the last chunk is filled first.
+		while (count != 0)
+		{
+			Chunk *chunk = this->lastChunk;
+			if (chunk->Length == chunk->Capacity)
+			{
+				chunk = this->AddChunk(count);
+			}
+
+			size_t freeSpace = chunk->Capacity - chunk->Length;
+			size_t portion = count < freeSpace ? count : freeSpace;
+
+			memcpy(chunk->Symbols + chunk->Length, chars, portion * sizeof(symbol));
+			chunk->Length += portion;
+			this->length += portion;
+
+			chars += portion;
+			count -= portion;
+		}
+		return *this;
+	}
+	//! Appends a text.
+	template<typename ReferenceCountType>
+	TextBuilderTemplate &Append(const TextTemplate<symbol, ReferenceCountType> &text)
+	{
+		return this->Append(text.c_str(), text.Length);
+	}
+	//! Appends a character.
+	TextBuilderTemplate &Append(symbol character)
+	{
+		*this->Claim(1) = character;
+		this->Commit(1);
+		return *this;
+	}
+	//! Appends a number of specified characters.
+	TextBuilderTemplate &Append(size_t count, symbol character)
+	{
+		for (; count != 0; count--)
+		{
+			this->Append(character);
+		}
+		return *this;
+	}
+
+	//
+	// Numbers.
+	//
+
+	//! Appends an integer number.
+	TextBuilderTemplate &Append(int value)
+	{
+		return this->AppendSigned(value);
+	}
+	//! Appends an integer number.
+	TextBuilderTemplate &Append(unsigned int value)
+	{
+		return this->AppendDigits(value, false, 1);
+	}
+	//! Appends an integer number.
+	TextBuilderTemplate &Append(long value)
+	{
+		return this->AppendSigned(value);
+	}
+	//! Appends an integer number.
+	TextBuilderTemplate &Append(unsigned long value)
+	{
+		return this->AppendDigits(value, false, 1);
+	}
+	//! Appends an integer number.
+	TextBuilderTemplate &Append(long long value)
+	{
+		return this->AppendSigned(value);
+	}
+	//! Appends an integer number.
+	TextBuilderTemplate &Append(unsigned long long value)
+	{
+		return this->AppendDigits(value, false, 1);
+	}
+	//! Appends a floating point number.
+	//!
+	//! @param value    The number.
+	//! @param decimals Number of digits after the decimal point, up to 9.
+	TextBuilderTemplate &Append(float value, int decimals = 6)
+	{
+		return this->Append(double(value), decimals);
+	}
+	//! Appends a floating point number.
+	//!
+	//! Fixed-point notation is used while the number multiplied by 10^decimals is less than 10^19, so with 6
+	//! decimals numbers from about 10^13 are appended in scientific notation.
+	//!
+	//! @param value    The number.
+	//! @param decimals Number of digits after the decimal point, up to 9.
+	TextBuilderTemplate &Append(double value, int decimals = 6)
+	{
+		if (value != value)
+		{
+			return this->AppendAscii("nan");
+		}
+
+		bool negative = value < 0;
+		double magnitude = negative ? -value : value;
+		if (magnitude > DBL_MAX)
+		{
+			return this->AppendAscii(negative ? "-inf" : "inf");
+		}
+
+		if (decimals < 0)
+		{
+			decimals = 0;
+		}
+		else if (decimals > MaxDecimals)
+		{
+			decimals = MaxDecimals;
+		}
+
+		unsigned long long scale = 1;
+		for (int i = 0; i < decimals; i++)
+		{
+			scale *= 10;
+		}
+
+		double scaled = magnitude * double(scale) + 0.5;
+		if (scaled < 1e19)
+		{
+			unsigned long long fixed = static_cast<unsigned long long>(scaled);
+
+			this->AppendDigits(fixed / scale, negative, 1);
+			if (decimals != 0)
+			{
+				this->Append(symbol('.'));
+				this->AppendDigits(fixed % scale, false, decimals);
+			}
+			return *this;
+		}
+
+		// The number multiplied by 10^decimals doesn't fit into 64-bit integer.
+		int exponent = int(floor(log10(magnitude)));
+		double mantissa = magnitude / pow(10.0, exponent);
+		if (mantissa < 1.0)
+		{
+			// log10 is inexact near powers of 10.
+			mantissa *= 10.0;
+			exponent--;
+		}
+		// Rounding to specified number of decimals can carry into another digit: 9.9999999 becomes 10.000000.
+		if (floor(mantissa * double(scale) + 0.5) >= 10.0 * double(scale))
+		{
+			mantissa /= 10.0;
+			exponent++;
+		}
+		this->Append(negative ? -mantissa : mantissa, decimals);
+		this->Append(symbol('e'));
+		this->Append(symbol('+'));
+		return this->AppendDigits(exponent, false, 2);
+	}
+
+#ifdef CRYCIL_MODULE
+	//
+	// Vectors.
+	//
+
+	//! Appends a 2D vector in form (x, y).
+	//!
+	//! @param vector   The vector.
+	//! @param decimals Number of digits after the decimal point in each component.
+	template<typename ComponentType>
+	TextBuilderTemplate &Append(const Vec2_tpl<ComponentType> &vector, int decimals = 6)
+	{
+		this->Append(symbol('('));
+		this->Append(vector.x, decimals);
+		this->AppendAscii(", ");
+		this->Append(vector.y, decimals);
+		return this->Append(symbol(')'));
+	}
+	//! Appends a 3D vector in form (x, y, z).
+	//!
+	//! @param vector   The vector.
+	//! @param decimals Number of digits after the decimal point in each component.
+	template<typename ComponentType>
+	TextBuilderTemplate &Append(const Vec3_tpl<ComponentType> &vector, int decimals = 6)
+	{
+		this->Append(symbol('('));
+		this->Append(vector.x, decimals);
+		this->AppendAscii(", ");
+		this->Append(vector.y, decimals);
+		this->AppendAscii(", ");
+		this->Append(vector.z, decimals);
+		return this->Append(symbol(')'));
+	}
+	//! Appends a set of Euler angles in form (x, y, z).
+	//!
+	//! @param angles   The angles.
+	//! @param decimals Number of digits after the decimal point in each component.
+	template<typename ComponentType>
+	TextBuilderTemplate &Append(const Ang3_tpl<ComponentType> &angles, int decimals = 6)
+	{
+		return this->Append(Vec3_tpl<ComponentType>(angles.x, angles.y, angles.z), decimals);
+	}
+	//! Appends a quaternion in form (w, (x, y, z)).
+	//!
+	//! @param quaternion The quaternion.
+	//! @param decimals   Number of digits after the decimal point in each component.
+	template<typename ComponentType>
+	TextBuilderTemplate &Append(const Quat_tpl<ComponentType> &quaternion, int decimals = 6)
+	{
+		this->Append(symbol('('));
+		this->Append(quaternion.w, decimals);
+		this->AppendAscii(", ");
+		this->Append(quaternion.v, decimals);
+		return this->Append(symbol(')'));
+	}
+#endif // CRYCIL_MODULE
+
+	//! Appends an object to this builder.
+	template<typename ValueType>
+	TextBuilderTemplate &operator <<(const ValueType &value)
+	{
+		return this->Append(value);
+	}
+private:
+	void InitEmpty()
+	{
+		this->firstChunk.Next     = nullptr;
+		this->firstChunk.Symbols  = this->inlineSymbols;
+		this->firstChunk.Length   = 0;
+		this->firstChunk.Capacity = InlineCapacity;
+
+		this->lastChunk = &this->firstChunk;
+		this->length    = 0;
+	}
+	static void ReleaseChunks(Chunk *chunk)
+	{
+		while (chunk)
+		{
+			Chunk *next = chunk->Next;
+			::operator delete(chunk);
+			chunk = next;
+		}
+	}
+	//! Adds a new chunk to the end of the chain.
+	Chunk *AddChunk(size_t minimalCapacity)
+	{
+		// Every chunk is twice as big as the previous one, so there are few of them even in long texts.
+		size_t capacity = this->lastChunk->Capacity * 2;
+		if (capacity < minimalCapacity)
+		{
+			capacity = minimalCapacity;
+		}
+
+		Chunk *chunk = static_cast<Chunk *>(::operator new(sizeof(Chunk) + capacity * sizeof(symbol)));
+		chunk->Next     = nullptr;
+		chunk->Symbols  = reinterpret_cast<symbol *>(chunk + 1);
+		chunk->Length   = 0;
+		chunk->Capacity = capacity;
+
+		this->lastChunk->Next = chunk;
+		this->lastChunk       = chunk;
+		return chunk;
+	}
+	//! Gets a pointer to the contiguous space where specified number of characters can be written.
+	symbol *Claim(size_t count)
+	{
+		Chunk *chunk = this->lastChunk;
+		if (chunk->Capacity - chunk->Length < count)
+		{
+			chunk = this->AddChunk(count);
+		}
+		return chunk->Symbols + chunk->Length;
+	}
+	//! Accounts for the characters that were written to the space that was returned by Claim().
+	void Commit(size_t count)
+	{
+		this->lastChunk->Length += count;
+		this->length += count;
+	}
+	//! Appends a string of ASCII characters.
+	TextBuilderTemplate &AppendAscii(const char *chars)
+	{
+		for (; *chars; chars++)
+		{
+			this->Append(symbol(*chars));
+		}
+		return *this;
+	}
+	template<typename IntegerType>
+	TextBuilderTemplate &AppendSigned(IntegerType value)
+	{
+		// Negation is done on unsigned number, so the smallest negative one doesn't overflow.
+		unsigned long long magnitude = static_cast<unsigned long long>(value);
+		if (value < 0)
+		{
+			magnitude = 0 - magnitude;
+		}
+		return this->AppendDigits(magnitude, value < 0, 1);
+	}
+	//! Appends decimal digits of the number.
+	//!
+	//! @param value         The number.
+	//! @param negative      Indicates whether the minus sign must be written before the digits.
+	//! @param minimalDigits Smallest number of digits to write, the number is padded with zeros.
+	TextBuilderTemplate &AppendDigits(unsigned long long value, bool negative, int minimalDigits)
+	{
+		symbol digits[20];
+		int count = 0;
+		do
+		{
+			digits[count++] = symbol('0' + value % 10);
+			value /= 10;
+		} while (value != 0 || count < minimalDigits);
+
+		symbol *destination = this->Claim(count + 1);
+		size_t written = 0;
+		if (negative)
+		{
+			destination[written++] = symbol('-');
+		}
+		while (count != 0)
+		{
+			destination[written++] = digits[--count];
+		}
+		this->Commit(written);
+		return *this;
+	}
+};
+
+typedef TextBuilderTemplate<char> TextBuilder;
+typedef TextBuilderTemplate<wchar_t> TextBuilder16;
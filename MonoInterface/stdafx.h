@@ -55,6 +55,8 @@
 #include "Text.h"
 #include "NtText.h"
 #include "List.hpp"
+#include "InlineList.hpp"
+#include "TextBuilder.h"
 
 // Include monosgen-2.0.lib from relevant folder. (Folder is defined in project properties.)
 #pragma comment(lib, "monosgen-2.0.lib")